@@ -11,13 +11,23 @@
 
 #include "AntennaPlotFunction.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <sstream>
 #include <string>
+#include <thread>
 
 #include "UtInput.hpp"
+#include "UtInputBlock.hpp"
+#include "UtLog.hpp"
 #include "UtMath.hpp"
+#include "UtMemory.hpp"
+#include "WsfAntennaPattern.hpp"
 #include "WsfAntennaPatternTypes.hpp"
 #include "WsfEM_Rcvr.hpp"
 #include "WsfEM_Util.hpp"
@@ -31,6 +41,7 @@ AntennaPlotFunction::AntennaPlotFunction(WsfScenario& aScenario)
    , mPatternName()
    , mOutputFile()
    , mGnuPlotFile()
+   , mBinaryFile()
    , mHeaderLine1()
    , mHeaderLine2()
    , mHeaderLine3()
@@ -52,6 +63,9 @@ AntennaPlotFunction::AntennaPlotFunction(WsfScenario& aScenario)
    , mEBS_ElLossExponent(1.0)
    , mEBS_Az(0.0)
    , mEBS_El(0.0)
+   , mFrequencies()
+   , mPolarizations()
+   , mThreadCount(1)
 {
 }
 
@@ -67,27 +81,7 @@ bool AntennaPlotFunction::Execute(WsfSimulation& aSimulation)
       out.AddNote() << "Pattern: " << mPatternName;
       return false;
    }
-
-   WsfEM_Antenna* antennaPtr = new WsfEM_Antenna();
-   if (antennaPtr == nullptr)
-   {
-      ut::log::error() << "Unable to find setup antenna.";
-      return false;
-   }
-
-   WsfEM_Rcvr* rcvrPtr = new WsfEM_Rcvr(WsfEM_Rcvr::cRF_UNDEFINED, antennaPtr);
-   if (rcvrPtr == nullptr)
-   {
-      ut::log::error() << "Unable to find setup articulated part.";
-      return false;
-   }
    patternPtr->Initialize(mSimulationPtr); // ESA patterns require initialization, since we aren't initializing the rcvr
-   rcvrPtr->SetAntennaPattern(patternPtr, mPolarization, mFrequency);
-   rcvrPtr->GetAntenna()->SetEBS_Mode(mEBS_Mode);
-   rcvrPtr->GetAntenna()->SetEBS_AzCosSteeringLimit(mEBS_AzCosSteeringLimit);
-   rcvrPtr->GetAntenna()->SetEBS_ElCosSteeringLimit(mEBS_ElCosSteeringLimit);
-   rcvrPtr->GetAntenna()->SetEBS_AzLossExponent(mEBS_AzLossExponent);
-   rcvrPtr->GetAntenna()->SetEBS_ElLossExponent(mEBS_ElLossExponent);
 
    if (((mEBS_Mode == WsfEM_Antenna::cEBS_NONE) || (mEBS_Mode == WsfEM_Antenna::cEBS_ELEVATION)) && (mEBS_Az > 0.0))
    {
@@ -105,182 +99,379 @@ bool AntennaPlotFunction::Execute(WsfSimulation& aSimulation)
       mEBS_El = 0.0;
    }
 
-   bool ok = false;
+   if ((mPlotType != 'b') && (mPlotType != 'h') && (mPlotType != 'v'))
+   {
+      auto out = ut::log::error() << "Bad plot type.";
+      out.AddNote() << "Type: " << mPlotType;
+      return false;
+   }
+
+   // Only the full grid is swept in parallel. Each thread evaluates the (shared) pattern through its own receiver.
+   size_t threadCount = 1;
    if (mPlotType == 'b')
    {
-      ok = PlotBoth(rcvrPtr);
+      threadCount = mThreadCount;
+      if (threadCount == 0)
+      {
+         threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+      }
    }
-   else if (mPlotType == 'h')
+   std::vector<Receiver> receivers(threadCount);
+   for (Receiver& receiver : receivers)
    {
-      ok = PlotHorizontal(rcvrPtr);
+      CreateReceiver(patternPtr, receiver);
    }
-   else if (mPlotType == 'v')
+
+   std::vector<double> frequencies(mFrequencies);
+   if (frequencies.empty())
    {
-      ok = PlotVertical(rcvrPtr);
+      frequencies.push_back(mFrequency);
    }
-   else
+   std::vector<WsfEM_Types::Polarization> polarizations(mPolarizations);
+   if (polarizations.empty())
    {
-      auto out = ut::log::error() << "Bad plot type.";
-      out.AddNote() << "Type: " << mPlotType;
+      polarizations.push_back(mPolarization);
+   }
+   bool multipleSweeps = ((frequencies.size() * polarizations.size()) > 1);
+
+   bool ok = true;
+   for (WsfEM_Types::Polarization polarization : polarizations)
+   {
+      for (double frequency : frequencies)
+      {
+         Sweep sweep;
+         sweep.mFrequency    = frequency;
+         sweep.mPolarization = polarization;
+         sweep.mOutputFile   = mOutputFile;
+         sweep.mGnuPlotFile  = mGnuPlotFile;
+         sweep.mBinaryFile   = mBinaryFile;
+         if (multipleSweeps)
+         {
+            sweep.mOutputFile  = SweepFileName(mOutputFile, sweep);
+            sweep.mGnuPlotFile = SweepFileName(mGnuPlotFile, sweep);
+            sweep.mBinaryFile  = SweepFileName(mBinaryFile, sweep);
+         }
+
+         for (Receiver& receiver : receivers)
+         {
+            receiver.mRcvrPtr->SetAntennaPattern(patternPtr, polarization, frequency);
+         }
+
+         if (mPlotType == 'b')
+         {
+            ok &= PlotBoth(receivers, sweep);
+         }
+         else if (mPlotType == 'h')
+         {
+            ok &= PlotHorizontal(receivers[0].mRcvrPtr.get(), sweep);
+         }
+         else
+         {
+            ok &= PlotVertical(receivers[0].mRcvrPtr.get(), sweep);
+         }
+      }
    }
    return ok;
 }
 
-bool AntennaPlotFunction::PlotBoth(WsfEM_Rcvr* rcvrPtr)
+//! Create the antenna and receiver through which the pattern is evaluated.
+void AntennaPlotFunction::CreateReceiver(WsfAntennaPattern* aPatternPtr, Receiver& aReceiver)
+{
+   aReceiver.mAntennaPtr = ut::make_unique<WsfEM_Antenna>();
+   aReceiver.mRcvrPtr    = ut::make_unique<WsfEM_Rcvr>(WsfEM_Rcvr::cRF_UNDEFINED, aReceiver.mAntennaPtr.get());
+
+   WsfEM_Rcvr* rcvrPtr = aReceiver.mRcvrPtr.get();
+   rcvrPtr->SetAntennaPattern(aPatternPtr, mPolarization, mFrequency);
+   rcvrPtr->GetAntenna()->SetEBS_Mode(mEBS_Mode);
+   rcvrPtr->GetAntenna()->SetEBS_AzCosSteeringLimit(mEBS_AzCosSteeringLimit);
+   rcvrPtr->GetAntenna()->SetEBS_ElCosSteeringLimit(mEBS_ElCosSteeringLimit);
+   rcvrPtr->GetAntenna()->SetEBS_AzLossExponent(mEBS_AzLossExponent);
+   rcvrPtr->GetAntenna()->SetEBS_ElLossExponent(mEBS_ElLossExponent);
+}
+
+//! Return true if the pattern selected for the sweep is electronically steered.
+//! This is constant for the sweep, so it is determined once rather than for every point.
+bool AntennaPlotFunction::IsSteered(WsfEM_Rcvr* aRcvrPtr, const Sweep& aSweep) const
+{
+   return (dynamic_cast<WsfESA_AntennaPattern*>(aRcvrPtr->GetAntennaPattern(aSweep.mPolarization, aSweep.mFrequency)) !=
+           nullptr);
+}
+
+//! Compute the gains (dB) at the specified plot angles.
+//! The pattern is evaluated for all of the angles with one call to WsfAntennaPattern::GetGains so patterns
+//! that can evaluate many angles together do so. The gains are the same as from WsfEM_Rcvr::GetAntennaGain,
+//! including the beam steering loss.
+//! @param aRcvrPtr The receiver whose pattern is plotted.
+//! @param aSweep   The sweep being plotted.
+//! @param aSteered true if the pattern is electronically steered (see IsSteered).
+//! @param aAzRad   The plot azimuths (radians).
+//! @param aElRad   The plot elevations (radians), one for each azimuth.
+//! @param aGains   [output] The gains (dB), one for each azimuth.
+void AntennaPlotFunction::ComputeGains(WsfEM_Rcvr*                aRcvrPtr,
+                                       const Sweep&               aSweep,
+                                       bool                       aSteered,
+                                       const std::vector<double>& aAzRad,
+                                       const std::vector<double>& aElRad,
+                                       double*                    aGains) const
+{
+   size_t              count = aAzRad.size();
+   std::vector<double> azAngles(count);
+   std::vector<double> elAngles(count);
+   for (size_t i = 0; i < count; ++i)
+   {
+      // Use 'min' to limit angles because they may creep slightly outside the limits because of numerical issues.
+      azAngles[i] = std::min(aAzRad[i], mAzimuthMax);
+      elAngles[i] = std::min(aElRad[i] - mTiltAngle, mElevationMax);
+
+      if (aSteered)
+      {
+         azAngles[i] -= mEBS_Az;
+         elAngles[i] -= mEBS_El;
+      }
+   }
+
+   std::vector<double> gains(count, 1.0);
+   WsfAntennaPattern*  patternPtr = aRcvrPtr->GetAntennaPattern(aSweep.mPolarization, aSweep.mFrequency);
+   if (patternPtr != nullptr)
+   {
+      patternPtr->GetGains(aSweep.mFrequency, azAngles, elAngles, mEBS_Az, mEBS_El, gains);
+      if (aRcvrPtr->GetAntenna()->GetEBS_Mode() != WsfEM_Antenna::cEBS_NONE)
+      {
+         double steeringLoss = aRcvrPtr->GetAntenna()->ComputeBeamSteeringLoss(mEBS_Az, mEBS_El);
+         double minimumGain  = patternPtr->GetMinimumGain();
+         for (double& gain : gains)
+         {
+            gain = std::max(gain * steeringLoss, minimumGain);
+         }
+      }
+   }
+
+   for (size_t i = 0; i < count; ++i)
+   {
+      double gain = UtMath::SafeLinearToDB(gains[i]);
+      if (fabs(gain) < 1.0E-8)
+      {
+         gain = 0.0;
+      }
+      aGains[i] = gain;
+   }
+}
+
+namespace
+{
+//! Return the angles from aMin to aMax (inclusive) in increments of aStep.
+//! The angles are accumulated exactly as the plot loops have always done so the output is unchanged.
+std::vector<double> SweepAngles(double aMin, double aMax, double aStep)
+{
+   std::vector<double> angles;
+   for (double angle = aMin; angle <= (aMax + 0.01 * aStep); angle += aStep)
+   {
+      angles.push_back(angle);
+   }
+   return angles;
+}
+
+//! Return an angle in degrees for output, with values very near zero set to zero.
+double OutputAngle(double aAngle)
 {
+   double value = aAngle * UtMath::cDEG_PER_RAD;
+   if (fabs(value) < 1.0E-8)
+   {
+      value = 0.0;
+   }
+   return value;
+}
+} // namespace
+
+bool AntennaPlotFunction::PlotBoth(std::vector<Receiver>& aReceivers, const Sweep& aSweep)
+{
+   // The number of azimuth rows computed between writes to the binary file.
+   static const size_t cROWS_PER_BLOCK = 64;
+
+   std::vector<double> azAngles(SweepAngles(mAzimuthMin, mAzimuthMax, mAzimuthStep));
+   std::vector<double> elAngles(SweepAngles(mElevationMin, mElevationMax, mElevationStep));
+
    std::vector<double> rowValues;
    std::vector<double> colValues;
    std::vector<double> dataValues;
+   std::transform(azAngles.begin(), azAngles.end(), std::back_inserter(rowValues), OutputAngle);
+   std::transform(elAngles.begin(), elAngles.end(), std::back_inserter(colValues), OutputAngle);
 
-   for (double azRad = mAzimuthMin; azRad <= (mAzimuthMax + 0.01 * mAzimuthStep); azRad += mAzimuthStep)
+   size_t rowCount = azAngles.size();
+   size_t colCount = elAngles.size();
+
+   // The whole grid is retained only if it is needed by the text writers.
+   bool retainData = (!aSweep.mOutputFile.empty()) || (!aSweep.mGnuPlotFile.empty());
+   if (retainData)
    {
-      double value = azRad * UtMath::cDEG_PER_RAD;
-      if (fabs(value) < 1.0E-8)
+      dataValues.reserve(rowCount * colCount);
+   }
+
+   std::ofstream binaryOfs;
+   if (!aSweep.mBinaryFile.empty())
+   {
+      binaryOfs.open(aSweep.mBinaryFile, std::ios::out | std::ios::binary);
+      if (!binaryOfs)
       {
-         value = 0.0;
+         auto out = ut::log::error() << "Unable to open output file.";
+         out.AddNote() << "File: " << aSweep.mBinaryFile;
+         return false;
       }
-      rowValues.push_back(value);
-      for (double elRad = mElevationMin; elRad <= (mElevationMax + 0.01 * mElevationStep); elRad += mElevationStep)
+      { // RAII block
+         auto out = ut::log::info() << "Writing binary file.";
+         out.AddNote() << "File: " << aSweep.mBinaryFile;
+      }
+      WriteBinaryHeader(binaryOfs, aSweep, rowValues, colValues);
+   }
+
+   bool                steered = IsSteered(aReceivers[0].mRcvrPtr.get(), aSweep);
+   std::vector<double> blockValues;
+   std::vector<float>  binaryValues;
+   for (size_t blockBeg = 0; blockBeg < rowCount; blockBeg += cROWS_PER_BLOCK)
+   {
+      size_t blockEnd = std::min(blockBeg + cROWS_PER_BLOCK, rowCount);
+      blockValues.resize((blockEnd - blockBeg) * colCount);
+
+      // Threads take the next unprocessed row until the block is complete.
+      std::atomic<size_t> nextRow(blockBeg);
+      auto                sweepRows = [&](WsfEM_Rcvr* aRcvrPtr)
       {
-         if (azRad == mAzimuthMin)
+         std::vector<double> rowAzAngles;
+         for (size_t row = nextRow++; row < blockEnd; row = nextRow++)
          {
-            value = elRad * UtMath::cDEG_PER_RAD;
-            if (fabs(value) < 1.0E-8)
-            {
-               value = 0.0;
-            }
-            colValues.push_back(value);
+            // Each row is evaluated as one batch.
+            rowAzAngles.assign(colCount, azAngles[row]);
+            double* valuePtr = blockValues.data() + ((row - blockBeg) * colCount);
+            ComputeGains(aRcvrPtr, aSweep, steered, rowAzAngles, elAngles, valuePtr);
          }
-         // Use 'min' to limit angles because they may creep slightly outside the limits because of numerical issues.
-         double azAngle = std::min(azRad, mAzimuthMax);
-         double elAngle = std::min(elRad - mTiltAngle, mElevationMax);
+      };
 
-         if (dynamic_cast<WsfESA_AntennaPattern*>(rcvrPtr->GetAntennaPattern(mPolarization, mFrequency)) != nullptr)
-         {
-            azAngle -= mEBS_Az;
-            elAngle -= mEBS_El;
-         }
+      std::vector<std::thread> threads;
+      for (size_t i = 1; i < aReceivers.size(); ++i)
+      {
+         threads.emplace_back(sweepRows, aReceivers[i].mRcvrPtr.get());
+      }
+      sweepRows(aReceivers[0].mRcvrPtr.get());
+      for (std::thread& thread : threads)
+      {
+         thread.join();
+      }
 
-         double gain = rcvrPtr->GetAntennaGain(mPolarization, mFrequency, azAngle, elAngle, mEBS_Az, mEBS_El);
-         value       = UtMath::SafeLinearToDB(gain);
-         if (fabs(value) < 1.0E-8)
-         {
-            value = 0.0;
-         }
-         dataValues.push_back(value);
+      if (binaryOfs.is_open())
+      {
+         binaryValues.assign(blockValues.begin(), blockValues.end());
+         binaryOfs.write(reinterpret_cast<const char*>(binaryValues.data()), binaryValues.size() * sizeof(float));
       }
+      if (retainData)
+      {
+         dataValues.insert(dataValues.end(), blockValues.begin(), blockValues.end());
+      }
+   }
+
+   if (binaryOfs.is_open())
+   {
+      binaryOfs.close();
+      mSimulationPtr->GetSystemLog().WriteOutputLogEntry("Antenna Plot Binary", aSweep.mBinaryFile);
    }
 
-   if (!mOutputFile.empty())
+   if (!aSweep.mOutputFile.empty())
    {
       { // RAII block
          auto out = ut::log::info() << "Writing output file.";
-         out.AddNote() << "File: " << mOutputFile;
+         out.AddNote() << "File: " << aSweep.mOutputFile;
       }
-      WritePlotFile(mOutputFile, rowValues, colValues, dataValues);
+      WritePlotFile(aSweep.mOutputFile, rowValues, colValues, dataValues);
    }
 
-   if (!mGnuPlotFile.empty())
+   if (!aSweep.mGnuPlotFile.empty())
    {
       { // RAII block
          auto out = ut::log::info() << "Writing GNU Plot file.";
-         out.AddNote() << "File: " << mGnuPlotFile;
+         out.AddNote() << "File: " << aSweep.mGnuPlotFile;
       }
 
-      WriteGnuPlotFile(rowValues, colValues, dataValues);
+      WriteGnuPlotFile(aSweep.mGnuPlotFile, rowValues, colValues, dataValues);
    }
 
    return true;
 }
 
-bool AntennaPlotFunction::PlotHorizontal(WsfEM_Rcvr* rcvrPtr)
+bool AntennaPlotFunction::PlotHorizontal(WsfEM_Rcvr* rcvrPtr, const Sweep& aSweep)
 {
-   std::ofstream ofs(mOutputFile);
+   std::ofstream ofs(aSweep.mOutputFile);
    if (!ofs)
    {
       auto out = ut::log::error() << "Unable to open output file.";
-      out.AddNote() << "File: " << mOutputFile;
+      out.AddNote() << "File: " << aSweep.mOutputFile;
       return false;
    }
    else
    {
       auto out = ut::log::info() << "Writing output file.";
-      out.AddNote() << "File: " << mOutputFile;
+      out.AddNote() << "File: " << aSweep.mOutputFile;
    }
 
    ofs << "# " << mPatternName << " - horizontal plot" << std::endl;
-   double elRad = 0.0;
-   for (double azRad = mAzimuthMin; azRad <= (mAzimuthMax + 0.01 * mAzimuthStep); azRad += mAzimuthStep)
+   std::vector<double> azAngles(SweepAngles(mAzimuthMin, mAzimuthMax, mAzimuthStep));
+   std::vector<double> elAngles(azAngles.size(), 0.0);
+   std::vector<double> gains(azAngles.size());
+   ComputeGains(rcvrPtr, aSweep, IsSteered(rcvrPtr, aSweep), azAngles, elAngles, gains.data());
+   for (size_t i = 0; i < azAngles.size(); ++i)
    {
-      // Use 'min' to limit angles because they may creep slightly outside the limits because of numerical issues.
-      double azAngle = std::min(azRad, mAzimuthMax);
-      double elAngle = std::min(elRad - mTiltAngle, mElevationMax);
-
-      if (dynamic_cast<WsfESA_AntennaPattern*>(rcvrPtr->GetAntennaPattern(mPolarization, mFrequency)) != nullptr)
-      {
-         azAngle -= mEBS_Az;
-         elAngle -= mEBS_El;
-      }
-
-      double gain = rcvrPtr->GetAntennaGain(mPolarization, mFrequency, azAngle, elAngle, mEBS_Az, mEBS_El);
-      gain        = UtMath::SafeLinearToDB(gain);
-      if (fabs(gain) < 1.0E-8)
-      {
-         gain = 0.0;
-      }
-      double angle = azRad * UtMath::cDEG_PER_RAD;
-      if (fabs(angle) < 1.0E-8)
-      {
-         angle = 0.0;
-      }
-      ofs << angle << ' ' << gain << std::endl;
+      ofs << OutputAngle(azAngles[i]) << ' ' << gains[i] << std::endl;
    }
    return true;
 }
 
-bool AntennaPlotFunction::PlotVertical(WsfEM_Rcvr* rcvrPtr)
+bool AntennaPlotFunction::PlotVertical(WsfEM_Rcvr* rcvrPtr, const Sweep& aSweep)
 {
-   std::ofstream ofs(mOutputFile);
+   std::ofstream ofs(aSweep.mOutputFile);
    if (!ofs)
    {
       auto out = ut::log::error() << "Unable to open output file.";
-      out.AddNote() << "File: " << mOutputFile;
+      out.AddNote() << "File: " << aSweep.mOutputFile;
       return false;
    }
    else
    {
       auto out = ut::log::info() << "Writing output file.";
-      out.AddNote() << "File: " << mOutputFile;
+      out.AddNote() << "File: " << aSweep.mOutputFile;
    }
 
    ofs << "# " << mPatternName << " - vertical plot" << std::endl;
-   double azRad = 0.0;
-   for (double elRad = mElevationMin; elRad <= (mElevationMax + 0.01 * mElevationStep); elRad += mElevationStep)
+   std::vector<double> elAngles(SweepAngles(mElevationMin, mElevationMax, mElevationStep));
+   std::vector<double> azAngles(elAngles.size(), 0.0);
+   std::vector<double> gains(elAngles.size());
+   ComputeGains(rcvrPtr, aSweep, IsSteered(rcvrPtr, aSweep), azAngles, elAngles, gains.data());
+   for (size_t i = 0; i < elAngles.size(); ++i)
    {
-      // Use 'min' to limit angles because they may creep slightly outside the limits because of numerical issues.
-      double azAngle = std::min(azRad, mAzimuthMax);
-      double elAngle = std::min(elRad - mTiltAngle, mElevationMax);
+      ofs << OutputAngle(elAngles[i]) << ' ' << gains[i] << std::endl;
+   }
+   return true;
+}
 
-      if (dynamic_cast<WsfESA_AntennaPattern*>(rcvrPtr->GetAntennaPattern(mPolarization, mFrequency)) != nullptr)
-      {
-         azAngle -= mEBS_Az;
-         elAngle -= mEBS_El;
-      }
+//! Return the name of an output file for one of several sweeps.
+//! The frequency and polarization are inserted in front of the file extension.
+// static
+std::string AntennaPlotFunction::SweepFileName(const std::string& aFileName, const Sweep& aSweep)
+{
+   if (aFileName.empty())
+   {
+      return aFileName;
+   }
 
-      double gain = rcvrPtr->GetAntennaGain(mPolarization, mFrequency, azAngle, elAngle, mEBS_Az, mEBS_El);
-      gain        = UtMath::SafeLinearToDB(gain);
-      if (fabs(gain) < 1.0E-8)
-      {
-         gain = 0.0;
-      }
-      double angle = elRad * UtMath::cDEG_PER_RAD;
-      if (fabs(angle) < 1.0E-8)
-      {
-         angle = 0.0;
-      }
-      ofs << angle << ' ' << gain << std::endl;
+   std::ostringstream oss;
+   oss << '_' << aSweep.mFrequency * 1.0E-6 << "mhz_" << WsfEM_Util::EnumToString(aSweep.mPolarization);
+
+   std::string            fileName(aFileName);
+   std::string::size_type dirPos = fileName.find_last_of("/\\");
+   std::string::size_type extPos = fileName.find_last_of('.');
+   if ((extPos == std::string::npos) || ((dirPos != std::string::npos) && (extPos < dirPos)))
+   {
+      extPos = fileName.size();
    }
-   return true;
+   fileName.insert(extPos, oss.str());
+   return fileName;
 }
 
 bool AntennaPlotFunction::ProcessInput(UtInput& aInput)
@@ -428,6 +619,41 @@ bool AntennaPlotFunction::ProcessInput(UtInput& aInput)
          throw UtInput::BadValue(aInput, "Invalid polarization: " + polarizationStr);
       }
    }
+   else if (command == "frequencies")
+   {
+      mFrequencies.clear();
+      UtInputBlock inputBlock(aInput);
+      while (inputBlock.ReadCommand(command))
+      {
+         aInput.PushBack(command);
+         double frequency;
+         aInput.ReadValueOfType(frequency, UtInput::cFREQUENCY);
+         aInput.ValueGreater(frequency, 0.0);
+         mFrequencies.push_back(frequency);
+      }
+   }
+   else if (command == "polarizations")
+   {
+      mPolarizations.clear();
+      UtInputBlock inputBlock(aInput);
+      std::string  polarizationStr;
+      while (inputBlock.ReadCommand(polarizationStr))
+      {
+         WsfEM_Types::Polarization polarization;
+         if (!WsfEM_Util::StringToEnum(polarization, polarizationStr))
+         {
+            throw UtInput::BadValue(aInput, "Invalid polarization: " + polarizationStr);
+         }
+         mPolarizations.push_back(polarization);
+      }
+   }
+   else if (command == "thread_count")
+   {
+      int threadCount;
+      aInput.ReadValue(threadCount);
+      aInput.ValueGreaterOrEqual(threadCount, 0);
+      mThreadCount = static_cast<unsigned int>(threadCount);
+   }
    else if (command == "output_file")
    {
       aInput.ReadValueQuoted(mOutputFile);
@@ -438,6 +664,11 @@ bool AntennaPlotFunction::ProcessInput(UtInput& aInput)
       aInput.ReadValueQuoted(mGnuPlotFile);
       mGnuPlotFile = aInput.SubstitutePathVariables(mGnuPlotFile);
    }
+   else if (command == "binary_file")
+   {
+      aInput.ReadValueQuoted(mBinaryFile);
+      mBinaryFile = aInput.SubstitutePathVariables(mBinaryFile);
+   }
    else if (command == "header_line_1")
    {
       aInput.ReadLine(mHeaderLine1, false);
@@ -537,19 +768,20 @@ void AntennaPlotFunction::WritePlotFile(const std::string&         aFileName,
       ofs << '\n';
    }
 
-   mSimulationPtr->GetSystemLog().WriteOutputLogEntry("Antenna Plot", mOutputFile);
+   mSimulationPtr->GetSystemLog().WriteOutputLogEntry("Antenna Plot", aFileName);
 }
 
 //! Write the output file.
-void AntennaPlotFunction::WriteGnuPlotFile(const std::vector<double>& aRowValues,
+void AntennaPlotFunction::WriteGnuPlotFile(const std::string&         aFileName,
+                                           const std::vector<double>& aRowValues,
                                            const std::vector<double>& aColValues,
                                            const std::vector<double>& aDataValues)
 {
-   std::ofstream ofs(mGnuPlotFile);
+   std::ofstream ofs(aFileName);
    if (!ofs)
    {
       auto out = ut::log::error() << "Unable to open output file.";
-      out.AddNote() << "File: " << mGnuPlotFile;
+      out.AddNote() << "File: " << aFileName;
       return;
    }
 
@@ -580,7 +812,7 @@ void AntennaPlotFunction::WriteGnuPlotFile(const std::vector<double>& aRowValues
        << "# set zrange [-299:299] #ignore hard limits\n"
        << "# set xlabel \"Azimuth Angle\"\n"
        << "# set ylabel \"Elevation Angle\"\n"
-       << "# splot \"" << mGnuPlotFile << "\" with pm3d\n";
+       << "# splot \"" << aFileName << "\" with pm3d\n";
    // clang-format on
 
    ofs << "#\n";
@@ -603,5 +835,34 @@ void AntennaPlotFunction::WriteGnuPlotFile(const std::vector<double>& aRowValues
       ofs << '\n';
    }
 
-   mSimulationPtr->GetSystemLog().WriteOutputLogEntry("GNU Plot", mGnuPlotFile);
+   mSimulationPtr->GetSystemLog().WriteOutputLogEntry("GNU Plot", aFileName);
+}
+
+//! Write the header of the binary grid file.
+//! The file is written in the native byte order and has the following layout:
+//! - char[8]     "ANTPLOT1"
+//! - double      frequency (Hz)
+//! - int32       polarization (WsfEM_Types::Polarization)
+//! - uint64      row (azimuth) count
+//! - uint64      column (elevation) count
+//! - double[row] azimuth values (deg)
+//! - double[col] elevation values (deg)
+//! - float[row * col] gain values (dB), row-major (all of the elevations for the first azimuth, ...)
+void AntennaPlotFunction::WriteBinaryHeader(std::ostream&              aOut,
+                                            const Sweep&               aSweep,
+                                            const std::vector<double>& aRowValues,
+                                            const std::vector<double>& aColValues)
+{
+   static const char cMAGIC[8] = {'A', 'N', 'T', 'P', 'L', 'O', 'T', '1'};
+
+   std::int32_t  polarization = static_cast<std::int32_t>(aSweep.mPolarization);
+   std::uint64_t rowCount     = aRowValues.size();
+   std::uint64_t colCount     = aColValues.size();
+   aOut.write(cMAGIC, sizeof(cMAGIC));
+   aOut.write(reinterpret_cast<const char*>(&aSweep.mFrequency), sizeof(aSweep.mFrequency));
+   aOut.write(reinterpret_cast<const char*>(&polarization), sizeof(polarization));
+   aOut.write(reinterpret_cast<const char*>(&rowCount), sizeof(rowCount));
+   aOut.write(reinterpret_cast<const char*>(&colCount), sizeof(colCount));
+   aOut.write(reinterpret_cast<const char*>(aRowValues.data()), aRowValues.size() * sizeof(double));
+   aOut.write(reinterpret_cast<const char*>(aColValues.data()), aColValues.size() * sizeof(double));
 }
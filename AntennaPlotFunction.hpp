@@ -12,10 +12,13 @@
 #ifndef ANTENNAPLOTFUNCTION_HPP
 #define ANTENNAPLOTFUNCTION_HPP
 
+#include <iosfwd>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "Function.hpp"
+class WsfAntennaPattern;
 #include "WsfEM_Antenna.hpp"
 class WsfEM_Rcvr;
 #include "WsfEM_Types.hpp"
@@ -29,23 +32,59 @@ public:
    bool ProcessInput(UtInput& aInput) override;
 
 private:
-   bool PlotBoth(WsfEM_Rcvr* rcvrPtr);
-   bool PlotHorizontal(WsfEM_Rcvr* rcvrPtr);
-   bool PlotVertical(WsfEM_Rcvr* rcvrPtr);
+   //! The frequency, polarization and output files of a single sweep of the pattern.
+   struct Sweep
+   {
+      double                    mFrequency;
+      WsfEM_Types::Polarization mPolarization;
+      std::string               mOutputFile;
+      std::string               mGnuPlotFile;
+      std::string               mBinaryFile;
+   };
+
+   //! The antenna and receiver used to evaluate the pattern. Each sweep thread has its own.
+   struct Receiver
+   {
+      std::unique_ptr<WsfEM_Antenna> mAntennaPtr;
+      std::unique_ptr<WsfEM_Rcvr>    mRcvrPtr;
+   };
+
+   void CreateReceiver(WsfAntennaPattern* aPatternPtr, Receiver& aReceiver);
+
+   bool   IsSteered(WsfEM_Rcvr* aRcvrPtr, const Sweep& aSweep) const;
+   void   ComputeGains(WsfEM_Rcvr*                aRcvrPtr,
+                       const Sweep&               aSweep,
+                       bool                       aSteered,
+                       const std::vector<double>& aAzRad,
+                       const std::vector<double>& aElRad,
+                       double*                    aGains) const;
+
+   bool PlotBoth(std::vector<Receiver>& aReceivers, const Sweep& aSweep);
+   bool PlotHorizontal(WsfEM_Rcvr* rcvrPtr, const Sweep& aSweep);
+   bool PlotVertical(WsfEM_Rcvr* rcvrPtr, const Sweep& aSweep);
+
+   static std::string SweepFileName(const std::string& aFileName, const Sweep& aSweep);
 
    void WritePlotFile(const std::string&         aFileName,
                       const std::vector<double>& aRowValues,
                       const std::vector<double>& aColValues,
                       const std::vector<double>& aDataValues);
 
-   void WriteGnuPlotFile(const std::vector<double>& aRowValues,
+   void WriteGnuPlotFile(const std::string&         aFileName,
+                         const std::vector<double>& aRowValues,
                          const std::vector<double>& aColValues,
                          const std::vector<double>& aDataValues);
 
+   void WriteBinaryHeader(std::ostream&              aOut,
+                          const Sweep&               aSweep,
+                          const std::vector<double>& aRowValues,
+                          const std::vector<double>& aColValues);
+
    WsfSimulation*            mSimulationPtr;
    std::string               mPatternName;
    std::string               mOutputFile;
    std::string               mGnuPlotFile;
+   std::string               mBinaryFile;
    std::string               mHeaderLine1;
    std::string               mHeaderLine2;
    std::string               mHeaderLine3;
@@ -67,6 +106,12 @@ private:
    double                    mEBS_ElLossExponent;
    double                    mEBS_Az;
    double                    mEBS_El;
+
+   //! Optional lists of frequencies and polarizations to be swept in one pass (overrides the single values).
+   std::vector<double>                    mFrequencies;
+   std::vector<WsfEM_Types::Polarization> mPolarizations;
+   //! The number of threads used to sweep the grid (0 = hardware concurrency).
+   unsigned int mThreadCount;
 };
 
 #endif
@@ -12,23 +12,43 @@
 #include "ClutterTableFunction.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include "UtInput.hpp"
 #include "UtInputBlock.hpp"
+#include "UtLog.hpp"
 #include "UtMath.hpp"
+#include "UtMemory.hpp"
+#include "WsfEM_Clutter.hpp"
 #include "WsfGeoPoint.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfRadarSensor.hpp"
 #include "WsfScenario.hpp"
 #include "WsfSensor.hpp"
+#include "WsfSensorMode.hpp"
 #include "WsfSensorResult.hpp"
 #include "WsfSimulation.hpp"
 #include "WsfSystemLog.hpp"
 #include "WsfTerrain.hpp"
 #include "WsfUtil.hpp"
 
+namespace
+{
+//! The minimum clutter (dBW) written to the table.
+const double cMIN_CLUTTER_DBW = -360.0;
+
+//! Identifies a clutter table checkpoint file.
+const char cCHECKPOINT_MAGIC[8] = {'C', 'L', 'U', 'T', 'C', 'K', 'P', '1'};
+} // namespace
+
 ClutterTableFunction::ClutterTableFunction(WsfScenario& aScenario)
    : Function(aScenario)
    , mSimulationPtr(nullptr)
@@ -50,6 +70,11 @@ ClutterTableFunction::ClutterTableFunction(WsfScenario& aScenario)
    , mRangeUnitsStr("m")
    , mRangeUnitsScale(1.0)
    , mBearingUnitsScale(UtMath::cDEG_PER_RAD)
+   , mBearings()
+   , mBinaryFileName()
+   , mCheckpointFileName()
+   , mThreadCount(1)
+   , mClutterOnly(false)
 {
 }
 
@@ -63,7 +88,7 @@ bool ClutterTableFunction::Execute(WsfSimulation& aSimulation)
       return false;
    }
 
-   mSensor.GetPlatform()->SetOrientationNED(mSensorPlatformYaw, mSensorPlatformPitch, mSensorPlatformRoll);
+   double sensorPlatformAlt = mSensorPlatformAlt;
    if (mSensorPlatformAltSet)
    {
       wsf::Terrain terrain(aSimulation.GetTerrainInterface());
@@ -71,12 +96,37 @@ bool ClutterTableFunction::Execute(WsfSimulation& aSimulation)
       {
          float elev;
          terrain.GetElevInterp(mSensorPlatformLat, mSensorPlatformLon, elev);
-         mSensorPlatformAlt += elev;
+         sensorPlatformAlt += elev;
       }
    }
-   mSensor.GetPlatform()->SetLocationLLA(mSensorPlatformLat, mSensorPlatformLon, mSensorPlatformAlt);
+   PositionSensor(mSensor, sensorPlatformAlt);
 
-   // We still need to set the location of the sensor.
+   // Each thread uses its own sensor and target. The first thread uses the primary objects and the others use
+   // copies that are created from the same input. If a copy cannot be created the remaining threads are not used.
+   unsigned int threadCount = mThreadCount;
+   if (threadCount == 0)
+   {
+      threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+   }
+   std::vector<std::unique_ptr<Sensor>> sensorCopies;
+   std::vector<std::unique_ptr<Target>> targetCopies;
+   std::vector<Sensor*>                 sensors(1, &mSensor);
+   std::vector<Target*>                 targets(1, &mTarget);
+   while (sensors.size() < threadCount)
+   {
+      sensorCopies.push_back(ut::make_unique<Sensor>(mSensor));
+      targetCopies.push_back(ut::make_unique<Target>(mTarget));
+      if ((!sensorCopies.back()->CreateAndInitialize(aSimulation)) ||
+          (!targetCopies.back()->CreateAndInitialize(aSimulation)))
+      {
+         auto out = ut::log::warning() << "Unable to create an additional sensor/target pair.";
+         out.AddNote() << "Threads: " << sensors.size();
+         break;
+      }
+      PositionSensor(*sensorCopies.back(), sensorPlatformAlt);
+      sensors.push_back(sensorCopies.back().get());
+      targets.push_back(targetCopies.back().get());
+   }
 
    // Generate the base name for output files.  If one hasn't been defined then we'll use the
    // sensor type name.
@@ -86,28 +136,282 @@ bool ClutterTableFunction::Execute(WsfSimulation& aSimulation)
       baseName = mSensor.GetSensor()->GetType();
    }
 
-   std::ofstream plotOfs(baseName.c_str());
-
    std::string objectName(mOutputObjectName);
    if (objectName.empty())
    {
       objectName = mSensor.GetSensor()->GetType();
    }
 
-   plotOfs << "clutter_model " << objectName << " WSF_SURFACE_CLUTTER_TABLE" << std::endl;
+   // Recover any rows that were completed by a previous (interrupted) run.
+   size_t            numBearings = mBearings.size();
+   size_t            rowCount    = mEnvelope.size() * numBearings;
+   ClutterRows       rows(rowCount);
+   std::vector<char> rowDone(rowCount, 0);
+   std::ofstream     checkpointOfs;
+   if (!mCheckpointFileName.empty())
+   {
+      ReadCheckpoint(rows, rowDone);
+
+      // The recovered rows are written to a temporary file that replaces the checkpoint only when it is complete,
+      // so the checkpoint is not lost if this run is interrupted while it is being written.
+      std::string   tempFileName = mCheckpointFileName + ".tmp";
+      std::ofstream tempOfs(tempFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+      std::uint64_t header[2] = {rowCount, 0};
+      for (const PointArray& pointArray : mEnvelope)
+      {
+         header[1] += pointArray.data.size() * numBearings;
+      }
+      tempOfs.write(cCHECKPOINT_MAGIC, sizeof(cCHECKPOINT_MAGIC));
+      tempOfs.write(reinterpret_cast<const char*>(header), sizeof(header));
+      for (size_t row = 0; row < rowCount; ++row)
+      {
+         if (rowDone[row] != 0)
+         {
+            WriteCheckpointRow(tempOfs, row, rows[row]);
+         }
+      }
+      tempOfs.close();
+
+      // std::rename does not replace an existing file on all platforms.
+      bool renamed = (!tempOfs.fail()) && (std::rename(tempFileName.c_str(), mCheckpointFileName.c_str()) == 0);
+      if ((!renamed) && (!tempOfs.fail()))
+      {
+         std::remove(mCheckpointFileName.c_str());
+         renamed = (std::rename(tempFileName.c_str(), mCheckpointFileName.c_str()) == 0);
+      }
+      if (renamed)
+      {
+         checkpointOfs.open(mCheckpointFileName, std::ios::out | std::ios::binary | std::ios::app);
+      }
+      else
+      {
+         std::remove(tempFileName.c_str());
+         auto out = ut::log::warning() << "Unable to write clutter table checkpoint. Continuing without a checkpoint.";
+         out.AddNote() << "File: " << mCheckpointFileName;
+      }
+   }
+
+   std::vector<size_t> pendingRows;
+   for (size_t row = 0; row < rowCount; ++row)
+   {
+      if (rowDone[row] == 0)
+      {
+         pendingRows.push_back(row);
+      }
+   }
+
+   // Threads take the next pending row (one altitude and bearing, all ranges) until all rows are complete.
+   std::atomic<size_t> nextRow(0);
+   std::mutex          checkpointMutex;
+   auto                processRows = [&](size_t aThreadIndex)
+   {
+      WsfSensorResult result;
+      for (size_t i = nextRow++; i < pendingRows.size(); i = nextRow++)
+      {
+         size_t row          = pendingRows[i];
+         size_t altIndex     = row / numBearings;
+         size_t bearingIndex = row % numBearings;
+         if (bearingIndex == 0)
+         {
+            ut::log::info() << "Processing altitude: " << Altitude(mEnvelope, altIndex);
+         }
+
+         std::vector<double>& values = rows[row];
+         values.resize(mEnvelope[altIndex].data.size());
+         for (size_t rangeIndex = 0; rangeIndex < values.size(); ++rangeIndex)
+         {
+            values[rangeIndex] = ComputeClutter(*sensors[aThreadIndex],
+                                                *targets[aThreadIndex],
+                                                result,
+                                                altIndex,
+                                                bearingIndex,
+                                                rangeIndex);
+         }
+
+         if (checkpointOfs.is_open())
+         {
+            std::lock_guard<std::mutex> lock(checkpointMutex);
+            WriteCheckpointRow(checkpointOfs, row, values);
+            checkpointOfs.flush();
+         }
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for (size_t i = 1; i < sensors.size(); ++i)
+   {
+      threads.emplace_back(processRows, i);
+   }
+   processRows(0);
+   for (std::thread& thread : threads)
+   {
+      thread.join();
+   }
+
+   WriteTextTable(baseName, objectName, rows);
+   if (!mBinaryFileName.empty())
+   {
+      WriteBinaryTable(mBinaryFileName, rows);
+   }
+
+   // The table is complete so the checkpoint is no longer needed.
+   if (checkpointOfs.is_open())
+   {
+      checkpointOfs.close();
+      std::remove(mCheckpointFileName.c_str());
+   }
+
+   return true;
+}
+
+//! Set the orientation and location of a sensor platform.
+void ClutterTableFunction::PositionSensor(Sensor& aSensor, double aAltitude)
+{
+   aSensor.GetPlatform()->SetOrientationNED(mSensorPlatformYaw, mSensorPlatformPitch, mSensorPlatformRoll);
+   aSensor.GetPlatform()->SetLocationLLA(mSensorPlatformLat, mSensorPlatformLon, aAltitude);
+}
+
+//! Compute the clutter power (W) for a cell of the table.
+double ClutterTableFunction::ComputeClutter(Sensor&          aSensor,
+                                            Target&          aTarget,
+                                            WsfSensorResult& aResult,
+                                            size_t           aAltIndex,
+                                            size_t           aBearingIndex,
+                                            size_t           aRangeIndex)
+{
+   double altitude    = Altitude(mEnvelope, aAltIndex);
+   double bearing     = mBearings[aBearingIndex];
+   double groundRange = GroundRange(mEnvelope, aAltIndex, aRangeIndex);
+
+   // Set the location, speed and attitude of the target.
+   aTarget.SetLocationRBA(aSensor, groundRange, bearing, altitude);
+
+   aTarget.SetSpeedAndAttitude(aSensor.GetSensor());
+
+   // Attempt to cue the sensor to the target, just in case the sensor is a tracker.
+   aSensor.CueToTarget(aTarget);
+
+   double clutterPower = 0.0;
+   if (!(mClutterOnly && ComputeClutterOnly(aSensor, aTarget, aResult, clutterPower)))
+   {
+      // Perform the detection attempt.
+      /* bool detected = */ aSensor.AttemptToDetect(aTarget, aResult);
+      clutterPower = aResult.mClutterPower;
+   }
+   return clutterPower;
+}
+
+//! Compute only the clutter term for the current geometry (see 'clutter_only').
+//! This is possible only for a single-beam radar mode. The clutter model is evaluated exactly as in a
+//! detection attempt, but the signal, signal processors and sensor components are not evaluated.
+//! @returns true if the clutter was computed, or false if a full detection attempt is required.
+bool ClutterTableFunction::ComputeClutterOnly(Sensor&          aSensor,
+                                              Target&          aTarget,
+                                              WsfSensorResult& aResult,
+                                              double&          aClutterPower)
+{
+   WsfSensorMode* modePtr = aSensor.GetSensor()->GetCurrentMode();
+   if ((modePtr == nullptr) || (modePtr->GetBeamCount() != 1))
+   {
+      return false;
+   }
+   auto beamPtr = dynamic_cast<WsfRadarSensor::RadarBeam*>(modePtr->GetBeamEntry(0));
+   if (beamPtr == nullptr)
+   {
+      return false;
+   }
+
+   aClutterPower = 0.0;
+   aResult.Reset();
+   if ((beamPtr->GetClutter() != nullptr) &&
+       (aResult.BeginTwoWayInteraction(beamPtr->GetEM_Xmtr(), aTarget.GetPlatform(), beamPtr->GetEM_Rcvr()) == 0))
+   {
+      aResult.SetTransmitterBeamPosition();
+      aResult.SetReceiverBeamPosition();
+      aClutterPower = beamPtr->GetClutter()->ComputeClutterPower(aResult,
+                                                                 mSimulationPtr->GetEnvironment(),
+                                                                 beamPtr->GetClutterAttenuationFactor());
+   }
+   return true;
+}
+
+//! Read the rows completed by a previous run from the checkpoint file.
+//! The checkpoint is ignored if it does not exist or was created for a table of a different size.
+//! A partially written row at the end of the file (an interrupted write) is discarded.
+void ClutterTableFunction::ReadCheckpoint(ClutterRows& aRows, std::vector<char>& aRowDone)
+{
+   std::ifstream ifs(mCheckpointFileName, std::ios::in | std::ios::binary);
+   if (!ifs)
+   {
+      return;
+   }
+
+   std::uint64_t cellCount = 0;
+   for (const PointArray& pointArray : mEnvelope)
+   {
+      cellCount += pointArray.data.size() * mBearings.size();
+   }
+
+   char          magic[sizeof(cCHECKPOINT_MAGIC)];
+   std::uint64_t header[2];
+   ifs.read(magic, sizeof(magic));
+   ifs.read(reinterpret_cast<char*>(header), sizeof(header));
+   if ((!ifs) || (std::memcmp(magic, cCHECKPOINT_MAGIC, sizeof(magic)) != 0) || (header[0] != aRows.size()) ||
+       (header[1] != cellCount))
+   {
+      auto out = ut::log::warning() << "Ignoring incompatible clutter table checkpoint.";
+      out.AddNote() << "File: " << mCheckpointFileName;
+      return;
+   }
+
+   size_t        rowsRead = 0;
+   std::uint64_t rowHeader[2];
+   while (ifs.read(reinterpret_cast<char*>(rowHeader), sizeof(rowHeader)))
+   {
+      std::uint64_t row = rowHeader[0];
+      if ((row >= aRows.size()) || (rowHeader[1] != mEnvelope[row / mBearings.size()].data.size()))
+      {
+         break;
+      }
+      std::vector<double> values(static_cast<size_t>(rowHeader[1]));
+      if (!ifs.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(double)))
+      {
+         break;
+      }
+      aRows[row].swap(values);
+      aRowDone[row] = 1;
+      ++rowsRead;
+   }
+
+   auto out = ut::log::info() << "Resuming clutter table from checkpoint.";
+   out.AddNote() << "File: " << mCheckpointFileName;
+   out.AddNote() << "Completed: " << rowsRead << " of " << aRows.size() << " altitude/bearing rows";
+}
+
+//! Append a completed row to the checkpoint file.
+void ClutterTableFunction::WriteCheckpointRow(std::ostream& aOut, size_t aRow, const std::vector<double>& aValues)
+{
+   std::uint64_t rowHeader[2] = {aRow, aValues.size()};
+   aOut.write(reinterpret_cast<const char*>(rowHeader), sizeof(rowHeader));
+   aOut.write(reinterpret_cast<const char*>(aValues.data()), aValues.size() * sizeof(double));
+}
+
+//! Write the table as WSF_SURFACE_CLUTTER_TABLE input.
+void ClutterTableFunction::WriteTextTable(const std::string& aFileName,
+                                          const std::string& aObjectName,
+                                          const ClutterRows& aRows)
+{
+   std::ofstream plotOfs(aFileName.c_str());
+
+   plotOfs << "clutter_model " << aObjectName << " WSF_SURFACE_CLUTTER_TABLE" << std::endl;
    plotOfs << "  clutters" << std::endl;
 
-   WsfSensorResult result;
+   size_t numBearings = mBearings.size();
    for (size_t altIndex = 0; altIndex < mEnvelope.size(); ++altIndex)
    {
       double altitude = Altitude(mEnvelope, altIndex);
-
-      ut::log::info() << "Processing altitude: " << altitude;
-
       plotOfs << "    altitude " << altitude * mAltUnitsScale << " " << mAltUnitsStr << std::endl;
 
-      size_t numBearings = mBearings.size();
-
       for (size_t bearingIndex = 0; bearingIndex < numBearings; ++bearingIndex)
       {
          double bearing = mBearings[bearingIndex];
@@ -117,29 +421,15 @@ bool ClutterTableFunction::Execute(WsfSimulation& aSimulation)
             plotOfs << "     bearing " << bearing * mBearingUnitsScale << " " << mBearingUnitsStr << std::endl;
          }
 
-         for (size_t rangeIndex = 0; rangeIndex < mEnvelope[altIndex].data.size(); ++rangeIndex)
+         const std::vector<double>& values = aRows[(altIndex * numBearings) + bearingIndex];
+         for (size_t rangeIndex = 0; rangeIndex < values.size(); ++rangeIndex)
          {
             double groundRange = GroundRange(mEnvelope, altIndex, rangeIndex);
-
-            // Set the location, speed and attitude of the target.
-            mTarget.SetLocationRBA(mSensor, groundRange, bearing, altitude);
-
-            mTarget.SetSpeedAndAttitude(mSensor.GetSensor());
-
-            // Attempt to cue the sensor to the target, just in case the sensor is a tracker.
-            mSensor.CueToTarget(mTarget);
-
-            // Perform the detection attempt.
-            /* bool detected = */ mSensor.AttemptToDetect(mTarget, result);
-
-            // get the clutter power
-            double clutterPowerW = result.mClutterPower;
-            double clutterDBW    = UtMath::SafeLinearToDB(clutterPowerW);
+            double clutterDBW  = UtMath::SafeLinearToDB(values[rangeIndex]);
 
             // output to file
             plotOfs << "      range " << groundRange * mRangeUnitsScale << " " << mRangeUnitsStr;
-            const static double sMIN_CLUTTER = -360.0;
-            plotOfs << "  clutter " << std::max(clutterDBW, sMIN_CLUTTER) << " dbw" << std::endl;
+            plotOfs << "  clutter " << std::max(clutterDBW, cMIN_CLUTTER_DBW) << " dbw" << std::endl;
          }
       } // end of range loop
    }    // end of altitude loop
@@ -148,9 +438,69 @@ bool ClutterTableFunction::Execute(WsfSimulation& aSimulation)
    plotOfs << "end_clutter_model" << std::endl;
    plotOfs.close();
 
-   mSimulationPtr->GetSystemLog().WriteOutputLogEntry("Clutter Table", mOutputFileName);
+   mSimulationPtr->GetSystemLog().WriteOutputLogEntry("Clutter Table", aFileName);
+}
 
-   return true;
+//! Write the table in the binary form that can be loaded (memory-mapped) by WSF_SURFACE_CLUTTER_TABLE.
+//! The file is written in the native byte order, every field is 8-byte aligned and has the layout:
+//! - char[8]   "WSFCLUT1"
+//! - uint32    table type (WsfEM_SurfaceClutterTable::Type; cGENERIC or cSITE_SPECIFIC)
+//! - uint32    altitude count
+//! - for each altitude:
+//!   - double  altitude (m)
+//!   - uint32  range count
+//!   - uint32  bearing count (0 for a generic table)
+//!   - double[range count] ranges (m)
+//!   - double[bearing count] bearings (rad)
+//!   - double[max(bearing count, 1) * range count] clutter (W), bearing-major
+void ClutterTableFunction::WriteBinaryTable(const std::string& aFileName, const ClutterRows& aRows)
+{
+   static const char          cMAGIC[8]      = {'W', 'S', 'F', 'C', 'L', 'U', 'T', '1'};
+   static const std::uint32_t cGENERIC       = 2;
+   static const std::uint32_t cSITE_SPECIFIC = 3;
+
+   std::ofstream ofs(aFileName, std::ios::out | std::ios::binary);
+   if (!ofs)
+   {
+      auto out = ut::log::error() << "Unable to open output file.";
+      out.AddNote() << "File: " << aFileName;
+      return;
+   }
+
+   size_t        numBearings = mBearings.size();
+   std::uint32_t header[2]   = {(numBearings > 1) ? cSITE_SPECIFIC : cGENERIC,
+                                static_cast<std::uint32_t>(mEnvelope.size())};
+   ofs.write(cMAGIC, sizeof(cMAGIC));
+   ofs.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+   double minClutter = UtMath::DB_ToLinear(cMIN_CLUTTER_DBW);
+   for (size_t altIndex = 0; altIndex < mEnvelope.size(); ++altIndex)
+   {
+      const PointArray& pointArray = mEnvelope[altIndex];
+      std::uint32_t     counts[2]  = {static_cast<std::uint32_t>(pointArray.data.size()),
+                                      static_cast<std::uint32_t>((numBearings > 1) ? numBearings : 0)};
+      ofs.write(reinterpret_cast<const char*>(&pointArray.altitude), sizeof(double));
+      ofs.write(reinterpret_cast<const char*>(counts), sizeof(counts));
+      for (const Point& point : pointArray.data)
+      {
+         ofs.write(reinterpret_cast<const char*>(&point.range), sizeof(double));
+      }
+      if (numBearings > 1)
+      {
+         ofs.write(reinterpret_cast<const char*>(mBearings.data()), numBearings * sizeof(double));
+      }
+      for (size_t bearingIndex = 0; bearingIndex < numBearings; ++bearingIndex)
+      {
+         for (double clutter : aRows[(altIndex * numBearings) + bearingIndex])
+         {
+            clutter = std::max(clutter, minClutter);
+            ofs.write(reinterpret_cast<const char*>(&clutter), sizeof(double));
+         }
+      }
+   }
+   ofs.close();
+
+   mSimulationPtr->GetSystemLog().WriteOutputLogEntry("Clutter Table", aFileName);
 }
 
 bool ClutterTableFunction::ProcessInput(UtInput& aInput)
@@ -199,6 +549,27 @@ bool ClutterTableFunction::ProcessInput(UtInput& aInput)
       aInput.ReadValueQuoted(mOutputFileName);
       mOutputFileName = aInput.SubstitutePathVariables(mOutputFileName);
    }
+   else if (command == "binary_output_file_name")
+   {
+      aInput.ReadValueQuoted(mBinaryFileName);
+      mBinaryFileName = aInput.SubstitutePathVariables(mBinaryFileName);
+   }
+   else if (command == "checkpoint_file_name")
+   {
+      aInput.ReadValueQuoted(mCheckpointFileName);
+      mCheckpointFileName = aInput.SubstitutePathVariables(mCheckpointFileName);
+   }
+   else if (command == "thread_count")
+   {
+      int threadCount;
+      aInput.ReadValue(threadCount);
+      aInput.ValueGreaterOrEqual(threadCount, 0);
+      mThreadCount = static_cast<unsigned int>(threadCount);
+   }
+   else if (command == "clutter_only")
+   {
+      aInput.ReadValue(mClutterOnly);
+   }
    else if (command == "output_object_name")
    {
       aInput.ReadValue(mOutputObjectName);
@@ -12,12 +12,14 @@
 #ifndef CLUTTERTABLEFUNCTION_HPP
 #define CLUTTERTABLEFUNCTION_HPP
 
+#include <iosfwd>
 #include <string>
 #include <vector>
 
 #include "Function.hpp"
 #include "Sensor.hpp"
 #include "Target.hpp"
+class WsfSensorResult;
 
 class ClutterTableFunction : public Function
 {
@@ -70,8 +72,29 @@ protected:
    void PrintCluttertable(Envelope& aEnvelope);
 
 private:
+   //! The clutter values (W) for each range of one altitude/bearing pair ('row').
+   //! Rows are indexed by (altitude index * number of bearings) + bearing index.
+   using ClutterRows = std::vector<std::vector<double>>;
+
    void ProcessRangeBearingInput(UtInput& aInput, const std::string& aBlockTerminator, PointArray& aRanges);
 
+   void PositionSensor(Sensor& aSensor, double aAltitude);
+
+   double ComputeClutter(Sensor&          aSensor,
+                         Target&          aTarget,
+                         WsfSensorResult& aResult,
+                         size_t           aAltIndex,
+                         size_t           aBearingIndex,
+                         size_t           aRangeIndex);
+
+   bool ComputeClutterOnly(Sensor& aSensor, Target& aTarget, WsfSensorResult& aResult, double& aClutterPower);
+
+   void ReadCheckpoint(ClutterRows& aRows, std::vector<char>& aRowDone);
+   void WriteCheckpointRow(std::ostream& aOut, size_t aRow, const std::vector<double>& aValues);
+
+   void WriteTextTable(const std::string& aFileName, const std::string& aObjectName, const ClutterRows& aRows);
+   void WriteBinaryTable(const std::string& aFileName, const ClutterRows& aRows);
+
    WsfSimulation* mSimulationPtr;
    Envelope       mEnvelope;
    Sensor         mSensor;
@@ -93,6 +116,10 @@ private:
    double              mRangeUnitsScale;
    double              mBearingUnitsScale;
    std::vector<double> mBearings;
+   std::string         mBinaryFileName;
+   std::string         mCheckpointFileName;
+   unsigned int        mThreadCount;
+   bool                mClutterOnly;
 };
 
 #endif
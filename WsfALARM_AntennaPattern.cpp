@@ -12,6 +12,7 @@
 #include "WsfALARM_AntennaPattern.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <fstream>
 #include <memory>
@@ -19,6 +20,7 @@
 
 #include "UtException.hpp"
 #include "UtInput.hpp"
+#include "UtLog.hpp"
 #include "UtMath.hpp"
 #include "WsfEM_Util.hpp"
 #include "WsfScenario.hpp"
@@ -84,6 +86,8 @@ WsfALARM_AntennaPattern::ALARM_Data::ALARM_Data()
    , mWavelength()
    , mInputIs2D(true)
    , mInputIsDB(true)
+   , mCompiledGridSpacing(0.0)
+   , mCompiledGrid()
 {
 }
 
@@ -121,6 +125,11 @@ bool WsfALARM_AntennaPattern::ALARM_Data::ProcessInput(WsfAntennaPattern& aPatte
       aInput.ReadValueOfType(mGainAdjustment, UtInput::cRATIO);
       aInput.ValueGreater(mGainAdjustment, 0.0);
    }
+   else if (command == "compiled_grid_spacing")
+   {
+      aInput.ReadValueOfType(mCompiledGridSpacing, UtInput::cANGLE);
+      aInput.ValueGreaterOrEqual(mCompiledGridSpacing, 0.0);
+   }
    else
    {
       myCommand = WsfAntennaPattern::BaseData::ProcessInput(aPattern, aInput);
@@ -134,6 +143,10 @@ bool WsfALARM_AntennaPattern::ALARM_Data::Initialize(WsfAntennaPattern& aAntenna
    {
       return false;
    }
+   if (!mInitialized)
+   {
+      CompileGrid();
+   }
    return BaseData::Initialize(aAntennaPattern);
    ;
 }
@@ -145,67 +158,199 @@ double WsfALARM_AntennaPattern::ALARM_Data::GetGain(double aFrequency,
                                                     double aEBS_Az,
                                                     double aEBS_El)
 {
-   // If the table is symmetric then change the incoming angles into the proper domain.
-   //
-   // NOTE: SUPPRESSOR had some fabs() values that checked for the min/max values being CLOSE to zero
-   //       while ALARM only checked for zero. In order to eliminate the fabs() calls, Read2D_File() will
-   //       set the min/max value to zero if they are 'close'.
+   if (mCompiledGrid.mValid)
+   {
+      return GetCompiledGain(aFrequency, aTargetAz, aTargetEl);
+   }
 
    PatternData& patternData = mPatternMap[mSetPolarization];
 
-   double azLook = aTargetAz;     // Assume non-symmetric range
-   if (patternData.mAzMin == 0.0) // azimuth range is [0 .. mAzMax]
+   double azLook = FoldAngle(aTargetAz, patternData.mAzMin, patternData.mAzMax);
+   double elLook = FoldAngle(aTargetEl, patternData.mElMin, patternData.mElMax);
+
+   // NOTE: 'mMinimumGain' in the base class and 'mMinGain' in this class have two different functions,
+   //       so don't get them messed up. 'mMinimumGain' is the minimum value that will be RETURNED,
+   //       and 'mMinGain' is a normalized minimum gain that is only used internally.
+
+   double gain = mMinimumGain;
+   if ((azLook >= patternData.mAzMin) && (azLook <= patternData.mAzMax) && (elLook >= patternData.mElMin) &&
+       (elLook <= patternData.mElMax))
+   {
+      gain = GetApertureGain(azLook, elLook);
+      // Un-normalized the gain.
+      gain *= patternData.mPeakGain;
+      // Perform user-specified gain correction/adjustment and lower bound limiting.
+      gain = PerformGainAdjustment(aFrequency, gain);
+   }
+   return gain;
+}
+
+//! If the table is symmetric then change the incoming angle into the proper domain.
+//! @param aAngle    The incoming angle.
+//! @param aMinAngle The minimum angle in the table.
+//! @param aMaxAngle The maximum angle in the table.
+//! @returns The angle to be used to look up the table.
+//! @note SUPPRESSOR had some fabs() values that checked for the min/max values being CLOSE to zero
+//!       while ALARM only checked for zero. In order to eliminate the fabs() calls, Read2D_File() will
+//!       set the min/max value to zero if they are 'close'.
+// static
+double WsfALARM_AntennaPattern::ALARM_Data::FoldAngle(double aAngle, double aMinAngle, double aMaxAngle)
+{
+   double lookAngle = aAngle; // Assume non-symmetric range
+   if (aMinAngle == 0.0)      // range is [0 .. aMaxAngle]
    {
-      azLook = fabs(aTargetAz);
+      lookAngle = fabs(aAngle);
    }
-   else if (patternData.mAzMax == 0.0) // azimuth range is [mAzMin .. 0]
+   else if (aMaxAngle == 0.0) // range is [aMinAngle .. 0]
    {
-      azLook = -fabs(aTargetAz);
+      lookAngle = -fabs(aAngle);
    }
+   return lookAngle;
+}
 
-   double elLook = aTargetEl;     // Assume non-symmetric range
-   if (patternData.mElMin == 0.0) // elevation range is [0 .. mElMax]
+//! Return the normalized gain for the aperture shape at the (folded) look angles.
+//! @note The caller must have already ensured that the angles are within the limits of the tables.
+// protected
+double WsfALARM_AntennaPattern::ALARM_Data::GetApertureGain(double aAzLook, double aElLook)
+{
+   double gain = mMinimumGain;
+   switch (mApertureShape)
    {
-      elLook = fabs(aTargetEl);
+   case cAS_CIRCULAR:
+      gain = GetCircularApertureGain(aAzLook, aElLook);
+      break;
+
+   case cAS_RECTANGULAR:
+      gain = GetRectangularApertureGain(aAzLook, aElLook);
+      break;
+
+   case cAS_ELLIPTICAL:
+      gain = GetEllipticalApertureGain(aAzLook, aElLook);
+      break;
+
+   default:
+      break;
    }
-   else if (patternData.mElMax == 0.0) // elevation range is [mElMax .. 0]
+   return gain;
+}
+
+//! Resample the normalized pattern of the selected polarization onto a uniform grid.
+//! This is done only if 'compiled_grid_spacing' was specified. The largest interpolation error at the
+//! center of the grid cells (relative to the input tables) is reported so the user can choose a spacing.
+// protected
+void WsfALARM_AntennaPattern::ALARM_Data::CompileGrid()
+{
+   // Limit the size of the grid to something reasonable (32 MB).
+   static const size_t cMAX_GRID_POINTS = 8 * 1024 * 1024;
+
+   mCompiledGrid = CompiledGrid();
+   if ((mCompiledGridSpacing <= 0.0) ||
+       ((mApertureShape != cAS_CIRCULAR) && (mApertureShape != cAS_RECTANGULAR) && (mApertureShape != cAS_ELLIPTICAL)))
    {
-      elLook = -fabs(aTargetEl);
+      return;
    }
 
-   // NOTE: 'mMinimumGain' in the base class and 'mMinGain' in this class have two different functions,
-   //       so don't get them messed up. 'mMinimumGain' is the minimum value that will be RETURNED,
-   //       and 'mMinGain' is a normalized minimum gain that is only used internally.
+   const PatternData& patternData = mPatternMap[mSetPolarization];
 
-   double gain = mMinimumGain;
-   if ((azLook >= patternData.mAzMin) && (azLook <= patternData.mAzMax) && (elLook >= patternData.mElMin) &&
-       (elLook <= patternData.mElMax))
+   CompiledGrid grid;
+   grid.mPeakGain = patternData.mPeakGain;
+   grid.mAzMin    = patternData.mAzMin;
+   grid.mAzMax    = patternData.mAzMax;
+   grid.mElMin    = patternData.mElMin;
+   grid.mElMax    = patternData.mElMax;
+
+   double azSpan = grid.mAzMax - grid.mAzMin;
+   double elSpan = grid.mElMax - grid.mElMin;
+   if ((azSpan <= 0.0) || (elSpan <= 0.0))
    {
-      switch (mApertureShape)
+      return;
+   }
+   grid.mAzPoints = static_cast<size_t>(ceil(azSpan / mCompiledGridSpacing)) + 1;
+   grid.mElPoints = static_cast<size_t>(ceil(elSpan / mCompiledGridSpacing)) + 1;
+   if ((grid.mAzPoints * grid.mElPoints) > cMAX_GRID_POINTS)
+   {
+      auto out = ut::log::warning() << "ALARM antenna pattern grid is too large and will not be compiled.";
+      out.AddNote() << "File: " << mFileName;
+      out.AddNote() << "Grid Spacing: " << mCompiledGridSpacing * UtMath::cDEG_PER_RAD << " deg";
+      out.AddNote() << "Grid Points: " << grid.mAzPoints << " x " << grid.mElPoints;
+      return;
+   }
+   grid.mAzScale = static_cast<double>(grid.mAzPoints - 1) / azSpan;
+   grid.mElScale = static_cast<double>(grid.mElPoints - 1) / elSpan;
+
+   grid.mGains.resize(grid.mAzPoints * grid.mElPoints);
+   for (size_t j = 0; j < grid.mElPoints; ++j)
+   {
+      double elLook = std::min(grid.mElMin + j / grid.mElScale, grid.mElMax);
+      float* rowPtr = &grid.mGains[j * grid.mAzPoints];
+      for (size_t i = 0; i < grid.mAzPoints; ++i)
       {
-      case cAS_CIRCULAR:
-         gain = GetCircularApertureGain(azLook, elLook);
-         break;
+         double azLook = std::min(grid.mAzMin + i / grid.mAzScale, grid.mAzMax);
+         rowPtr[i]     = static_cast<float>(GetApertureGain(azLook, elLook));
+      }
+   }
+   grid.mValid = true;
 
-      case cAS_RECTANGULAR:
-         gain = GetRectangularApertureGain(azLook, elLook);
-         break;
+   // Determine the accuracy at the point of each cell that is furthest from the samples.
+   double minGain = std::max(mMinGain, 1.0E-30);
+   for (size_t j = 0; (j + 1) < grid.mElPoints; ++j)
+   {
+      double elLook = grid.mElMin + (j + 0.5) / grid.mElScale;
+      for (size_t i = 0; (i + 1) < grid.mAzPoints; ++i)
+      {
+         double azLook    = grid.mAzMin + (i + 0.5) / grid.mAzScale;
+         double exactGain = std::max(GetApertureGain(azLook, elLook), minGain);
+         double gridGain  = std::max(grid.Interpolate(azLook, elLook), minGain);
+         grid.mMaxErrorDB = std::max(grid.mMaxErrorDB, fabs(UtMath::LinearToDB(gridGain / exactGain)));
+      }
+   }
 
-      case cAS_ELLIPTICAL:
-         gain = GetEllipticalApertureGain(azLook, elLook);
-         break;
+   auto out = ut::log::info() << "Compiled ALARM antenna pattern.";
+   out.AddNote() << "File: " << mFileName;
+   out.AddNote() << "Polarization: " << WsfEM_Util::EnumToString(mSetPolarization);
+   out.AddNote() << "Grid Spacing: " << mCompiledGridSpacing * UtMath::cDEG_PER_RAD << " deg";
+   out.AddNote() << "Grid Points: " << grid.mAzPoints << " x " << grid.mElPoints;
+   out.AddNote() << "Maximum Error: " << grid.mMaxErrorDB << " dB";
 
-      default:
-         break;
-      }
-      // Un-normalized the gain.
-      gain *= patternData.mPeakGain;
-      // Perform user-specified gain correction/adjustment and lower bound limiting.
+   mCompiledGrid = std::move(grid);
+}
+
+//! The equivalent of GetGain using the compiled grid.
+// protected
+double WsfALARM_AntennaPattern::ALARM_Data::GetCompiledGain(double aFrequency, double aTargetAz, double aTargetEl)
+{
+   const CompiledGrid& grid = mCompiledGrid;
+
+   double azLook = FoldAngle(aTargetAz, grid.mAzMin, grid.mAzMax);
+   double elLook = FoldAngle(aTargetEl, grid.mElMin, grid.mElMax);
+
+   double gain = mMinimumGain;
+   if ((azLook >= grid.mAzMin) && (azLook <= grid.mAzMax) && (elLook >= grid.mElMin) && (elLook <= grid.mElMax))
+   {
+      gain = grid.Interpolate(azLook, elLook) * grid.mPeakGain;
       gain = PerformGainAdjustment(aFrequency, gain);
    }
    return gain;
 }
 
+//! Return the bilinearly interpolated normalized gain at the (folded) look angles.
+//! @note The caller must have already ensured that the angles are within the limits of the grid.
+double WsfALARM_AntennaPattern::ALARM_Data::CompiledGrid::Interpolate(double aAzLook, double aElLook) const
+{
+   double x = (aAzLook - mAzMin) * mAzScale;
+   double y = (aElLook - mElMin) * mElScale;
+   size_t i = std::min(static_cast<size_t>(x), mAzPoints - 2);
+   size_t j = std::min(static_cast<size_t>(y), mElPoints - 2);
+   double u = x - static_cast<double>(i);
+   double v = y - static_cast<double>(j);
+
+   const float* lowerPtr = &mGains[(j * mAzPoints) + i];
+   const float* upperPtr = lowerPtr + mAzPoints;
+   double       lower    = lowerPtr[0] + u * (lowerPtr[1] - lowerPtr[0]);
+   double       upper    = upperPtr[0] + u * (upperPtr[1] - upperPtr[0]);
+   return lower + v * (upper - lower);
+}
+
 //! Perform common initialization for derived classes.
 bool WsfALARM_AntennaPattern::ALARM_Data::InitializeBase()
 {
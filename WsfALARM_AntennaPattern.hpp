@@ -97,6 +97,27 @@ public:
       };
       using PatternMap = std::map<WsfEM_Types::Polarization, PatternData>;
 
+      //! The normalized pattern of the selected polarization resampled onto a uniform azimuth/elevation
+      //! grid (see 'compiled_grid_spacing'). Lookups are direct index computations followed by bilinear
+      //! interpolation rather than binary searches of the input tables.
+      struct CompiledGrid
+      {
+         double Interpolate(double aAzLook, double aElLook) const;
+
+         bool               mValid{false};
+         double             mPeakGain{0.0};
+         double             mAzMin{0.0};
+         double             mAzMax{0.0};
+         double             mElMin{0.0};
+         double             mElMax{0.0};
+         double             mAzScale{0.0};    //!< Azimuth grid points per radian
+         double             mElScale{0.0};    //!< Elevation grid points per radian
+         size_t             mAzPoints{0};
+         size_t             mElPoints{0};
+         std::vector<float> mGains;           //!< Normalized gains, indexed [el * mAzPoints + az]
+         double             mMaxErrorDB{0.0}; //!< Largest error (dB) at the cell centers w.r.t. the input tables
+      };
+
       ALARM_Data();
       ~ALARM_Data() override = default;
       ;
@@ -132,9 +153,20 @@ public:
       bool mInputIs2D;
       bool mInputIsDB;
 
+      //! The spacing of the compiled grid (radians). Zero if the pattern is not to be compiled.
+      double       mCompiledGridSpacing;
+      CompiledGrid mCompiledGrid;
+
    protected:
       std::vector<double>::size_type GetIndex(const std::vector<double>& aTable, double aValue) const;
 
+      static double FoldAngle(double aAngle, double aMinAngle, double aMaxAngle);
+
+      void   CompileGrid();
+      double GetCompiledGain(double aFrequency, double aTargetAz, double aTargetEl);
+
+      double GetApertureGain(double aAzLook, double aElLook);
+
       double GetCircularApertureGain(double aAzLook, double aElLook);
       double GetEllipticalApertureGain(double aAzLook, double aElLook);
       double GetRectangularApertureGain(double aAzLook, double aElLook);
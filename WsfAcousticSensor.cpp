@@ -33,6 +33,8 @@
 #include <cmath>
 #include <complex>
 #include <iostream>
+#include <map>
+#include <mutex>
 
 #include "UtEllipsoidalEarth.hpp"
 #include "UtInput.hpp"
@@ -54,6 +56,7 @@
 #include "WsfSensorObserver.hpp"
 #include "WsfSensorResult.hpp"
 #include "WsfSimulation.hpp"
+#include "WsfSimulationExtension.hpp"
 #include "WsfStandardAcousticSignature.hpp"
 #include "WsfTerrain.hpp"
 #include "WsfUtil.hpp"
@@ -177,10 +180,97 @@ struct WsfAcousticSensor::SharedData : public UtReferenceCounted
 
       mBackgroundNoise.InitializeType();
    }
+
    WsfStandardAcousticSignature mHumanHearingThreshold;
    WsfStandardAcousticSignature mBackgroundNoise;
 };
 
+//! Target source pressures evaluated at the current time, shared by all of the acoustic sensors in a
+//! simulation so each target's signature is evaluated once per time step rather than once per sensor.
+//! The signature is sampled without a Doppler shift at the nodes of a fixed logarithmic frequency grid.
+//! Each sensor interpolates the samples at its own Doppler shifted frequencies, so sensors with different
+//! Doppler coefficients share the same samples.
+class WsfAcousticSensor::SourceSpectrumCache : public WsfSimulationExtension
+{
+public:
+   //! Return the cache for the simulation, creating it if necessary.
+   //! @note This must not be called concurrently (it is intended to be called during initialization).
+   static SourceSpectrumCache& FindOrCreate(WsfSimulation& aSimulation)
+   {
+      static const char* cEXTENSION_NAME = "wsf_acoustic_source_spectra";
+
+      auto cachePtr = static_cast<SourceSpectrumCache*>(aSimulation.FindExtension(cEXTENSION_NAME));
+      if (cachePtr == nullptr)
+      {
+         auto newCachePtr = ut::make_unique<SourceSpectrumCache>();
+         cachePtr         = newCachePtr.get();
+         aSimulation.RegisterExtension(cEXTENSION_NAME, std::move(newCachePtr));
+      }
+      return *cachePtr;
+   }
+
+   SourceSpectrumCache()
+      : WsfSimulationExtension()
+      , mSamples()
+      , mTime(-1.0)
+      , mMutex()
+   {
+   }
+
+   //! Find the source pressure of a target evaluated at the current time at a grid node.
+   //! @param aTargetIndex The platform index of the target.
+   //! @param aSimTime     The current simulation time.
+   //! @param aStep        The natural log of the ratio between adjacent grid frequencies.
+   //! @param aNode        The integer index of the grid node (the frequency is exp(aNode * aStep)).
+   //! @param aPressure    [output] The source pressure.
+   bool Find(size_t aTargetIndex, double aSimTime, double aStep, double aNode, double& aPressure)
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      if (aSimTime == mTime)
+      {
+         auto targetIter = mSamples.find(aTargetIndex);
+         if (targetIter != mSamples.end())
+         {
+            auto iter = targetIter->second.find(Node(aStep, aNode));
+            if (iter != targetIter->second.end())
+            {
+               aPressure = iter->second;
+               return true;
+            }
+         }
+      }
+      return false;
+   }
+
+   //! Save the source pressure of a target at a grid node. Samples from an earlier time are discarded.
+   void Insert(size_t aTargetIndex, double aSimTime, double aStep, double aNode, double aPressure)
+   {
+      static const size_t cMAX_SAMPLES_PER_TARGET = 4096;
+
+      std::lock_guard<std::mutex> lock(mMutex);
+      if (aSimTime != mTime)
+      {
+         mSamples.clear();
+         mTime = aSimTime;
+      }
+      std::map<Node, double>& samples = mSamples[aTargetIndex];
+      if (samples.size() >= cMAX_SAMPLES_PER_TARGET)
+      {
+         samples.clear();
+      }
+      samples[Node(aStep, aNode)] = aPressure;
+   }
+
+private:
+   //! A grid node, identified by the grid step and the node index.
+   using Node = std::pair<double, double>;
+
+   //! Source pressure samples (by target platform index) evaluated at mTime.
+   std::map<size_t, std::map<Node, double>> mSamples;
+   double                                   mTime;
+   std::mutex                               mMutex;
+};
+
 WsfAcousticSensor::WsfAcousticSensor(WsfScenario& aScenario)
    : WsfSensor(aScenario)
    , mAcousticModeList()
@@ -223,17 +313,6 @@ bool WsfAcousticSensor::Initialize(double aSimTime)
    // Reduce future dynamic casting by extracting derived class mode pointers.
    mModeListPtr->GetDerivedModeList(mAcousticModeList);
 
-   unsigned int i;
-
-   // if threshold pointer is not defined, set it to human hearing
-   for (i = 0; i < mAcousticModeList.size(); ++i)
-   {
-      if (mAcousticModeList[i]->mThresholdPtr == nullptr)
-      {
-         mAcousticModeList[i]->mThresholdPtr = &mSharePtr->mHumanHearingThreshold;
-      }
-   }
-
    return ok;
 }
 
@@ -274,6 +353,10 @@ WsfAcousticSensor::AcousticMode::AcousticMode(WsfScenario& aScenario)
    , mAtmosphere(aScenario.GetAtmosphere())
    , mSensorType(cACOUSTIC_HUMAN)
    , mEffectiveFilterBandwidth()
+   , mFilteredBackgroundDB()
+   , mThresholdDB()
+   , mSourceDopplerTolerance(0.0)
+   , mSourceSpectraPtr(nullptr)
    , mThresholdPtr(nullptr)
    , cDEFAULT_ID("default")
    , mBackgroundNoiseStateId("default")
@@ -291,6 +374,10 @@ WsfAcousticSensor::AcousticMode::AcousticMode(const AcousticMode& aSrc)
    , mAtmosphere(aSrc.mAtmosphere)
    , mSensorType(aSrc.mSensorType)
    , mEffectiveFilterBandwidth(aSrc.mEffectiveFilterBandwidth)
+   , mFilteredBackgroundDB(aSrc.mFilteredBackgroundDB)
+   , mThresholdDB(aSrc.mThresholdDB)
+   , mSourceDopplerTolerance(aSrc.mSourceDopplerTolerance)
+   , mSourceSpectraPtr(nullptr)
    , mThresholdPtr(aSrc.mThresholdPtr)
    , cDEFAULT_ID("default")
    , mBackgroundNoiseStateId(aSrc.mBackgroundNoiseStateId)
@@ -322,6 +409,11 @@ bool WsfAcousticSensor::AcousticMode::Initialize(double aSimTime)
    mRcvr.SetFrequency(1.0);
    ok &= mRcvr.Initialize(*mSensorPtr->GetSimulation());
 
+   if (mSourceDopplerTolerance > 0.0)
+   {
+      mSourceSpectraPtr = &SourceSpectrumCache::FindOrCreate(*mSensorPtr->GetSimulation());
+   }
+
    // Set the debug flags
    mRcvr.SetDebugEnabled(GetSensor()->DebugEnabled());
 
@@ -364,6 +456,38 @@ bool WsfAcousticSensor::AcousticMode::Initialize(double aSimTime)
    //   TODO
    //}
 
+   // if threshold pointer is not defined, set it to human hearing
+   WsfAcousticSensor* sensorPtr = dynamic_cast<WsfAcousticSensor*>(GetSensor());
+   if (mThresholdPtr == nullptr)
+   {
+      mThresholdPtr = &sensorPtr->mSharePtr->mHumanHearingThreshold;
+   }
+
+   // The background noise and threshold do not depend on the target, so compute them once for each band.
+   double background[24];
+   for (int band = 0; band < GetCenterFreqSize(); ++band)
+   {
+      background[band] =
+         sensorPtr->mSharePtr->mBackgroundNoise.GetNoisePressure(mBackgroundNoiseStateId, GetCenterFreq(band));
+   }
+
+   mFilteredBackgroundDB.resize(GetCenterFreqSize());
+   mThresholdDB.resize(GetCenterFreqSize());
+   for (int band = 0; band < GetCenterFreqSize(); ++band)
+   {
+      // compute filtered background noise
+      double filteredBackground   = ApplyFilterWeighting(band, background);
+      double filteredBackgroundDB = 10.0 * log10(filteredBackground);
+
+      // adjust background for Pd and false alarm rate
+      filteredBackgroundDB += 10.0 * log10(2.32 / 0.4 / sqrt(mEffectiveFilterBandwidth[band]));
+      mFilteredBackgroundDB[band] = filteredBackgroundDB;
+
+      // get sensing threshold
+      double threshold   = mThresholdPtr->GetNoisePressure(cDEFAULT_ID, GetCenterFreq(band));
+      mThresholdDB[band] = 10.0 * log10(threshold);
+   }
+
    return ok;
 }
 
@@ -390,6 +514,11 @@ bool WsfAcousticSensor::AcousticMode::ProcessInput(UtInput& aInput)
    {
       mVerbose = true;
    }
+   else if (command == "source_doppler_tolerance")
+   {
+      aInput.ReadValue(mSourceDopplerTolerance);
+      aInput.ValueGreaterOrEqual(mSourceDopplerTolerance, 0.0);
+   }
    else if (command == "background_noise")
    {
       std::string type;
@@ -482,19 +611,31 @@ bool WsfAcousticSensor::AcousticMode::AttemptToDetect(double           aSimTime,
          return false;
       }
 
+      // Evaluate the target terms for all of the 1/3-octave bands at once. The geometry and atmosphere
+      // are common to every band, and each band's source pressure is used by up to 5 filters.
+      // The background noise and threshold terms are computed by Initialize.
+      double sourcePressure[24];
+      GetSourcePressure(aSimTime, aTargetPtr, dopplerEffect, sourcePressure);
+
+      double atmosphericAttenuation[24];
+      AtmosphericAttenuation(aResult, atmosphericAttenuation);
+
+      double groundEffect[24];
+      GroundEffectAttenuation(&aResult, groundEffect);
+
       // Loop over the 1/3-octave band frequencies to compute S/N for each
       // frequency
       for (int band = 0; band < GetCenterFreqSize(); ++band)
       {
          // compute auditory filter band level
-         double filteredSource   = ApplyFilterWeighting(band, aTargetPtr, 1, dopplerEffect);
+         double filteredSource   = ApplyFilterWeighting(band, sourcePressure);
          double filteredSourceDB = 10.0 * log10(filteredSource);
 
          // compute atmospheric attenuation for frequency
-         double attenuationDB = AtmosphericAttenuation(aResult, GetCenterFreq(band)) * aResult.mRcvrToTgt.mRange * 0.01;
+         double attenuationDB = atmosphericAttenuation[band] * aResult.mRcvrToTgt.mRange * 0.01;
 
          // determine ground effect
-         double groundEffectDB = GroundEffectAttenuation(&aResult, GetCenterFreq(band), band);
+         double groundEffectDB = groundEffect[band];
          if (aResult.CategoryIsSet())
          {
             double aZoneAttenuation = (std::max(0.0, 1.0 - aResult.mZoneAttenuationValue));
@@ -504,15 +645,8 @@ bool WsfAcousticSensor::AcousticMode::AttemptToDetect(double           aSimTime,
          // determine noise pressure @ receiver
          double receivedPressureDB = filteredSourceDB + groundEffectDB - attenuationDB - propagationDB;
 
-         // compute filtered background noise
-         double filteredBackground   = ApplyFilterWeighting(band);
-         double filteredBackgroundDB = 10.0 * log10(filteredBackground);
-
-         // adjust background for Pd and false alarm rate
-         filteredBackgroundDB += 10.0 * log10(2.32 / 0.4 / sqrt(mEffectiveFilterBandwidth[band]));
-         // get sensing threshold
-         double threshold   = mThresholdPtr->GetNoisePressure(cDEFAULT_ID, GetCenterFreq(band));
-         double thresholdDB = 10.0 * log10(threshold);
+         double filteredBackgroundDB = mFilteredBackgroundDB[band];
+         double thresholdDB          = mThresholdDB[band];
 
          if ((receivedPressureDB > filteredBackgroundDB) && (receivedPressureDB > thresholdDB))
          {
@@ -577,16 +711,11 @@ bool WsfAcousticSensor::AcousticMode::AttemptToDetect(double           aSimTime,
 
 //! Computes the filtered weights to account for human hearing
 //! @param aIndex The 1/3 octave band frequency index
-//! @param aTargetPtr A pointer to the target platform
-//! @param aFlag = 1 if target signature, 0 if background
-//! @param aDoppler Doppler shift frequency adjustment
+//! @param aPressure The pressure (target signature or background) at each 1/3 octave band frequency
 //! @returns The 1/3 octave frequency weighting factor (Ref 3)
-double WsfAcousticSensor::AcousticMode::ApplyFilterWeighting(int          aIndex,
-                                                             WsfPlatform* aTargetPtr,
-                                                             const int    aFlag,
-                                                             const double aDoppler)
+double WsfAcousticSensor::AcousticMode::ApplyFilterWeighting(int aIndex, const double aPressure[24])
 {
-   const double Weight[5][24] = {{0.0, 0.0, 0.3048, 0.1521, 0.07568, 0.03776, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+   static const double Weight[5][24] = {{0.0, 0.0, 0.3048, 0.1521, 0.07568, 0.03776, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
                                   0.0, 0.0, 0.0,    0.0,    0.0,     0.0,     0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
 
                                  {0.0,    0.5333, 0.4355,  0.3565, 0.2917, 0.2388, 0.1950, 0.1596,
@@ -609,22 +738,52 @@ double WsfAcousticSensor::AcousticMode::ApplyFilterWeighting(int          aIndex
    double level = 0.0;
    for (int i = -lowerOffset; i < (upperOffset + 1); ++i)
    {
-      double pressure = 0.0;
-      if (aFlag == 1)
+      level += aPressure[aIndex + i] * Weight[i + 2][aIndex];
+   }
+
+   return level;
+}
+
+//! Gets the target's source pressure at each Doppler shifted 1/3 octave band frequency.
+//! If mSourceDopplerTolerance is not zero the pressure is interpolated (linearly in log frequency) between
+//! samples of the unshifted signature taken at frequencies a factor of (1 + mSourceDopplerTolerance) apart.
+//! The samples are shared with the other acoustic sensors in the simulation evaluating the same target at
+//! the same time.
+//! @param aSimTime The current simulation time
+//! @param aTargetPtr A pointer to the target platform
+//! @param aDoppler Doppler shift frequency adjustment
+//! @param aPressure [output] The source pressure at each 1/3 octave band frequency
+void WsfAcousticSensor::AcousticMode::GetSourcePressure(double       aSimTime,
+                                                        WsfPlatform* aTargetPtr,
+                                                        double       aDoppler,
+                                                        double       aPressure[24])
+{
+   if (mSourceSpectraPtr == nullptr)
+   {
+      for (int band = 0; band < GetCenterFreqSize(); ++band)
       {
-         double freq = GetCenterFreq(aIndex + i) * aDoppler;
-         pressure    = WsfAcousticSignature::GetValue(aTargetPtr, freq);
+         aPressure[band] = WsfAcousticSignature::GetValue(aTargetPtr, GetCenterFreq(band) * aDoppler);
       }
-      else
+      return;
+   }
+
+   size_t targetIndex = aTargetPtr->GetIndex();
+   double step        = log1p(mSourceDopplerTolerance);
+   for (int band = 0; band < GetCenterFreqSize(); ++band)
+   {
+      double x    = log(GetCenterFreq(band) * aDoppler) / step;
+      double node = floor(x);
+      double pressure[2];
+      for (int i = 0; i < 2; ++i)
       {
-         pressure = dynamic_cast<WsfAcousticSensor*>(GetSensor())
-                       ->mSharePtr->mBackgroundNoise.GetNoisePressure(mBackgroundNoiseStateId, GetCenterFreq(aIndex + i));
+         if (!mSourceSpectraPtr->Find(targetIndex, aSimTime, step, node + i, pressure[i]))
+         {
+            pressure[i] = WsfAcousticSignature::GetValue(aTargetPtr, exp((node + i) * step));
+            mSourceSpectraPtr->Insert(targetIndex, aSimTime, step, node + i, pressure[i]);
+         }
       }
-
-      level += pressure * Weight[i + 2][aIndex];
+      aPressure[band] = pressure[0] + (x - node) * (pressure[1] - pressure[0]);
    }
-
-   return level;
 }
 
 // virtual
@@ -640,12 +799,11 @@ void WsfAcousticSensor::AcousticMode::Select(double aSimTime)
    mRcvr.Activate();
 }
 
-//! Compute the atmospheric attenuation for the current interaction.
-//! and frequency
+//! Compute the atmospheric attenuation for the current interaction
+//! at each 1/3 octave band center frequency.
 //! @param aResult The current interaction data.
-//! @param aFreq The current center band frequency
-//! @returns The atmospheric attenuation in dB / 100m (Ref 2)
-double WsfAcousticSensor::AcousticMode::AtmosphericAttenuation(const WsfSensorResult& aResult, double aFreq)
+//! @param aAttenuation [output] The atmospheric attenuation in dB / 100m for each band (Ref 2)
+void WsfAcousticSensor::AcousticMode::AtmosphericAttenuation(const WsfSensorResult& aResult, double aAttenuation[24])
 {
    // determine atmospheric values that will be needed
    // use the mid-point altitude to determine values
@@ -666,13 +824,15 @@ double WsfAcousticSensor::AcousticMode::AtmosphericAttenuation(const WsfSensorRe
    double mc_f2 = 2.152e-12 * sqrt(temp) / pressRatio;
 
    // calculate terms that are frequency dependent
-   double moPrime = 2.0 * muo_a * aFreq / (aFreq / fro + fro / aFreq);
-   double mnPrime = 2.0 * mun_a * aFreq / (aFreq / frn + frn / aFreq);
-   double mc      = mc_f2 * pow(aFreq, 2.0);
-
-   double attenuation = 434.3 * (moPrime + mnPrime + mc);
+   for (int band = 0; band < GetCenterFreqSize(); ++band)
+   {
+      double freq    = GetCenterFreq(band);
+      double moPrime = 2.0 * muo_a * freq / (freq / fro + fro / freq);
+      double mnPrime = 2.0 * mun_a * freq / (freq / frn + frn / freq);
+      double mc      = mc_f2 * pow(freq, 2.0);
 
-   return attenuation;
+      aAttenuation[band] = 434.3 * (moPrime + mnPrime + mc);
+   }
 }
 
 
@@ -753,17 +913,11 @@ double WsfAcousticSensor::AcousticMode::ComputeProbabilityOfDetection(double aSi
 
 
 //! Computes the sound attenuation due to ground effect
+//! at each 1/3 octave band center frequency.
 //! @param aResultPtr Pointer to the current interaction data.
-//! @param aFreq  The current 1/3 octave band center frequency
-//! @param aIndex The current 1/3 octave band center frequency index
-//!
-//! @returns The ground effect attenuation [0, unknown] (Ref 1)
-double WsfAcousticSensor::AcousticMode::GroundEffectAttenuation(WsfSensorResult* aResultPtr,
-                                                                const double     aFreq,
-                                                                const int        aIndex)
+//! @param aGroundEffect [output] The ground effect attenuation [0, unknown] for each band (Ref 1)
+void WsfAcousticSensor::AcousticMode::GroundEffectAttenuation(WsfSensorResult* aResultPtr, double aGroundEffect[24])
 {
-   double returnValue = 1.0;
-
    // compute angle of incidence of reflected path and slant range
    // from target to reflection point
    double incidenceAngle       = 0.0;
@@ -776,7 +930,7 @@ double WsfAcousticSensor::AcousticMode::GroundEffectAttenuation(WsfSensorResult*
    // account for any ground effect
    if (incidenceAngle > (5.0 * UtMath::cRAD_PER_DEG))
    {
-      returnValue = 1.0;
+      std::fill(aGroundEffect, aGroundEffect + GetCenterFreqSize(), 1.0);
    }
    else
    {
@@ -789,18 +943,7 @@ double WsfAcousticSensor::AcousticMode::GroundEffectAttenuation(WsfSensorResult*
       double atmosAlt = 0.5 * (aResultPtr->mTgtLoc.mAlt + aResultPtr->mRcvrLoc.mAlt);
       double sonicVel = mAtmosphere.SonicVelocity(atmosAlt);
 
-      // compute turbulence effects: aCoherenceFunction
       const double TURBULENCE_SCALE_PARAMETER = 1.1; // Ref 1
-      double       betaDriver                 = sonicVel * groundRange / aFreq;
-      double       beta                       = 0.0;
-      if (sqrt(betaDriver) > TURBULENCE_SCALE_PARAMETER)
-      {
-         beta = 0.5;
-      }
-      else
-      {
-         beta = 1.0;
-      }
 
       // set fluctuating index of refraction per Ref 1
       // if perfectly still = 0;
@@ -809,9 +952,6 @@ double WsfAcousticSensor::AcousticMode::GroundEffectAttenuation(WsfSensorResult*
       // if turbulent = 1e-6
       // for now, assume turbulent atmosphere
       const double REFRACTION_INDEX = 1.0e-6;
-      double       aP =
-         REFRACTION_INDEX * pow((aFreq / sonicVel), 2.0) * groundRange * TURBULENCE_SCALE_PARAMETER * sqrt(UtMath::cPI);
-      double coherenceFunction = exp(-0.2 * beta * aP);
 
       // compute ground impedance Z (complex value)
       // effective flow resistivity & inverse effect depth of surface layer
@@ -845,69 +985,91 @@ double WsfAcousticSensor::AcousticMode::GroundEffectAttenuation(WsfSensorResult*
          inverseDepth    = 32.5;   // Ref 1 lists 20 - 45 1/m
       }
       double rho          = mAtmosphere.Density(reflectionLoc[2]);
-      double zReal        = sqrt(flowResistivity / UtAtmosphere::cGAMMA / UtMath::cPI / rho / aFreq);
       double sonicVelRefl = mAtmosphere.SonicVelocity(reflectionLoc[2]);
-      double zImag        = zReal + sonicVelRefl * inverseDepth * 0.2 / UtAtmosphere::cGAMMA / UtMath::cPI / aFreq;
-      std::complex<double> aZ(zReal, zImag);
 
-      // compute sound pressure reflection coefficient
-      std::complex<double> reflectionCoefficient = (sin(incidenceAngle) - (1.0 / aZ)) / (sin(incidenceAngle) + (1.0 / aZ));
-
-      // compute "numerical distance"
-      double lambdaRefl = sonicVelRefl / aFreq;
-      double imag       = 0.5 * (2.0 * UtMath::cPI / lambdaRefl * reflectionSlantRange);
-      imag *= pow(std::abs(std::complex<double>(sin(incidenceAngle)) + std::complex<double>(1.0) / aZ), 2.0);
-      std::complex<double> numericalDistance(0.0, imag);
+      double slantRange = aResultPtr->mTgtToRcvr.mRange;
+      double phaseAngle = aResultPtr->mTgtToRcvr.mAz;
 
-      // compute zeta and eta: need frequency span of 1/3 octave band
-      double deltaFreq = 0.0;
-      if (aIndex == 0)
-      {
-         deltaFreq = 13.0;
-      }
-      else if (aIndex == (GetCenterFreqSize() - 1))
-      {
-         deltaFreq = 4.8e3;
-      }
-      else
+      for (int band = 0; band < GetCenterFreqSize(); ++band)
       {
-         deltaFreq = GetCenterFreq(aIndex + 1) - GetCenterFreq(aIndex - 1);
-      }
-      double zeta = UtMath::cPI * deltaFreq / aFreq;
-      double eta  = 2 * UtMath::cPI * sqrt(1 + pow((deltaFreq * 0.5 / aFreq), 2.0));
+         double freq = GetCenterFreq(band);
 
-      // compute boundary loss factor
-      std::complex<double> boundaryLoss(0.0, 0.0);
-      if (std::abs(numericalDistance) < 10.0)
-      {
-         boundaryLoss +=
-            std::complex<double>(1.0) +
-            sqrt(std::complex<double>(UtMath::cPI) * numericalDistance) * exp(-numericalDistance) -
-            std::complex<double>(2.0) * numericalDistance *
-               (1.0 + numericalDistance / 3.0 + pow(numericalDistance, 2.0) / 10.0 + pow(numericalDistance, 3.0) / 43.0) *
-               exp(-numericalDistance);
-      }
-      else
-      {
-         boundaryLoss += -(0.5 / numericalDistance + 3.0 / pow((2.0 * numericalDistance), 2.0) +
-                           3.0 * 5.0 / pow((2.0 * numericalDistance), 3.0));
-      }
+         // compute turbulence effects: aCoherenceFunction
+         double betaDriver = sonicVel * groundRange / freq;
+         double beta       = 0.0;
+         if (sqrt(betaDriver) > TURBULENCE_SCALE_PARAMETER)
+         {
+            beta = 0.5;
+         }
+         else
+         {
+            beta = 1.0;
+         }
 
-      // compute relative image source strength
-      std::complex<double> aQ = (0.0);
-      aQ += reflectionCoefficient + boundaryLoss * (std::complex<double>(1.0) - reflectionCoefficient);
+         double aP = REFRACTION_INDEX * pow((freq / sonicVel), 2.0) * groundRange * TURBULENCE_SCALE_PARAMETER *
+                     sqrt(UtMath::cPI);
+         double coherenceFunction = exp(-0.2 * beta * aP);
 
-      // compute return value
-      double slantRange = aResultPtr->mTgtToRcvr.mRange;
-      double phaseAngle = aResultPtr->mTgtToRcvr.mAz;
-      returnValue       = 1.0 + pow((rPrime * std::abs(aQ)), 2.0) +
-                    2 * rPrime * coherenceFunction * std::abs(aQ) *
-                       (lambdaRefl / zeta / (slantRange - reflectionSlantRange)) *
-                       sin(zeta * (reflectionSlantRange - slantRange) / lambdaRefl) *
-                       cos(eta * (reflectionSlantRange - slantRange) / lambdaRefl + phaseAngle);
-   }
+         double zReal = sqrt(flowResistivity / UtAtmosphere::cGAMMA / UtMath::cPI / rho / freq);
+         double zImag = zReal + sonicVelRefl * inverseDepth * 0.2 / UtAtmosphere::cGAMMA / UtMath::cPI / freq;
+         std::complex<double> aZ(zReal, zImag);
+
+         // compute sound pressure reflection coefficient
+         std::complex<double> reflectionCoefficient =
+            (sin(incidenceAngle) - (1.0 / aZ)) / (sin(incidenceAngle) + (1.0 / aZ));
+
+         // compute "numerical distance"
+         double lambdaRefl = sonicVelRefl / freq;
+         double imag       = 0.5 * (2.0 * UtMath::cPI / lambdaRefl * reflectionSlantRange);
+         imag *= pow(std::abs(std::complex<double>(sin(incidenceAngle)) + std::complex<double>(1.0) / aZ), 2.0);
+         std::complex<double> numericalDistance(0.0, imag);
 
-   return returnValue;
+         // compute zeta and eta: need frequency span of 1/3 octave band
+         double deltaFreq = 0.0;
+         if (band == 0)
+         {
+            deltaFreq = 13.0;
+         }
+         else if (band == (GetCenterFreqSize() - 1))
+         {
+            deltaFreq = 4.8e3;
+         }
+         else
+         {
+            deltaFreq = GetCenterFreq(band + 1) - GetCenterFreq(band - 1);
+         }
+         double zeta = UtMath::cPI * deltaFreq / freq;
+         double eta  = 2 * UtMath::cPI * sqrt(1 + pow((deltaFreq * 0.5 / freq), 2.0));
+
+         // compute boundary loss factor
+         std::complex<double> boundaryLoss(0.0, 0.0);
+         if (std::abs(numericalDistance) < 10.0)
+         {
+            boundaryLoss += std::complex<double>(1.0) +
+                            sqrt(std::complex<double>(UtMath::cPI) * numericalDistance) * exp(-numericalDistance) -
+                            std::complex<double>(2.0) * numericalDistance *
+                               (1.0 + numericalDistance / 3.0 + pow(numericalDistance, 2.0) / 10.0 +
+                                pow(numericalDistance, 3.0) / 43.0) *
+                               exp(-numericalDistance);
+         }
+         else
+         {
+            boundaryLoss += -(0.5 / numericalDistance + 3.0 / pow((2.0 * numericalDistance), 2.0) +
+                              3.0 * 5.0 / pow((2.0 * numericalDistance), 3.0));
+         }
+
+         // compute relative image source strength
+         std::complex<double> aQ = (0.0);
+         aQ += reflectionCoefficient + boundaryLoss * (std::complex<double>(1.0) - reflectionCoefficient);
+
+         // compute return value
+         aGroundEffect[band] = 1.0 + pow((rPrime * std::abs(aQ)), 2.0) +
+                               2 * rPrime * coherenceFunction * std::abs(aQ) *
+                                  (lambdaRefl / zeta / (slantRange - reflectionSlantRange)) *
+                                  sin(zeta * (reflectionSlantRange - slantRange) / lambdaRefl) *
+                                  cos(eta * (reflectionSlantRange - slantRange) / lambdaRefl + phaseAngle);
+      }
+   }
 }
 
 
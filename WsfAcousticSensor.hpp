@@ -65,6 +65,8 @@ protected:
    // vector defining standard 1/3-octave band center frequency
    static const double mCenterFrequency[24];
 
+   class SourceSpectrumCache;
+
    //! A mode of the sensor.
    class AcousticMode : public WsfSensorMode
    {
@@ -82,20 +84,19 @@ protected:
       void Deselect(double aSimTime) override;
       void Select(double aSimTime) override;
 
-      double ApplyFilterWeighting(int          aBand,
-                                  WsfPlatform* aTargetPtr = nullptr,
-                                  const int    aFlag      = 0,
-                                  const double aDoppler   = 0.0);
+      double ApplyFilterWeighting(int aBand, const double aPressure[24]);
+
+      void GetSourcePressure(double aSimTime, WsfPlatform* aTargetPtr, double aDoppler, double aPressure[24]);
 
       double ComputeDopplerTerm(const WsfSensorResult& aResult);
 
       void ComputeIncidenceAngle(WsfSensorResult* aResultPtr, double& aAngle, double& aRange, double* aLoc);
 
-      double AtmosphericAttenuation(const WsfSensorResult& aResult, double aFreq);
+      void AtmosphericAttenuation(const WsfSensorResult& aResult, double aAttenuation[24]);
 
       double ComputeProbabilityOfDetection(double aSignal, double aNoise, double aThreshold);
 
-      double GroundEffectAttenuation(WsfSensorResult* aResult, const double aFreq, const int aBandIndex);
+      void GroundEffectAttenuation(WsfSensorResult* aResult, double aGroundEffect[24]);
 
       WsfEM_Antenna mAntenna;
       WsfEM_Rcvr    mRcvr;
@@ -113,6 +114,20 @@ protected:
       //! Array of effective filter bandwidths for each sensor
       std::vector<double> mEffectiveFilterBandwidth;
 
+      //! Filtered background noise for each band, adjusted for Pd and false alarm rate (dB)
+      std::vector<double> mFilteredBackgroundDB;
+
+      //! Sensing threshold for each band (dB)
+      std::vector<double> mThresholdDB;
+
+      //! The relative spacing of the frequencies at which a target's unshifted signature is sampled and
+      //! shared with other sensors (see GetSourcePressure). 0 (the default) evaluates the signature
+      //! directly at the Doppler shifted frequencies without using the cache.
+      double mSourceDopplerTolerance;
+
+      //! The simulation-wide cache of target source pressures (null if mSourceDopplerTolerance is 0)
+      SourceSpectrumCache* mSourceSpectraPtr;
+
       //! Pointer to the threshold table
       WsfAcousticSignature* mThresholdPtr;
 
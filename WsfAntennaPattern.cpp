@@ -74,6 +74,34 @@ double WsfAntennaPattern::GetGain(double aFrequency, double aTargetAz, double aT
    return mSharedDataPtr->GetGain(aFrequency, aTargetAz, aTargetEl, aEBS_Az, aEBS_El);
 }
 
+// =================================================================================================
+//! Return the antenna gains at a list of azimuth and elevation pairs.
+//!
+//! The result is the same as calling GetGain for each pair. Patterns that can evaluate many
+//! angles more efficiently together (e.g. WsfElementESA_AntennaPattern) override this method.
+//!
+//! @param aFrequency The frequency at which to get the gain (Hz).
+//! @param aTargetAz  Target azimuths with respect to the gain pattern boresight (radians).
+//! @param aTargetEl  Target elevations with respect to the gain pattern boresight (radians).
+//!                   Must be the same size as aTargetAz.
+//! @param aEBS_Az    The Electronic Beam Steering azimuth angle (radians).
+//! @param aEBS_El    The Electronic Beam Steering elevation angle (radians).
+//! @param aGains     [output] The gain multipliers (NOT in dB!), one for each pair.
+// virtual
+void WsfAntennaPattern::GetGains(double                     aFrequency,
+                                 const std::vector<double>& aTargetAz,
+                                 const std::vector<double>& aTargetEl,
+                                 double                     aEBS_Az,
+                                 double                     aEBS_El,
+                                 std::vector<double>&       aGains)
+{
+   aGains.resize(aTargetAz.size());
+   for (size_t i = 0; i < aTargetAz.size(); ++i)
+   {
+      aGains[i] = GetGain(aFrequency, aTargetAz[i], aTargetEl[i], aEBS_Az, aEBS_El);
+   }
+}
+
 // =================================================================================================
 //! Return the electronically steered beamwidth.
 //! @param aBeamwidth The beamwidth (radians).
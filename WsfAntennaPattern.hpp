@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "TblLookup.hpp"
 class UtInput;
@@ -93,6 +94,13 @@ public:
 
    virtual double GetGain(double aFrequency, double aTargetAz, double aTargetEl, double aEBS_Az, double aEBS_El);
 
+   virtual void GetGains(double                     aFrequency,
+                         const std::vector<double>& aTargetAz,
+                         const std::vector<double>& aTargetEl,
+                         double                     aEBS_Az,
+                         double                     aEBS_El,
+                         std::vector<double>&       aGains);
+
    WSF_DEPRECATED virtual double GetAzimuthBeamwidth(double aFrequency) const final;
    virtual double GetAzimuthBeamwidth(double aFrequency, double aEBS_Azimuth, double aEBS_Elevation) const;
    WSF_DEPRECATED virtual double GetElevationBeamwidth(double aFrequency) const final;
@@ -0,0 +1,404 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfBudgetedSensorScheduler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "UtInput.hpp"
+#include "UtLog.hpp"
+#include "UtMemory.hpp"
+#include "WsfPlatform.hpp"
+#include "WsfSensorMode.hpp"
+#include "WsfSensorTracker.hpp"
+#include "WsfSimulation.hpp"
+
+namespace
+{
+const char* cTASK_CLASS_NAMES[WsfBudgetedSensorScheduler::cTC_COUNT] = {"Confirmation", "Track", "Search"};
+}
+
+// =================================================================================================
+WsfBudgetedSensorScheduler::WsfBudgetedSensorScheduler()
+   : WsfDefaultSensorScheduler()
+   , mBudgetFrameTime(1.0)
+   , mMaximumOccupancy(1.0)
+   , mPriority{1, 2, 3}
+   , mShowFrameStatistics(false)
+   , mFrame()
+   , mLastFrame()
+   , mTotal()
+   , mFrameCount(0)
+   , mDueRequests()
+{
+   mFrame.mStartTime = -1.0;
+}
+
+//! Factory method for WsfSensorSchedulerTypes to determine if a scheduler
+//! represented by this class is being requested.
+// static
+//  =================================================================================================
+std::unique_ptr<WsfSensorScheduler> WsfBudgetedSensorScheduler::ObjectFactory(const std::string& aTypeName)
+{
+   if (aTypeName == "budgeted")
+   {
+      return ut::make_unique<WsfBudgetedSensorScheduler>();
+   }
+   return nullptr;
+}
+
+// =================================================================================================
+// virtual
+WsfSensorScheduler* WsfBudgetedSensorScheduler::Clone() const
+{
+   return new WsfBudgetedSensorScheduler(*this);
+}
+
+// =================================================================================================
+// virtual
+bool WsfBudgetedSensorScheduler::ProcessInput(UtInput& aInput)
+{
+   bool        myCommand = true;
+   std::string command(aInput.GetCommand());
+   if (command == "budget_frame_time")
+   {
+      aInput.ReadValueOfType(mBudgetFrameTime, UtInput::cTIME);
+      aInput.ValueGreater(mBudgetFrameTime, 0.0);
+   }
+   else if (command == "maximum_occupancy")
+   {
+      aInput.ReadValue(mMaximumOccupancy);
+      aInput.ValueInClosedRange(mMaximumOccupancy, 0.0, 1.0);
+   }
+   else if (command == "confirmation_priority")
+   {
+      aInput.ReadValue(mPriority[cTC_CONFIRMATION]);
+   }
+   else if (command == "track_priority")
+   {
+      aInput.ReadValue(mPriority[cTC_TRACK]);
+   }
+   else if (command == "search_priority")
+   {
+      aInput.ReadValue(mPriority[cTC_SEARCH]);
+   }
+   else if (command == "show_frame_statistics")
+   {
+      mShowFrameStatistics = true;
+   }
+   else
+   {
+      myCommand = WsfDefaultSensorScheduler::ProcessInput(aInput);
+   }
+   return myCommand;
+}
+
+// =================================================================================================
+// virtual
+bool WsfBudgetedSensorScheduler::SelectTarget(double               aSimTime,
+                                              double&              aNextSimTime,
+                                              size_t&              aTargetIndex,
+                                              WsfTrackId&          aRequestId,
+                                              WsfSensor::Settings& aSettings)
+{
+   static const double cEPSILON = 1.0E-7;
+
+   CheckSearchList(aSimTime);
+   UpdateFrame(aSimTime);
+
+   aRequestId.Null();
+   size_t targetIndex = 0;
+   bool   haveChance  = false; // true if a chance was selected
+   bool   blocked     = false; // true if a chance is due but does not fit in the budget
+   if (mDwellEndTime <= (aSimTime + cEPSILON))
+   {
+      ShedExpiredChances(aSimTime);
+
+      // Select the due chance with the highest priority class and then the earliest deadline.
+      TaskClass        bestClass     = cTC_SEARCH;
+      double           bestDeadline  = 0.0;
+      double           bestDwellTime = 0.0;
+      RequestListIndex bestRequest   = mRequestList.size();
+      auto             consider      = [&](TaskClass aClass, double aDeadline, double aDwellTime) -> bool
+      {
+         if (!CanPerform(aDwellTime))
+         {
+            blocked = true;
+            return false;
+         }
+         if (haveChance && ((mPriority[aClass] > mPriority[bestClass]) ||
+                            ((mPriority[aClass] == mPriority[bestClass]) && (aDeadline >= bestDeadline))))
+         {
+            return false;
+         }
+         haveChance    = true;
+         bestClass     = aClass;
+         bestDeadline  = aDeadline;
+         bestDwellTime = aDwellTime;
+         return true;
+      };
+
+      FindDueRequests(aSimTime + cEPSILON, mDueRequests);
+      for (RequestListIndex i : mDueRequests)
+      {
+         const Request& request   = mRequestList[i];
+         WsfSensorMode* modePtr   = mModeList[request.mModeIndex];
+         TaskClass      taskClass = (request.mLastVisitTime < 0.0) ? cTC_CONFIRMATION : cTC_TRACK;
+         if (consider(taskClass, request.mNextVisitTime + modePtr->GetRevisitTime(), modePtr->GetDwellTime()))
+         {
+            bestRequest = i;
+         }
+      }
+
+      bool canSearch = mSearchAllowed && (!mSearchList.empty());
+      bool searchDue = (mNextSearchVisitTime <= (aSimTime + cEPSILON));
+      if (searchDue && canSearch)
+      {
+         if (consider(cTC_SEARCH, mNextSearchVisitTime + mSearchFrameTime, mModeList[mSearchModeIndex]->GetDwellTime()))
+         {
+            bestRequest = mRequestList.size();
+         }
+      }
+
+      if (haveChance && (bestClass != cTC_SEARCH))
+      {
+         Request& request = mRequestList[bestRequest];
+         aRequestId       = request.mRequestId;
+         targetIndex      = CueRequest(aSimTime, request, aSettings);
+
+         request.mLastVisitTime = aSimTime;
+         request.mNextVisitTime += mModeList[request.mModeIndex]->GetRevisitTime();
+         RequestVisitTimeChanged(bestRequest);
+         Perform(bestClass, aSimTime, bestDwellTime);
+      }
+      else if (haveChance)
+      {
+         aSettings.mModeIndex = mSearchModeIndex;
+         targetIndex          = SelectSearchTarget(aSimTime);
+
+         // A culled search chance (see WsfDefaultSensorScheduler::CullSearchTarget) is not performed, so it
+         // does not use the budget and is counted as shed.
+         bool culled = CullSearchTarget(aSimTime, targetIndex);
+
+         // Bypass the search chance if there is an explicit request against the target
+         if (culled || TargetHasActiveRequest(targetIndex))
+         {
+            targetIndex = 0;
+         }
+         mNextSearchVisitTime += mSearchChanceInterval;
+         if (culled)
+         {
+            ++mFrame.mShedCount[cTC_SEARCH];
+         }
+         else
+         {
+            Perform(cTC_SEARCH, aSimTime, bestDwellTime);
+         }
+      }
+      else if (searchDue && (!canSearch))
+      {
+         // Nothing to search. Keep the search clock running as the default scheduler does so the
+         // search list is still checked for dropped tracks and deleted targets.
+         mNextSearchVisitTime += mSearchChanceInterval;
+      }
+   }
+
+   UpdateNextTrackVisitTime();
+   aNextSimTime = std::min(mNextSearchVisitTime, mNextTrackVisitTime);
+   aNextSimTime = std::max(aNextSimTime, mDwellEndTime);
+   if (blocked && (!haveChance))
+   {
+      // The budget of this frame has been used. Wait for the next frame.
+      aNextSimTime = std::max(aNextSimTime, mFrame.mStartTime + mBudgetFrameTime);
+   }
+   aTargetIndex = targetIndex;
+   if (DebugEnabled())
+   {
+      auto out = ut::log::debug() << "Sensor has selected target.";
+      out.AddNote() << "T = " << aSimTime;
+      out.AddNote() << "Platform: " << mSensorPtr->GetPlatform()->GetName();
+      out.AddNote() << "Sensor: " << mSensorPtr->GetName();
+      out.AddNote() << "Target: " << mSensorPtr->GetSimulation()->GetPlatformNameId(aTargetIndex);
+      out.AddNote() << "Mode: " << mModeList[aSettings.mModeIndex]->GetName();
+      out.AddNote() << "Next Sim Time: " << aNextSimTime;
+      out.AddNote() << "Frame Occupancy: " << mFrame.mOccupiedTime[cTC_CONFIRMATION] + mFrame.mOccupiedTime[cTC_TRACK] +
+                                                 mFrame.mOccupiedTime[cTC_SEARCH];
+   }
+   return ((aTargetIndex != 0) || mSensorPtr->TransientCueActive());
+}
+
+// =================================================================================================
+//! Return true if a chance with the specified dwell time fits in the budget of the current frame.
+//! A chance always fits in an empty frame, so a dwell longer than the budget is not starved.
+// private
+bool WsfBudgetedSensorScheduler::CanPerform(double aDwellTime) const
+{
+   double occupiedTime =
+      mFrame.mOccupiedTime[cTC_CONFIRMATION] + mFrame.mOccupiedTime[cTC_TRACK] + mFrame.mOccupiedTime[cTC_SEARCH];
+   return (occupiedTime <= 0.0) || ((occupiedTime + aDwellTime) <= (mMaximumOccupancy * mBudgetFrameTime + 1.0E-9));
+}
+
+// =================================================================================================
+//! Charge a chance to the budget of the current frame and occupy the sensor for its dwell time.
+// private
+void WsfBudgetedSensorScheduler::Perform(TaskClass aClass, double aSimTime, double aDwellTime)
+{
+   mDwellEndTime = aSimTime + aDwellTime;
+   mFrame.mOccupiedTime[aClass] += aDwellTime;
+   ++mFrame.mPerformedCount[aClass];
+}
+
+// =================================================================================================
+//! Shed the chances whose deadlines have passed.
+//! Each shed chance is reported to the tracker as a skipped chance, so the detection history of the
+//! target records a miss just as if the chance had been performed and failed. Chances against false
+//! targets and culled search targets are not reported.
+// private
+void WsfBudgetedSensorScheduler::ShedExpiredChances(double aSimTime)
+{
+   // The chances are reported after the schedule has been updated because the tracker may drop a track,
+   // which can cause the request to be removed.
+   std::vector<std::pair<WsfTrackId, size_t>> shedChances;
+
+   // A request whose deadline has passed must also be due.
+   FindDueRequests(aSimTime, mDueRequests);
+   for (RequestListIndex i : mDueRequests)
+   {
+      Request& request     = mRequestList[i];
+      double   revisitTime = mModeList[request.mModeIndex]->GetRevisitTime();
+      double   lateTime    = aSimTime - (request.mNextVisitTime + revisitTime);
+      if ((revisitTime > 0.0) && (lateTime > 0.0))
+      {
+         unsigned int count     = static_cast<unsigned int>(lateTime / revisitTime) + 1;
+         TaskClass    taskClass = (request.mLastVisitTime < 0.0) ? cTC_CONFIRMATION : cTC_TRACK;
+         request.mNextVisitTime += count * revisitTime;
+         mFrame.mShedCount[taskClass] += count;
+         RequestVisitTimeChanged(i);
+         if (request.mTargetIndex != 0)
+         {
+            shedChances.insert(shedChances.end(), count, std::make_pair(request.mRequestId, request.mTargetIndex));
+         }
+      }
+   }
+
+   if (mSearchAllowed && (!mSearchList.empty()) && (mSearchChanceInterval > 0.0) && (mSearchFrameTime > 0.0))
+   {
+      double lateTime = aSimTime - (mNextSearchVisitTime + mSearchFrameTime);
+      if (lateTime > 0.0)
+      {
+         size_t count = static_cast<size_t>(lateTime / mSearchChanceInterval) + 1;
+         for (size_t i = 0; i < count; ++i)
+         {
+            // Chances against targets with explicit requests are bypassed when performed, and chances against
+            // culled targets are reported by CullSearchTarget, so they are not reported.
+            size_t targetIndex = mSearchList[(mSearchIndex + i) % mSearchList.size()];
+            bool   culled      = (targetIndex < mSearchCulled.size()) && mSearchCulled[targetIndex];
+            if ((targetIndex != 0) && (!culled) && (!TargetHasActiveRequest(targetIndex)))
+            {
+               shedChances.emplace_back(WsfTrackId(), targetIndex);
+            }
+         }
+         mNextSearchVisitTime += count * mSearchChanceInterval;
+         mSearchIndex += count;
+         if (mSearchIndex >= mSearchList.size())
+         {
+            // A new pass through the search list was started.
+            mSearchIndex = mSearchIndex % mSearchList.size();
+            UpdateSearchCulling(aSimTime);
+         }
+         mFrame.mShedCount[cTC_SEARCH] += static_cast<unsigned int>(count);
+      }
+   }
+
+   if (mTrackerPtr != nullptr)
+   {
+      WsfSensorTracker::Settings stSettings;
+      for (const auto& shedChance : shedChances)
+      {
+         // The sensor does not report false targets to the tracker (see CullSearchTarget).
+         WsfPlatform* targetPtr = mSensorPtr->GetSimulation()->GetPlatformByIndex(shedChance.second);
+         if ((targetPtr == nullptr) || (!targetPtr->IsFalseTarget()))
+         {
+            mTrackerPtr->TargetSkipped(aSimTime, stSettings, shedChance.first, shedChance.second);
+         }
+      }
+   }
+}
+
+// =================================================================================================
+//! Start a new budget frame if the current frame has ended.
+//! Frames that passed without any call (because the sensor had nothing to do) are counted as idle
+//! frames, so the frame count and the average occupancy cover the whole elapsed time.
+// private
+void WsfBudgetedSensorScheduler::UpdateFrame(double aSimTime)
+{
+   double frameStartTime = std::floor(aSimTime / mBudgetFrameTime) * mBudgetFrameTime;
+   if (mFrame.mStartTime < 0.0)
+   {
+      mFrame.mStartTime = frameStartTime;
+      return;
+   }
+   if (frameStartTime < (mFrame.mStartTime + 0.5 * mBudgetFrameTime))
+   {
+      return;
+   }
+
+   // The number of frames (after the current frame) that ended without being used.
+   unsigned int idleFrameCount =
+      static_cast<unsigned int>(std::floor((frameStartTime - mFrame.mStartTime) / mBudgetFrameTime + 0.5)) - 1;
+
+   mLastFrame = mFrame;
+   ++mFrameCount;
+   for (int tc = 0; tc < cTC_COUNT; ++tc)
+   {
+      mTotal.mOccupiedTime[tc] += mFrame.mOccupiedTime[tc];
+      mTotal.mPerformedCount[tc] += mFrame.mPerformedCount[tc];
+      mTotal.mShedCount[tc] += mFrame.mShedCount[tc];
+   }
+
+   if (mShowFrameStatistics)
+   {
+      auto out = ut::log::info() << "Sensor budget frame statistics.";
+      out.AddNote() << "T = " << mLastFrame.mStartTime;
+      out.AddNote() << "Platform: " << mSensorPtr->GetPlatform()->GetName();
+      out.AddNote() << "Sensor: " << mSensorPtr->GetName();
+      for (int tc = 0; tc < cTC_COUNT; ++tc)
+      {
+         auto note = out.AddNote() << cTASK_CLASS_NAMES[tc] << " Occupancy: "
+                                   << 100.0 * mLastFrame.mOccupiedTime[tc] / mBudgetFrameTime << " %";
+         note.AddNote() << "Performed: " << mLastFrame.mPerformedCount[tc];
+         note.AddNote() << "Shed: " << mLastFrame.mShedCount[tc];
+      }
+   }
+
+   if (idleFrameCount > 0)
+   {
+      // An idle frame has no activity, so only the frame count changes.
+      mLastFrame            = FrameStatistics();
+      mLastFrame.mStartTime = frameStartTime - mBudgetFrameTime;
+      mFrameCount += idleFrameCount;
+      if (mShowFrameStatistics)
+      {
+         auto out = ut::log::info() << "Sensor budget frames were idle.";
+         out.AddNote() << "T = " << frameStartTime - idleFrameCount * mBudgetFrameTime;
+         out.AddNote() << "Platform: " << mSensorPtr->GetPlatform()->GetName();
+         out.AddNote() << "Sensor: " << mSensorPtr->GetName();
+         out.AddNote() << "Idle Frames: " << idleFrameCount;
+      }
+   }
+
+   mFrame            = FrameStatistics();
+   mFrame.mStartTime = frameStartTime;
+}
@@ -0,0 +1,126 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFBUDGETEDSENSORSCHEDULER_HPP
+#define WSFBUDGETEDSENSORSCHEDULER_HPP
+
+#include "wsf_export.h"
+
+#include "WsfDefaultSensorScheduler.hpp"
+
+//! A sensor scheduler that models the timeline of a multifunction radar as a time budget.
+//!
+//! Time is divided into budget frames ('budget_frame_time'). Each detection chance consumes the
+//! dwell time of its mode from the budget of the current frame, and no more than 'maximum_occupancy'
+//! of a frame may be used. Detection chances belong to one of three classes:
+//!
+//! - confirmation: the first visit of a track request.
+//! - track: subsequent visits of a track request.
+//! - search: a search chance from the search list.
+//!
+//! When the sensor is free the due chance with the highest priority class is performed, and within
+//! a class the chance with the earliest deadline. The deadline of a track request visit is its
+//! revisit time after it became due, and that of a search chance is the search frame time after it
+//! became due. A chance whose deadline has passed is shed (skipped). An overloaded sensor therefore
+//! sheds the lowest priority work first.
+//!
+//! Occupancy statistics are collected for each budget frame (see GetLastFrameStatistics).
+class WSF_EXPORT WsfBudgetedSensorScheduler : public WsfDefaultSensorScheduler
+{
+public:
+   //! The classes of detection chances.
+   enum TaskClass
+   {
+      cTC_CONFIRMATION,
+      cTC_TRACK,
+      cTC_SEARCH,
+      cTC_COUNT
+   };
+
+   //! The statistics of a budget frame.
+   struct FrameStatistics
+   {
+      //! The start time of the frame.
+      double mStartTime = 0.0;
+      //! The time used by each class of chances.
+      double mOccupiedTime[cTC_COUNT] = {0.0, 0.0, 0.0};
+      //! The number of chances performed in each class.
+      unsigned int mPerformedCount[cTC_COUNT] = {0, 0, 0};
+      //! The number of chances shed in each class.
+      unsigned int mShedCount[cTC_COUNT] = {0, 0, 0};
+   };
+
+   WsfBudgetedSensorScheduler();
+   ~WsfBudgetedSensorScheduler() override = default;
+
+   static std::unique_ptr<WsfSensorScheduler> ObjectFactory(const std::string& aTypeName);
+
+   WsfSensorScheduler* Clone() const override;
+
+   bool ProcessInput(UtInput& aInput) override;
+
+   bool SelectTarget(double               aSimTime,
+                     double&              aNextSimTime,
+                     size_t&              aTargetIndex,
+                     WsfTrackId&          aRequestId,
+                     WsfSensor::Settings& aSettings) override;
+
+   //! Return the statistics of the last completed budget frame.
+   const FrameStatistics& GetLastFrameStatistics() const { return mLastFrame; }
+
+   //! Return the statistics accumulated over all completed budget frames.
+   const FrameStatistics& GetTotalStatistics() const { return mTotal; }
+
+   //! Return the number of completed budget frames (including frames in which the sensor was idle).
+   unsigned int GetFrameCount() const { return mFrameCount; }
+
+protected:
+   WsfBudgetedSensorScheduler(const WsfBudgetedSensorScheduler& aSrc) = default;
+   WsfBudgetedSensorScheduler& operator=(const WsfBudgetedSensorScheduler&) = delete;
+
+private:
+   bool CanPerform(double aDwellTime) const;
+
+   void Perform(TaskClass aClass, double aSimTime, double aDwellTime);
+
+   void ShedExpiredChances(double aSimTime);
+
+   void UpdateFrame(double aSimTime);
+
+   //! The length of a budget frame.
+   double mBudgetFrameTime;
+
+   //! The fraction of a budget frame that may be used.
+   double mMaximumOccupancy;
+
+   //! The priority of each class (smaller values have higher priority).
+   int mPriority[cTC_COUNT];
+
+   //! If true, write the statistics of each budget frame to the log.
+   bool mShowFrameStatistics;
+
+   //! The statistics of the current budget frame.
+   FrameStatistics mFrame;
+
+   //! The statistics of the last completed budget frame.
+   FrameStatistics mLastFrame;
+
+   //! The accumulated statistics of all completed budget frames.
+   FrameStatistics mTotal;
+
+   //! The number of completed budget frames (including idle frames).
+   unsigned int mFrameCount;
+
+   //! Scratch storage for the indices of the due requests.
+   std::vector<RequestListIndex> mDueRequests;
+};
+
+#endif
@@ -20,8 +20,11 @@
 #include "UtInput.hpp"
 #include "UtInputBlock.hpp"
 #include "UtMemory.hpp"
+#include "UtVec3d.hpp"
 #include "WsfComponentFactory.hpp"
 #include "WsfDefaultSensorScheduler.hpp"
+#include "WsfEM_Antenna.hpp"
+#include "WsfEM_Rcvr.hpp"
 #include "WsfPlatform.hpp"
 #include "WsfPlatformObserver.hpp"
 #include "WsfRadarSensor.hpp"
@@ -277,11 +280,18 @@ void WsfCTD_SensorComponent::AttemptToDetect(double aSimTime, WsfSensorResult& a
    {
       CTD_Mode& mode(mModeList[modePtr->GetModeIndex()]);
       CTD_Beam& beam(mode.mBeamList[aResult.mBeamIndex]);
-      if (beam.mTargetIndex == 0)
+
+      // A close target can only replace the detection if it is within the acquire deltas
+      // (see PostAttemptToDetect), so nothing needs to be done if they are not defined.
+      if ((beam.mTargetIndex == 0) && beam.mAcquireDeltas.IsDefined())
       {
          beam.mTargetIndex = aResult.GetTarget()->GetIndex();
 
-         beam.mCTD_Results.clear();
+         // Cull the close targets that are not within the acquire deltas of the target. The geometry is
+         // computed the same way as the interaction computes it, so only the detection attempts whose
+         // results would have been rejected are eliminated.
+         WsfEM_Antenna* antennaPtr = aResult.GetReceiver()->GetAntenna();
+         beam.mCTD_Candidates.clear();
          for (auto& tgtIndx : beam.mCTD_Platforms)
          {
             if (tgtIndx != beam.mTargetIndex)
@@ -290,21 +300,56 @@ void WsfCTD_SensorComponent::AttemptToDetect(double aSimTime, WsfSensorResult& a
                if (tgtPtr != nullptr)
                {
                   tgtPtr->Update(aSimTime); // Ensure the target position is current
-                  WsfSensorResult     tgtResult = aResult;
-                  WsfSensor::Settings settings;
-                  settings.mModeIndex  = aResult.mModeIndex;
-                  settings.mRequiredPd = aResult.mRequiredPd;
-                  WsfRadarSensor::RadarBeam* beamPtr =
-                     dynamic_cast<WsfRadarSensor::RadarBeam*>(modePtr->GetBeamEntry(aResult.mBeamIndex));
-                  beamPtr->AttemptToDetect(aSimTime, tgtPtr, settings, tgtResult);
-                  if (tgtResult.Detected())
+                  double tgtLocWCS[3];
+                  tgtPtr->GetLocationWCS(tgtLocWCS);
+                  double trueUnitVecWCS[3];
+                  UtVec3d::Subtract(trueUnitVecWCS, tgtLocWCS, aResult.mRcvrLoc.mLocWCS);
+                  double tgtRange = UtVec3d::Normalize(trueUnitVecWCS);
+                  double tgtAz;
+                  double tgtEl;
+                  antennaPtr->ComputeAspect(trueUnitVecWCS, tgtAz, tgtEl);
+                  if (beam.mAcquireDeltas.IsWithin(fabs(aResult.mRcvrToTgt.mTrueAz - tgtAz),
+                                                   fabs(aResult.mRcvrToTgt.mTrueEl - tgtEl),
+                                                   fabs(aResult.mRcvrToTgt.mRange - tgtRange)))
                   {
-                     // Store the results for now and use post detection attempt
-                     beam.mCTD_Results.push_back(tgtResult);
+                     beam.mCTD_Candidates.push_back(tgtPtr);
                   }
                }
             }
          }
+
+         // Attempt to detect the remaining close targets, one at a time.
+         beam.mCTD_ResultCount = 0;
+         if (!beam.mCTD_Candidates.empty())
+         {
+            WsfSensor::Settings settings;
+            settings.mModeIndex  = aResult.mModeIndex;
+            settings.mRequiredPd = aResult.mRequiredPd;
+            WsfRadarSensor::RadarBeam* beamPtr =
+               dynamic_cast<WsfRadarSensor::RadarBeam*>(modePtr->GetBeamEntry(aResult.mBeamIndex));
+            WsfStringId categoryId = modePtr->GetSensor()->GetZoneAttenuationModifier();
+            for (WsfPlatform* tgtPtr : beam.mCTD_Candidates)
+            {
+               if (beam.mCTD_ResultCount == beam.mCTD_Results.size())
+               {
+                  beam.mCTD_Results.emplace_back();
+               }
+               // Seed the pooled result the same way RadarMode::PrepareDetectionAttempt does rather than
+               // copying the whole result. The geometry and target are set by the detection attempt.
+               WsfSensorResult& tgtResult = beam.mCTD_Results[beam.mCTD_ResultCount];
+               tgtResult.Reset(aResult);
+               tgtResult.mBeamIndex     = aResult.mBeamIndex;
+               tgtResult.mCheckedStatus = aResult.mCheckedStatus;
+               tgtResult.mFailedStatus  = aResult.mFailedStatus;
+               tgtResult.SetCategory(categoryId);
+               beamPtr->AttemptToDetect(aSimTime, tgtPtr, settings, tgtResult);
+               if (tgtResult.Detected())
+               {
+                  // Keep the result for now and use post detection attempt
+                  ++beam.mCTD_ResultCount;
+               }
+            }
+         }
          beam.mTargetIndex = 0; // reset index for next target
       }
    }
@@ -325,26 +370,22 @@ void WsfCTD_SensorComponent::PostAttemptToDetect(double aSimTime, WsfPlatform* a
    bool replaced = false;
    for (auto& mode : mModeList)
    {
+      auto tgtResult = mode.mTargetResults.find(aTargetPtr->GetIndex());
       for (auto& beam : mode.mBeamList)
       {
-         for (auto& result : beam.mCTD_Results)
+         for (size_t resultIndex = 0; resultIndex < beam.mCTD_ResultCount; ++resultIndex)
          {
+            WsfSensorResult& result = beam.mCTD_Results[resultIndex];
             if (result.mSignalToNoise > aResult.mSignalToNoise)
             {
                bool allowReplacement = false;
-               auto tgtResult        = mode.mTargetResults.find(aTargetPtr->GetIndex());
                if (tgtResult == mode.mTargetResults.end() ||
                    tgtResult->second.mLastTargetResult != result.GetTarget()->GetIndex())
                {
-                  allowReplacement =
-                     ((beam.mAcquireDeltas.mAzimuthDelta >= 0.0) || (beam.mAcquireDeltas.mElevationDelta >= 0.0) ||
-                      (beam.mAcquireDeltas.mRangeDelta >= 0.0)) &&
-                     ((beam.mAcquireDeltas.mAzimuthDelta < 0.0) ||
-                      (fabs(resultAz - result.mRcvrToTgt.mTrueAz) <= beam.mAcquireDeltas.mAzimuthDelta)) &&
-                     ((beam.mAcquireDeltas.mElevationDelta < 0.0) ||
-                      (fabs(resultEl - result.mRcvrToTgt.mTrueEl) <= beam.mAcquireDeltas.mElevationDelta)) &&
-                     ((beam.mAcquireDeltas.mRangeDelta < 0.0) ||
-                      (fabs(resultRange - result.mRcvrToTgt.mRange) <= beam.mAcquireDeltas.mRangeDelta));
+                  allowReplacement = beam.mAcquireDeltas.IsDefined() &&
+                                     beam.mAcquireDeltas.IsWithin(fabs(resultAz - result.mRcvrToTgt.mTrueAz),
+                                                                  fabs(resultEl - result.mRcvrToTgt.mTrueEl),
+                                                                  fabs(resultRange - result.mRcvrToTgt.mRange));
                }
 
                if (allowReplacement)
@@ -354,7 +395,7 @@ void WsfCTD_SensorComponent::PostAttemptToDetect(double aSimTime, WsfPlatform* a
                }
             }
          }
-         beam.mCTD_Results.clear();
+         beam.mCTD_ResultCount = 0;
       }
    }
 
@@ -92,6 +92,17 @@ public:
 
       struct Deltas
       {
+         //! Return true if any of the deltas has been defined.
+         bool IsDefined() const { return (mAzimuthDelta >= 0.0) || (mElevationDelta >= 0.0) || (mRangeDelta >= 0.0); }
+
+         //! Return true if the (absolute) differences are within each of the defined deltas.
+         bool IsWithin(double aAzimuthDifference, double aElevationDifference, double aRangeDifference) const
+         {
+            return ((mAzimuthDelta < 0.0) || (aAzimuthDifference <= mAzimuthDelta)) &&
+                   ((mElevationDelta < 0.0) || (aElevationDifference <= mElevationDelta)) &&
+                   ((mRangeDelta < 0.0) || (aRangeDifference <= mRangeDelta));
+         }
+
          double mAzimuthDelta{-1.0};
          double mElevationDelta{-1.0};
          double mRangeDelta{-1.0};
@@ -102,7 +113,12 @@ public:
       Deltas                       mReacquireDeltas;
       size_t                       mTargetIndex{0}; // prevent circular references
       std::unordered_set<size_t>   mCTD_Platforms;
+      //! Detected close targets. Only the first mCTD_ResultCount entries are valid. The remaining
+      //! entries are kept so their storage is reused by the next detection attempt.
       std::vector<WsfSensorResult> mCTD_Results;
+      size_t                       mCTD_ResultCount{0};
+      //! Close targets that passed the acquire deltas (reused for each detection attempt).
+      std::vector<WsfPlatform*>    mCTD_Candidates;
    };
 
    //! The CTD component extensions to a sensor mode.
@@ -46,6 +46,8 @@ WsfCompositeSensor::WsfCompositeSensor(WsfScenario& aScenario)
    , mTrackQuality(0.0)
    , mFilterPtr(nullptr)
    , mTrackManagerPtr(nullptr)
+   , mCompositeTrackIndex()
+   , mRawTrackIndex()
    , mMutex()
    , mCallbacks()
    , mXmtrList()
@@ -69,6 +71,8 @@ WsfCompositeSensor::WsfCompositeSensor(const WsfCompositeSensor& aSrc)
    , mTrackQuality(aSrc.mTrackQuality)
    , mFilterPtr(nullptr)
    , mTrackManagerPtr(nullptr)
+   , mCompositeTrackIndex()
+   , mRawTrackIndex()
    , mMutex()
    , mCallbacks()
    , mXmtrList()
@@ -436,6 +440,8 @@ void WsfCompositeSensor::TurnOff(double aSimTime)
    {
       mTrackManagerPtr->GetTrackList().DeleteAllTracks();
       mTrackManagerPtr->GetRawTrackList().DeleteAllTracks();
+      mCompositeTrackIndex.clear();
+      mRawTrackIndex.clear();
    }
    else if (mOperatingMode == cOM_SYNCHRONOUS)
    {
@@ -564,14 +570,29 @@ bool WsfCompositeSensor::DropContributorTrack(double aSimTime, const WsfTrackId&
    WsfLocalTrackList& localTrackList = mTrackManagerPtr->GetTrackList();
    WsfTrackList&      rawTrackList   = mTrackManagerPtr->GetRawTrackList();
 
+   // The composite track is normally the one for the target of the raw track. The list is only
+   // searched if the raw track is unknown or its target no longer matches the composite track.
+
    WsfLocalTrack* fusedTrackPtr = nullptr;
-   for (unsigned int entryIndex = 0; entryIndex < localTrackList.GetTrackCount(); ++entryIndex)
+   auto           rawIter       = mRawTrackIndex.find(aRawTrackId);
+   if (rawIter != mRawTrackIndex.end())
    {
-      WsfLocalTrack* tempTrackPtr = localTrackList.GetTrackEntry(entryIndex);
-      if (tempTrackPtr->IsCorrelatedWith(aRawTrackId))
+      auto localIter = mCompositeTrackIndex.find(rawIter->second->GetTargetName());
+      if ((localIter != mCompositeTrackIndex.end()) && localIter->second->IsCorrelatedWith(aRawTrackId))
       {
-         fusedTrackPtr = tempTrackPtr;
-         break;
+         fusedTrackPtr = localIter->second;
+      }
+   }
+   if (fusedTrackPtr == nullptr)
+   {
+      for (unsigned int entryIndex = 0; entryIndex < localTrackList.GetTrackCount(); ++entryIndex)
+      {
+         WsfLocalTrack* tempTrackPtr = localTrackList.GetTrackEntry(entryIndex);
+         if (tempTrackPtr->IsCorrelatedWith(aRawTrackId))
+         {
+            fusedTrackPtr = tempTrackPtr;
+            break;
+         }
       }
    }
 
@@ -584,11 +605,20 @@ bool WsfCompositeSensor::DropContributorTrack(double aSimTime, const WsfTrackId&
       if (!fusedTrackPtr->IsCorrelated())
       {
          TrackDropped(aSimTime, fusedTrackPtr);
+         auto localIter = mCompositeTrackIndex.find(fusedTrackPtr->GetTargetName());
+         if ((localIter != mCompositeTrackIndex.end()) && (localIter->second == fusedTrackPtr))
+         {
+            mCompositeTrackIndex.erase(localIter);
+         }
          localTrackList.DeleteTrack(fusedTrackPtr->GetTrackId());
       }
    }
 
    // And finally, get rid of the raw track.
+   if (rawIter != mRawTrackIndex.end())
+   {
+      mRawTrackIndex.erase(rawIter);
+   }
    bool trackDropped = rawTrackList.DeleteTrack(aRawTrackId);
    return trackDropped;
 }
@@ -608,10 +638,12 @@ void WsfCompositeSensor::UpdateCompositeTrack(double aSimTime, const WsfTrack& a
 
    // Add or update the raw track list with the track from the constituent sensor.
 
-   WsfTrack* rawTrackPtr = rawTrackList.FindTrack(aRawTrack.GetTrackId());
-   if (rawTrackPtr != nullptr)
+   WsfTrack* rawTrackPtr = nullptr;
+   auto      rawIter     = mRawTrackIndex.find(aRawTrack.GetTrackId());
+   if (rawIter != mRawTrackIndex.end())
    {
       // Update existing raw track.
+      rawTrackPtr = rawIter->second;
       (*rawTrackPtr) = aRawTrack;
       if (DebugEnabled())
       {
@@ -629,6 +661,7 @@ void WsfCompositeSensor::UpdateCompositeTrack(double aSimTime, const WsfTrack& a
       // Add new raw track.
       rawTrackPtr = aRawTrack.Clone();
       rawTrackList.AddTrack(std::unique_ptr<WsfTrack>(rawTrackPtr));
+      mRawTrackIndex[rawTrackPtr->GetTrackId()] = rawTrackPtr;
       if (DebugEnabled())
       {
          auto out = ut::log::debug() << "Composite sensor adding raw track.";
@@ -644,14 +677,10 @@ void WsfCompositeSensor::UpdateCompositeTrack(double aSimTime, const WsfTrack& a
    // Use perfect correlation to locate the composite track.
 
    WsfLocalTrack* localTrackPtr = nullptr;
-   for (unsigned int entryIndex = 0; entryIndex < localTrackList.GetTrackCount(); ++entryIndex)
+   auto           localIter     = mCompositeTrackIndex.find(rawTrackPtr->GetTargetName());
+   if (localIter != mCompositeTrackIndex.end())
    {
-      WsfLocalTrack* tempTrackPtr = localTrackList.GetTrackEntry(entryIndex);
-      if (tempTrackPtr->GetTargetName() == rawTrackPtr->GetTargetName())
-      {
-         localTrackPtr = tempTrackPtr;
-         break;
-      }
+      localTrackPtr = localIter->second;
    }
 
    // If a composite track does exist then create one from the contributor track.
@@ -669,6 +698,7 @@ void WsfCompositeSensor::UpdateCompositeTrack(double aSimTime, const WsfTrack& a
          localTrackPtr->SetFilter(mFilterPtr->Clone());
       }
       localTrackList.AddTrack(std::move(localTrackUP));
+      mCompositeTrackIndex[localTrackPtr->GetTargetName()] = localTrackPtr;
       if (DebugEnabled())
       {
          auto out = ut::log::debug() << "Composite sensor creating composite track.";
@@ -685,13 +715,16 @@ void WsfCompositeSensor::UpdateCompositeTrack(double aSimTime, const WsfTrack& a
    }
 
    // Determine if the update from this contributor should be used to update the composite track.
+   // Contributor qualities are read through the index as they can change outside of this method
+   // (see SensorDetectionChanged).
 
    bool                                 updateTrack = true;
+   double                               rawQuality  = rawTrackPtr->GetTrackQuality();
    const WsfLocalTrack::RawTrackIdList& rawTrackIds = localTrackPtr->GetRawTrackIds();
    for (unsigned int index = 0; index < rawTrackIds.GetCount(); ++index)
    {
-      WsfTrack* tempTrackPtr = rawTrackList.FindTrack(*(rawTrackIds.GetEntry(index)));
-      if ((tempTrackPtr != nullptr) && (rawTrackPtr->GetTrackQuality() < tempTrackPtr->GetTrackQuality()))
+      auto contributorIter = mRawTrackIndex.find(*(rawTrackIds.GetEntry(index)));
+      if ((contributorIter != mRawTrackIndex.end()) && (rawQuality < contributorIter->second->GetTrackQuality()))
       {
          updateTrack = false;
          break;
@@ -14,6 +14,7 @@
 
 #include "wsf_export.h"
 
+#include <map>
 #include <mutex>
 #include <vector>
 
@@ -134,6 +135,12 @@ protected:
    //! Pointer to the track manager that holds the track lists.
    WsfTrackManager* mTrackManagerPtr;
 
+   //! Composite tracks indexed by target name (perfect correlation), mirroring the local track list.
+   std::map<WsfStringId, WsfLocalTrack*> mCompositeTrackIndex;
+
+   //! Contributor tracks indexed by track ID, mirroring the raw track list.
+   std::map<WsfTrackId, WsfTrack*> mRawTrackIndex;
+
    //! Mutex for locking simulation observer callbacks when multi-threading.
    mutable std::recursive_mutex mMutex;
 
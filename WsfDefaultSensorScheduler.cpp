@@ -17,13 +17,17 @@
 #include "UtInput.hpp"
 #include "UtLog.hpp"
 #include "UtRandom.hpp"
+#include "WsfEM_Antenna.hpp"
+#include "WsfEM_Rcvr.hpp"
 #include "WsfEM_Util.hpp"
 #include "WsfEM_Xmtr.hpp"
 #include "WsfLocalTrack.hpp"
 #include "WsfPlatform.hpp"
+#include "WsfSensorBeam.hpp"
 #include "WsfSensorMode.hpp"
 #include "WsfSensorModeList.hpp"
 #include "WsfSensorObserver.hpp"
+#include "WsfSensorResult.hpp"
 #include "WsfSensorTracker.hpp"
 #include "WsfSimulation.hpp"
 #include "WsfTrackList.hpp"
@@ -51,6 +55,12 @@
 // time-ordered manner and a priority_queue would be an obvious choice, but we also have to
 // be able to remove entries from the middle of the list.  Since this list is often very short,
 // searching through a vector to find the next request is probably the easiest thing.
+//
+// A multi-function radar may have hundreds of requests and thousands of search targets, and the
+// searches (after every visit, and for every search chance) then dominate.  The vector is still
+// the request list, but it is indexed by an indexed binary heap of next visit times, a map by
+// request ID and a count of the requests against each target.  Requests are added and changed far
+// more often than they are removed, so the indices are simply rebuilt when a request is removed.
 
 // =================================================================================================
 WsfDefaultSensorScheduler::WsfDefaultSensorScheduler()
@@ -64,11 +74,17 @@ WsfDefaultSensorScheduler::WsfDefaultSensorScheduler()
    , mSearchIndex(0)
    , mRequestList()
    , mRequestIndex(0)
+   , mRequestIdIndex()
+   , mTargetRequestCount()
+   , mVisitHeap()
+   , mVisitHeapPosition()
    , mLastExplicitModeIndex(0)
    , mSearchModeIndex(0)
    , mSearchAllowed(true)
    , mCheckSearchList(false)
    , mScanSchedulingMethod(cSSM_RANDOM)
+   , mSearchCulling(false)
+   , mSearchCulled()
 {
 }
 
@@ -84,11 +100,17 @@ WsfDefaultSensorScheduler::WsfDefaultSensorScheduler(const WsfDefaultSensorSched
    , mSearchIndex(0)
    , mRequestList()
    , mRequestIndex(0)
+   , mRequestIdIndex()
+   , mTargetRequestCount()
+   , mVisitHeap()
+   , mVisitHeapPosition()
    , mLastExplicitModeIndex(0)
    , mSearchModeIndex(0)
    , mSearchAllowed(true)
    , mCheckSearchList(aSrc.mCheckSearchList)
    , mScanSchedulingMethod(aSrc.mScanSchedulingMethod)
+   , mSearchCulling(aSrc.mSearchCulling)
+   , mSearchCulled()
 {
 }
 
@@ -163,7 +185,7 @@ int WsfDefaultSensorScheduler::GetMaximumRequestCount(WsfStringId aModeNameId) c
 // virtual
 bool WsfDefaultSensorScheduler::HaveRequestFor(const WsfTrackId& aRequestId) const
 {
-   return (std::find_if(mRequestList.begin(), mRequestList.end(), CompareRequestId(aRequestId)) != mRequestList.end());
+   return (FindRequest(aRequestId) < mRequestList.size());
 }
 
 // =================================================================================================
@@ -324,6 +346,10 @@ bool WsfDefaultSensorScheduler::ProcessInput(UtInput& aInput)
          throw UtInput::BadValue(aInput, "Bad value for scan_scheduling: " + command);
       }
    }
+   else if (command == "search_culling")
+   {
+      aInput.ReadValue(mSearchCulling);
+   }
    else
    {
       myCommand = WsfSensorScheduler::ProcessInput(aInput);
@@ -360,10 +386,10 @@ void WsfDefaultSensorScheduler::RemoveTarget(double aSimTime, size_t aTargetInde
 // virtual
 const WsfTrack& WsfDefaultSensorScheduler::GetTrackForRequest(const WsfTrackId& aRequestId) const
 {
-   auto rli = std::find_if(mRequestList.begin(), mRequestList.end(), CompareRequestId(aRequestId));
-   if (rli != mRequestList.end())
+   RequestListIndex rli = FindRequest(aRequestId);
+   if (rli < mRequestList.size())
    {
-      return (*rli).mTrack;
+      return mRequestList[rli].mTrack;
    }
    static WsfTrack track;
    return track;
@@ -389,121 +415,18 @@ bool WsfDefaultSensorScheduler::SelectTarget(double               aSimTime,
       out.AddNote() << "Next Search Visit Time: " << mNextSearchVisitTime;
       out.AddNote() << "Next Track Visit Time: " << mNextTrackVisitTime;
    }
-   WsfSimulation& sim = *mSensorPtr->GetSimulation();
-   // If searching has been disabled some things are checked in the search list (upon request):
-   //
-   // 1) Targets that were being detected/tracked by the search mode and not the subject of a request need to
-   //    have their tracks dropped.
-   // 2) Targets that have been deleted and not the subject of a request need to be removed from the search list.
-   //
-   // NOTE: This check is performed only when requested AND when search is disabled. The request is made
-   //       when mode change occurs or when a platform is deleted from the simulation.
-
-   if (mCheckSearchList && (!mSearchAllowed))
-   {
-      WsfSensorTracker::Settings stSettings;
-      bool                       platformsDeleted = false;
-      for (size_t si = 0; si < mSearchList.size(); ++si)
-      {
-         size_t ti = mSearchList[si];
-         if (!TargetHasActiveRequest(ti))
-         {
-            // Loop until any detection data is cleaned up and outstanding track is dropped.
-            while (!mTrackerPtr->TargetSkipped(aSimTime, stSettings, WsfTrackId(), ti))
-            {
-            }
-
-            // If the target platform no longer exists, mark it for removal from the search list.
-            if (sim.GetPlatformByIndex(ti) == nullptr)
-            {
-               mSearchList[si]  = 0;
-               platformsDeleted = true;
-            }
-         }
-      }
-
-      // Remove platforms from the search chance list that have been marked for removal.
-      if (platformsDeleted)
-      {
-         mSearchList.erase(std::remove(mSearchList.begin(), mSearchList.end(), 0U), mSearchList.end());
-      }
-      // Start at the head of the list when a search mode is subsequently selected.
-      mSearchIndex = 0;
-   }
-   mCheckSearchList = false;
+   CheckSearchList(aSimTime);
 
    aRequestId.Null();
    size_t targetIndex = 0;
    if (mNextTrackVisitTime <= (aSimTime + cEPSILON))
    {
       // Select the next chance from the request queue.
-      Request& request = mRequestList[mRequestIndex];
-      aRequestId       = request.mRequestId;
-      targetIndex      = SelectTargetForRequest(request);
-
-      // Use the requested mode for the detection chance.
-      aSettings.mModeIndex   = request.mModeIndex;
+      Request& request       = mRequestList[mRequestIndex];
+      aRequestId             = request.mRequestId;
+      targetIndex            = CueRequest(aSimTime, request, aSettings);
       WsfSensorMode* modePtr = mModeList[request.mModeIndex];
 
-      // Get the position estimate for the cue.
-      // If there is a tracker then attempt to get it from the there.
-      // If there isn't a tracker or it doesn't have an estimate, then get it from the track supplied with the request.
-
-      double targetLocWCS[3];
-      bool   haveTargetState = false;
-      bool   adjustTargetCue = false;
-      if (mTrackerPtr != nullptr)
-      {
-         WsfSensorTracker::TargetState targetState;
-         if (mTrackerPtr->GetTargetState(aSimTime, aRequestId, targetState))
-         {
-            haveTargetState = true;
-            UtVec3d::Set(targetLocWCS, targetState.mLocationWCS.GetData());
-            aSettings.mLockonTime = targetState.mLockonTime;
-            adjustTargetCue       = true; // The target cue is only adjusted from internal cues
-         }
-      }
-
-      if (!haveTargetState)
-      {
-         haveTargetState = request.mTrack.GetExtrapolatedLocationWCS(aSimTime, targetLocWCS);
-      }
-
-      if (haveTargetState)
-      {
-         // This is really, really ugly, but absolutely necessary for long-range tracking sensors.
-         //
-         // The cue location reported by the tracker is the 'geometric location' of the perceived target rather than the
-         // 'apparent location' that accounts for atmospheric refraction. The difference typically isn't very much, but if
-         // the beam is very narrow, the ranges are long and the geometric location is used, the losses from not being in
-         // the center of the beam may be significant (a couple of dB). Thus, we must recover the 'apparent location'.
-         //
-         // Of course things don't work this way in real life (which uses ranges, angles, rates, etc.) But we really can't
-         // do that here because our detection rates are probably not as high as a real system, so running tracking filters
-         // and such is probably somewhat meaningless.
-         //
-         // At any rate, this takes care of the problem...
-         //
-         // For the current time, cuing for non-tracking sensors do not have this processing applied. They typically have wide
-         // enough beams or are scanners (which will be adjusted to point at the target), so it is not as issue.
-
-         if (adjustTargetCue)
-         {
-            if (mSensorPtr->GetEM_XmtrCount() > 0)
-            {
-               double earthRadiusScale = mSensorPtr->GetEM_Xmtr(0).GetEarthRadiusMultiplier();
-               if (earthRadiusScale != 1.0)
-               {
-                  mSensorPtr->GetPlatform()->Update(aSimTime);
-                  double sensorLocWCS[3];
-                  mSensorPtr->GetLocationWCS(sensorLocWCS);
-                  WsfEM_Util::ComputeApparentPosition(earthRadiusScale, sensorLocWCS, targetLocWCS, sensorLocWCS, targetLocWCS);
-               }
-            }
-         }
-         mSensorPtr->SetTransientCuedLocationWCS(targetLocWCS);
-      }
-
       // Don't allow another detection chance until the dwell time has elapsed.
 
       mDwellEndTime        = request.mNextVisitTime + modePtr->GetDwellTime();
@@ -512,6 +435,7 @@ bool WsfDefaultSensorScheduler::SelectTarget(double               aSimTime,
       // Compute the next visit time for the request...
 
       request.mNextVisitTime += modePtr->GetRevisitTime();
+      RequestVisitTimeChanged(mRequestIndex);
       UpdateNextTrackVisitTime();
    }
    else if (mNextSearchVisitTime <= (aSimTime + cEPSILON))
@@ -520,12 +444,20 @@ bool WsfDefaultSensorScheduler::SelectTarget(double               aSimTime,
       if (mSearchAllowed && (!mSearchList.empty()))
       {
          aSettings.mModeIndex = mSearchModeIndex;
-         if (mSearchIndex >= mSearchList.size())
+         targetIndex          = SelectSearchTarget(aSimTime);
+
+         // Search chances for targets outside the envelope of the search mode are not returned to the sensor.
+         // Each culled target still uses its chance, so all of the culled chances that are due are done here.
+         while (CullSearchTarget(aSimTime, targetIndex))
          {
-            mSearchIndex = 0;
+            targetIndex = 0;
+            if ((mNextSearchVisitTime + mSearchChanceInterval) > (aSimTime + cEPSILON))
+            {
+               break;
+            }
+            mNextSearchVisitTime += mSearchChanceInterval;
+            targetIndex = SelectSearchTarget(aSimTime);
          }
-         targetIndex = mSearchList[mSearchIndex];
-         ++mSearchIndex;
 
          // Bypass the search chance if there is an explicit request against the target
          if (TargetHasActiveRequest(targetIndex))
@@ -545,7 +477,7 @@ bool WsfDefaultSensorScheduler::SelectTarget(double               aSimTime,
       out.AddNote() << "T = " << aSimTime;
       out.AddNote() << "Platform: " << mSensorPtr->GetPlatform()->GetName();
       out.AddNote() << "Sensor: " << mSensorPtr->GetName();
-      out.AddNote() << "Target: " << sim.GetPlatformNameId(aTargetIndex);
+      out.AddNote() << "Target: " << mSensorPtr->GetSimulation()->GetPlatformNameId(aTargetIndex);
       out.AddNote() << "Mode: " << mModeList[aSettings.mModeIndex]->GetName();
       out.AddNote() << "Transient Cue: " << mSensorPtr->TransientCueActive();
       out.AddNote() << "Next Sim Time: " << aNextSimTime;
@@ -559,7 +491,7 @@ bool WsfDefaultSensorScheduler::SelectTarget(double               aSimTime,
 // virtual
 bool WsfDefaultSensorScheduler::StartTracking(double aSimTime, const WsfTrack& aTrack, WsfStringId aModeNameId)
 {
-   auto rli = std::find_if(mRequestList.begin(), mRequestList.end(), CompareRequestId(aTrack.GetTrackId()));
+   RequestListIndex rli = FindRequest(aTrack.GetTrackId());
 
    // Validate the supplied mode name.
 
@@ -577,10 +509,10 @@ bool WsfDefaultSensorScheduler::StartTracking(double aSimTime, const WsfTrack& a
          return false;
       }
    }
-   else if (rli != mRequestList.end())
+   else if (rli < mRequestList.size())
    {
       // A mode name was not specified. If a request already exists for this track then use the current mode.
-      modeIndex = (*rli).mModeIndex;
+      modeIndex = mRequestList[rli].mModeIndex;
    }
 
    WsfSensorMode* modePtr = mModeList[modeIndex];
@@ -599,7 +531,7 @@ bool WsfDefaultSensorScheduler::StartTracking(double aSimTime, const WsfTrack& a
 
    bool startedTracking = false;
 
-   if (rli == mRequestList.end())
+   if (rli >= mRequestList.size())
    {
       // Allow the request only if the maximum request count has not been exceeded.
       if (activeRequestsInMode < modePtr->GetMaximumRequestCount())
@@ -611,6 +543,12 @@ bool WsfDefaultSensorScheduler::StartTracking(double aSimTime, const WsfTrack& a
          request.mNextVisitTime =
             aSimTime + mSensorPtr->GetSimulation()->GetRandom().Uniform(0.0, modePtr->GetFrameTime());
          mRequestList.push_back(request);
+         RequestListIndex requestIndex       = mRequestList.size() - 1;
+         mRequestIdIndex[request.mRequestId] = requestIndex;
+         ++mTargetRequestCount[request.mTargetIndex];
+         mVisitHeapPosition.push_back(mVisitHeap.size());
+         mVisitHeap.push_back(requestIndex);
+         SiftVisitHeapUp(mVisitHeap.size() - 1);
          UpdateNextTrackVisitTime();
 
          SelectMode(aSimTime, request);
@@ -624,7 +562,7 @@ bool WsfDefaultSensorScheduler::StartTracking(double aSimTime, const WsfTrack& a
    else
    {
       // Updating an existing request.
-      Request& request        = *rli;
+      Request& request        = mRequestList[rli];
       bool     requestUpdated = false;
 
       // The track is always updated even if the potential mode change request might fail. There doesn't
@@ -650,6 +588,7 @@ bool WsfDefaultSensorScheduler::StartTracking(double aSimTime, const WsfTrack& a
             // The next detection chance is set to a uniform random value within the frame time of the new mode.
             request.mNextVisitTime =
                aSimTime + mSensorPtr->GetSimulation()->GetRandom().Uniform(0.0, modePtr->GetFrameTime());
+            RequestVisitTimeChanged(rli);
             UpdateNextTrackVisitTime();
 
             SelectMode(aSimTime, request);
@@ -682,14 +621,15 @@ bool WsfDefaultSensorScheduler::StartTracking(double aSimTime, const WsfTrack& a
 bool WsfDefaultSensorScheduler::StopTracking(double aSimTime, const WsfTrackId& aRequestId)
 {
    bool stoppedTracking = false;
-   auto rli             = find_if(mRequestList.begin(), mRequestList.end(), CompareRequestId(aRequestId));
-   if (rli != mRequestList.end())
+   RequestListIndex rli = FindRequest(aRequestId);
+   if (rli < mRequestList.size())
    {
-      Request& request = *rli;
+      Request& request = mRequestList[rli];
       stoppedTracking  = true;
       DeselectMode(aSimTime, request);
       WsfObserver::SensorRequestCanceled(mSensorPtr->GetSimulation())(aSimTime, mSensorPtr, &request.mTrack);
-      mRequestList.erase(rli);
+      mRequestList.erase(mRequestList.begin() + rli);
+      RebuildRequestIndex();
       UpdateNextTrackVisitTime();
       // TODO-This may be overly aggressive because it currently causes the sensor track to be dropped.
       // TODO-If this sensor also has a simultaneous search capability then it will force the M/N criteria
@@ -723,10 +663,10 @@ void WsfDefaultSensorScheduler::TrackerModeChange(double            aSimTime,
    size_t newModeIndex = mSensorPtr->GetModeList()->GetModeByName(aModeNameId);
    if (newModeIndex < mSensorPtr->GetModeList()->GetModeCount())
    {
-      auto rli = std::find_if(mRequestList.begin(), mRequestList.end(), CompareRequestId(aRequestId));
-      if (rli != mRequestList.end())
+      RequestListIndex rli = FindRequest(aRequestId);
+      if (rli < mRequestList.size())
       {
-         Request& request = *rli;
+         Request& request = mRequestList[rli];
          if (request.mModeIndex != newModeIndex)
          {
             if (DebugEnabled())
@@ -752,6 +692,7 @@ void WsfDefaultSensorScheduler::TrackerModeChange(double            aSimTime,
             // Update the next visit time for the request based on the new mode.
             WsfSensorMode* modePtr = mModeList[request.mModeIndex];
             request.mNextVisitTime = aSimTime + modePtr->GetFrameTime();
+            RequestVisitTimeChanged(rli);
             UpdateNextTrackVisitTime();
 
             WsfObserver::SensorRequestUpdated(
@@ -806,6 +747,7 @@ void WsfDefaultSensorScheduler::TurnOn(double aSimTime)
       i.mNextVisitTime = nextVisitTime;
       nextVisitTime += mModeList[i.mModeIndex]->GetDwellTime();
    }
+   RebuildRequestIndex();
    mDwellEndTime = aSimTime;
    UpdateNextTrackVisitTime();
 
@@ -815,6 +757,277 @@ void WsfDefaultSensorScheduler::TurnOn(double aSimTime)
    mCheckSearchList = false;
 }
 
+// =================================================================================================
+//! Check the search list for targets that need to be dropped or removed (if requested).
+// protected
+void WsfDefaultSensorScheduler::CheckSearchList(double aSimTime)
+{
+   WsfSimulation& sim = *mSensorPtr->GetSimulation();
+   // If searching has been disabled some things are checked in the search list (upon request):
+   //
+   // 1) Targets that were being detected/tracked by the search mode and not the subject of a request need to
+   //    have their tracks dropped.
+   // 2) Targets that have been deleted and not the subject of a request need to be removed from the search list.
+   //
+   // NOTE: This check is performed only when requested AND when search is disabled. The request is made
+   //       when mode change occurs or when a platform is deleted from the simulation.
+
+   if (mCheckSearchList && (!mSearchAllowed))
+   {
+      WsfSensorTracker::Settings stSettings;
+      bool                       platformsDeleted = false;
+      for (size_t si = 0; si < mSearchList.size(); ++si)
+      {
+         size_t ti = mSearchList[si];
+         if (!TargetHasActiveRequest(ti))
+         {
+            // Loop until any detection data is cleaned up and outstanding track is dropped.
+            while (!mTrackerPtr->TargetSkipped(aSimTime, stSettings, WsfTrackId(), ti))
+            {
+            }
+
+            // If the target platform no longer exists, mark it for removal from the search list.
+            if (sim.GetPlatformByIndex(ti) == nullptr)
+            {
+               mSearchList[si]  = 0;
+               platformsDeleted = true;
+            }
+         }
+      }
+
+      // Remove platforms from the search chance list that have been marked for removal.
+      if (platformsDeleted)
+      {
+         mSearchList.erase(std::remove(mSearchList.begin(), mSearchList.end(), 0U), mSearchList.end());
+      }
+      // Start at the head of the list when a search mode is subsequently selected.
+      mSearchIndex = 0;
+   }
+   mCheckSearchList = false;
+}
+
+// =================================================================================================
+//! Report a search chance to the tracker if the target is outside the envelope of the search mode.
+//! The report is the same as the one made by the sensor for a target beyond its detection range, so
+//! a target being coasted by the tracker is handled as if the chance had been performed. False
+//! targets are culled without a report, as the sensor would not have reported them.
+//! @returns true if the target was culled.
+// protected
+bool WsfDefaultSensorScheduler::CullSearchTarget(double aSimTime, size_t aTargetIndex)
+{
+   if ((aTargetIndex >= mSearchCulled.size()) || (!mSearchCulled[aTargetIndex]) || TargetHasActiveRequest(aTargetIndex))
+   {
+      return false;
+   }
+   WsfPlatform* targetPtr = mSensorPtr->GetSimulation()->GetPlatformByIndex(aTargetIndex);
+   if (targetPtr == nullptr)
+   {
+      return false; // Let the sensor process the deletion
+   }
+
+   // The sensor does not report false targets to the tracker (see WsfRadarSensor::ProcessTargetSelection),
+   // so the culled chance is not reported either.
+   if ((mTrackerPtr != nullptr) && (!targetPtr->IsFalseTarget()))
+   {
+      WsfSensorResult            result;
+      WsfSensorTracker::Settings stSettings;
+      result.mModeIndex     = mSearchModeIndex;
+      result.mCheckedStatus = WsfSensorResult::cRCVR_RANGE_LIMITS;
+      result.mFailedStatus  = WsfSensorResult::cRCVR_RANGE_LIMITS;
+      mTrackerPtr->TargetUndetected(aSimTime, stSettings, WsfTrackId(), aTargetIndex, targetPtr, result);
+   }
+   return true;
+}
+
+// =================================================================================================
+//! Return the target for the next search chance.
+//! The search culling is updated at the start of each pass through the search list.
+// protected
+size_t WsfDefaultSensorScheduler::SelectSearchTarget(double aSimTime)
+{
+   if (mSearchIndex >= mSearchList.size())
+   {
+      mSearchIndex = 0;
+   }
+   if (mSearchIndex == 0)
+   {
+      UpdateSearchCulling(aSimTime);
+   }
+   size_t targetIndex = mSearchList[mSearchIndex];
+   ++mSearchIndex;
+   return targetIndex;
+}
+
+// =================================================================================================
+//! Determine which targets in the search list are outside the envelope of the search mode.
+//!
+//! This is done at the start of each search frame. A target is culled if it is beyond the maximum
+//! range or outside the altitude limits of every receiver antenna of the search mode. The limits are
+//! expanded by the distance the target and sensor could move before the end of the frame, and the
+//! distance the target has moved since its position was last updated (both at their current speeds),
+//! so a target that the sensor could detect during the frame is not culled. The field of view is not
+//! used because it depends on the cueing and scanning of the antennas during the frame.
+// private
+void WsfDefaultSensorScheduler::UpdateSearchCulling(double aSimTime)
+{
+   mSearchCulled.clear();
+   if ((!mSearchCulling) || (!mSearchAllowed) || (mSearchFrameTime <= 0.0))
+   {
+      return;
+   }
+
+   struct Envelope
+   {
+      double mLocWCS[3];
+      double mMaxRange;
+      double mMinAlt;
+      double mMaxAlt;
+   };
+   std::vector<Envelope> envelopes;
+   WsfSensorMode*        modePtr = mModeList[mSearchModeIndex];
+   for (size_t beamIndex = 0; beamIndex < modePtr->GetBeamCount(); ++beamIndex)
+   {
+      WsfEM_Rcvr* rcvrPtr = modePtr->GetBeamEntry(beamIndex)->GetEM_Rcvr();
+      if ((rcvrPtr == nullptr) || (rcvrPtr->GetAntenna() == nullptr))
+      {
+         return; // The envelope is not known
+      }
+      WsfEM_Antenna* antennaPtr = rcvrPtr->GetAntenna();
+      Envelope       envelope;
+      double         lat;
+      double         lon;
+      double         alt;
+      antennaPtr->GetLocationWCS(envelope.mLocWCS);
+      antennaPtr->GetLocationLLA(lat, lon, alt);
+      envelope.mMaxRange = antennaPtr->GetMaximumRange();
+      envelope.mMinAlt   = alt + antennaPtr->GetMinimumAltitude();
+      envelope.mMaxAlt   = alt + antennaPtr->GetMaximumAltitude();
+      envelopes.push_back(envelope);
+   }
+   if (envelopes.empty())
+   {
+      return;
+   }
+
+   double sensorVelWCS[3];
+   mSensorPtr->GetPlatform()->GetVelocityWCS(sensorVelWCS);
+   double sensorMotion = UtVec3d::Magnitude(sensorVelWCS) * mSearchFrameTime;
+
+   WsfSimulation& sim = *mSensorPtr->GetSimulation();
+   for (size_t targetIndex : mSearchList)
+   {
+      WsfPlatform* targetPtr = sim.GetPlatformByIndex(targetIndex);
+      if (targetPtr == nullptr)
+      {
+         continue;
+      }
+
+      double targetLocWCS[3];
+      double targetVelWCS[3];
+      double lat;
+      double lon;
+      double alt;
+      targetPtr->GetLocationWCS(targetLocWCS);
+      targetPtr->GetLocationLLA(lat, lon, alt);
+      targetPtr->GetVelocityWCS(targetVelWCS);
+      double elapsedTime = std::max(aSimTime - targetPtr->GetLastUpdateTime(), 0.0) + mSearchFrameTime;
+      double margin      = UtVec3d::Magnitude(targetVelWCS) * elapsedTime + sensorMotion;
+
+      bool culled = true;
+      for (const Envelope& envelope : envelopes)
+      {
+         double maxRange = envelope.mMaxRange + margin;
+         if ((UtVec3d::Distance(targetLocWCS, envelope.mLocWCS) <= maxRange) &&
+             (alt >= (envelope.mMinAlt - margin)) && (alt <= (envelope.mMaxAlt + margin)))
+         {
+            culled = false;
+            break;
+         }
+      }
+      if (culled)
+      {
+         if (targetIndex >= mSearchCulled.size())
+         {
+            mSearchCulled.resize(targetIndex + 1, false);
+         }
+         mSearchCulled[targetIndex] = true;
+      }
+   }
+}
+
+// =================================================================================================
+//! Prepare for a detection chance for a track request.
+//! The mode of the request is selected in aSettings and the sensor is cued to the target.
+//! @returns The index of the target for the request.
+// protected
+size_t WsfDefaultSensorScheduler::CueRequest(double aSimTime, Request& aRequest, WsfSensor::Settings& aSettings)
+{
+   size_t targetIndex = SelectTargetForRequest(aRequest);
+
+   // Use the requested mode for the detection chance.
+   aSettings.mModeIndex = aRequest.mModeIndex;
+
+   // Get the position estimate for the cue.
+   // If there is a tracker then attempt to get it from the there.
+   // If there isn't a tracker or it doesn't have an estimate, then get it from the track supplied with the request.
+
+   double targetLocWCS[3];
+   bool   haveTargetState = false;
+   bool   adjustTargetCue = false;
+   if (mTrackerPtr != nullptr)
+   {
+      WsfSensorTracker::TargetState targetState;
+      if (mTrackerPtr->GetTargetState(aSimTime, aRequest.mRequestId, targetState))
+      {
+         haveTargetState = true;
+         UtVec3d::Set(targetLocWCS, targetState.mLocationWCS.GetData());
+         aSettings.mLockonTime = targetState.mLockonTime;
+         adjustTargetCue       = true; // The target cue is only adjusted from internal cues
+      }
+   }
+
+   if (!haveTargetState)
+   {
+      haveTargetState = aRequest.mTrack.GetExtrapolatedLocationWCS(aSimTime, targetLocWCS);
+   }
+
+   if (haveTargetState)
+   {
+      // This is really, really ugly, but absolutely necessary for long-range tracking sensors.
+      //
+      // The cue location reported by the tracker is the 'geometric location' of the perceived target rather than the
+      // 'apparent location' that accounts for atmospheric refraction. The difference typically isn't very much, but if
+      // the beam is very narrow, the ranges are long and the geometric location is used, the losses from not being in
+      // the center of the beam may be significant (a couple of dB). Thus, we must recover the 'apparent location'.
+      //
+      // Of course things don't work this way in real life (which uses ranges, angles, rates, etc.) But we really can't
+      // do that here because our detection rates are probably not as high as a real system, so running tracking filters
+      // and such is probably somewhat meaningless.
+      //
+      // At any rate, this takes care of the problem...
+      //
+      // For the current time, cuing for non-tracking sensors do not have this processing applied. They typically have wide
+      // enough beams or are scanners (which will be adjusted to point at the target), so it is not as issue.
+
+      if (adjustTargetCue)
+      {
+         if (mSensorPtr->GetEM_XmtrCount() > 0)
+         {
+            double earthRadiusScale = mSensorPtr->GetEM_Xmtr(0).GetEarthRadiusMultiplier();
+            if (earthRadiusScale != 1.0)
+            {
+               mSensorPtr->GetPlatform()->Update(aSimTime);
+               double sensorLocWCS[3];
+               mSensorPtr->GetLocationWCS(sensorLocWCS);
+               WsfEM_Util::ComputeApparentPosition(earthRadiusScale, sensorLocWCS, targetLocWCS, sensorLocWCS, targetLocWCS);
+            }
+         }
+      }
+      mSensorPtr->SetTransientCuedLocationWCS(targetLocWCS);
+   }
+   return targetIndex;
+}
+
 // =================================================================================================
 //! Check if the current mode selections provide for the ability to process search chances.
 // private
@@ -907,6 +1120,85 @@ void WsfDefaultSensorScheduler::DeselectMode(double aSimTime, Request& aRequest)
    }
 }
 
+// =================================================================================================
+//! Return the index into mRequestList of the request with the specified ID.
+//! @returns The index of the request, or mRequestList.size() if there is no such request.
+// private
+WsfDefaultSensorScheduler::RequestListIndex WsfDefaultSensorScheduler::FindRequest(const WsfTrackId& aRequestId) const
+{
+   auto iter = mRequestIdIndex.find(aRequestId);
+   return (iter != mRequestIdIndex.end()) ? iter->second : mRequestList.size();
+}
+
+// =================================================================================================
+//! Return the requests whose next visit time is not later than the specified time.
+//! Only the part of the visit heap that contains due requests is examined.
+//! @param aSimTime  The time against which the requests are checked.
+//! @param aRequests [output] The indices into mRequestList of the due requests, in ascending order.
+// protected
+void WsfDefaultSensorScheduler::FindDueRequests(double aSimTime, std::vector<RequestListIndex>& aRequests) const
+{
+   aRequests.clear();
+   if (mVisitHeap.empty() || (mRequestList[mVisitHeap[0]].mNextVisitTime > aSimTime))
+   {
+      return;
+   }
+
+   // The descendants of a request in the heap are never due before it, so the search stops at the first
+   // request that is not due. The heap positions of the due requests are collected first and then
+   // converted to request indices.
+   aRequests.push_back(0);
+   for (size_t i = 0; i < aRequests.size(); ++i)
+   {
+      size_t heapIndex = aRequests[i];
+      for (size_t childIndex = 2 * heapIndex + 1; (childIndex <= 2 * heapIndex + 2) && (childIndex < mVisitHeap.size());
+           ++childIndex)
+      {
+         if (mRequestList[mVisitHeap[childIndex]].mNextVisitTime <= aSimTime)
+         {
+            aRequests.push_back(childIndex);
+         }
+      }
+   }
+   for (RequestListIndex& index : aRequests)
+   {
+      index = mVisitHeap[index];
+   }
+   std::sort(aRequests.begin(), aRequests.end());
+}
+
+// =================================================================================================
+//! Rebuild the request ID index, target request counts and visit heap from mRequestList.
+// private
+void WsfDefaultSensorScheduler::RebuildRequestIndex()
+{
+   mRequestIdIndex.clear();
+   mTargetRequestCount.clear();
+   mVisitHeap.resize(mRequestList.size());
+   mVisitHeapPosition.resize(mRequestList.size());
+   for (RequestListIndex i = 0; i < mRequestList.size(); ++i)
+   {
+      mRequestIdIndex[mRequestList[i].mRequestId] = i;
+      ++mTargetRequestCount[mRequestList[i].mTargetIndex];
+      mVisitHeap[i]         = i;
+      mVisitHeapPosition[i] = i;
+   }
+   for (size_t i = mVisitHeap.size() / 2; i > 0; --i)
+   {
+      SiftVisitHeapDown(i - 1);
+   }
+}
+
+// =================================================================================================
+//! Restore the visit heap after the next visit time of a request has changed.
+// private
+void WsfDefaultSensorScheduler::RequestVisitTimeChanged(RequestListIndex aRequestIndex)
+{
+   size_t heapIndex = mVisitHeapPosition[aRequestIndex];
+   SiftVisitHeapUp(heapIndex);
+   SiftVisitHeapDown(mVisitHeapPosition[aRequestIndex]);
+}
+
 // =================================================================================================
 // private
 void WsfDefaultSensorScheduler::SelectMode(double aSimTime, Request& aRequest)
@@ -934,6 +1226,10 @@ void WsfDefaultSensorScheduler::ResetTrackList()
 {
    // Delete the track requests.
    mRequestList.clear();
+   mRequestIdIndex.clear();
+   mTargetRequestCount.clear();
+   mVisitHeap.clear();
+   mVisitHeapPosition.clear();
    mRequestIndex       = 0;
    mNextTrackVisitTime = 1.0E+30;
 }
@@ -946,7 +1242,16 @@ size_t WsfDefaultSensorScheduler::SelectTargetForRequest(Request& aRequest)
    if (targetIndex == 0)
    {
       // TODO Need to select a target index !!!
-      targetIndex           = aRequest.mTrack.GetTargetIndex();
+      targetIndex = aRequest.mTrack.GetTargetIndex();
+      if (targetIndex != aRequest.mTargetIndex)
+      {
+         auto tci = mTargetRequestCount.find(aRequest.mTargetIndex);
+         if ((tci != mTargetRequestCount.end()) && (--(tci->second) == 0))
+         {
+            mTargetRequestCount.erase(tci);
+         }
+         ++mTargetRequestCount[targetIndex];
+      }
       aRequest.mTargetIndex = targetIndex;
    }
    return targetIndex;
@@ -957,36 +1262,23 @@ size_t WsfDefaultSensorScheduler::SelectTargetForRequest(Request& aRequest)
 // private
 bool WsfDefaultSensorScheduler::TargetHasActiveRequest(size_t aTargetIndex) const
 {
-   if (!mRequestList.empty())
-   {
-      for (const auto& i : mRequestList)
-      {
-         if (i.mTargetIndex == aTargetIndex)
-         {
-            return true;
-         }
-      }
-   }
-   return false;
+   return (mTargetRequestCount.find(aTargetIndex) != mTargetRequestCount.end());
 }
 
 // =================================================================================================
 //! Update the time when the next track revisit should occur.
 //! Note that the 'next visit time' is the time that would occur if there were no interference.
-//! What we look for is the 'oldest' request (the one with the smallest next visit time).
-//! The visit time is then adjusted as required.
+//! What we look for is the 'oldest' request (the one with the smallest next visit time), which is
+//! at the top of the visit heap. The visit time is then adjusted as required.
 // private
 void WsfDefaultSensorScheduler::UpdateNextTrackVisitTime()
 {
    mNextTrackVisitTime = 1.0E+30;
    mRequestIndex       = mRequestList.size();
-   for (RequestListIndex i = 0; i < mRequestList.size(); ++i)
+   if ((!mVisitHeap.empty()) && (mRequestList[mVisitHeap[0]].mNextVisitTime <= mNextTrackVisitTime))
    {
-      if (mRequestList[i].mNextVisitTime <= mNextTrackVisitTime)
-      {
-         mNextTrackVisitTime = mRequestList[i].mNextVisitTime;
-         mRequestIndex       = i;
-      }
+      mRequestIndex       = mVisitHeap[0];
+      mNextTrackVisitTime = mRequestList[mRequestIndex].mNextVisitTime;
    }
 
    // If a request was selected, don't allow it to interfere with any dwell that
@@ -1043,3 +1335,62 @@ void WsfDefaultSensorScheduler::UpdateSearchFrameTime(double aSimTime)
       mSensorPtr->SetNextUpdateTime(aSimTime, nextUpdateTime);
    }
 }
+
+// =================================================================================================
+//! Return true if the request aLhs is to be visited before the request aRhs.
+//! Ties are broken in favor of the later request in mRequestList. This is the selection order of the
+//! original linear search, which is preserved so existing results do not change.
+// private
+bool WsfDefaultSensorScheduler::VisitsBefore(RequestListIndex aLhs, RequestListIndex aRhs) const
+{
+   double lhsTime = mRequestList[aLhs].mNextVisitTime;
+   double rhsTime = mRequestList[aRhs].mNextVisitTime;
+   return (lhsTime < rhsTime) || ((lhsTime == rhsTime) && (aLhs > aRhs));
+}
+
+// =================================================================================================
+// private
+void WsfDefaultSensorScheduler::SiftVisitHeapDown(size_t aHeapIndex)
+{
+   size_t heapSize = mVisitHeap.size();
+   while (true)
+   {
+      size_t firstIndex = aHeapIndex;
+      size_t leftIndex  = (2 * aHeapIndex) + 1;
+      size_t rightIndex = leftIndex + 1;
+      if ((leftIndex < heapSize) && VisitsBefore(mVisitHeap[leftIndex], mVisitHeap[firstIndex]))
+      {
+         firstIndex = leftIndex;
+      }
+      if ((rightIndex < heapSize) && VisitsBefore(mVisitHeap[rightIndex], mVisitHeap[firstIndex]))
+      {
+         firstIndex = rightIndex;
+      }
+      if (firstIndex == aHeapIndex)
+      {
+         break;
+      }
+      std::swap(mVisitHeap[aHeapIndex], mVisitHeap[firstIndex]);
+      mVisitHeapPosition[mVisitHeap[aHeapIndex]] = aHeapIndex;
+      mVisitHeapPosition[mVisitHeap[firstIndex]] = firstIndex;
+      aHeapIndex                                 = firstIndex;
+   }
+}
+
+// =================================================================================================
+// private
+void WsfDefaultSensorScheduler::SiftVisitHeapUp(size_t aHeapIndex)
+{
+   while (aHeapIndex > 0)
+   {
+      size_t parentIndex = (aHeapIndex - 1) / 2;
+      if (!VisitsBefore(mVisitHeap[aHeapIndex], mVisitHeap[parentIndex]))
+      {
+         break;
+      }
+      std::swap(mVisitHeap[aHeapIndex], mVisitHeap[parentIndex]);
+      mVisitHeapPosition[mVisitHeap[aHeapIndex]]  = aHeapIndex;
+      mVisitHeapPosition[mVisitHeap[parentIndex]] = parentIndex;
+      aHeapIndex                                  = parentIndex;
+   }
+}
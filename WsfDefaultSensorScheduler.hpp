@@ -14,6 +14,8 @@
 
 #include "wsf_export.h"
 
+#include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "WsfSensorScheduler.hpp"
@@ -82,8 +84,7 @@ public:
    void TurnOn(double aSimTime) override;
 
    //! A class that represents an external cue request.
-   //! This must be public (even though the actual list is private) because
-   //! it must be accessible to a functor.
+   //! This is public so the request list can be inspected through GetRequestList.
    class Request
    {
    public:
@@ -138,16 +139,32 @@ protected:
    WsfDefaultSensorScheduler(const WsfDefaultSensorScheduler& aSrc);
    WsfDefaultSensorScheduler& operator=(const WsfDefaultSensorScheduler&) = delete;
 
+   void CheckSearchList(double aSimTime);
+
    void CheckSearchModeAvailability();
 
+   size_t CueRequest(double aSimTime, Request& aRequest, WsfSensor::Settings& aSettings);
+
+   bool CullSearchTarget(double aSimTime, size_t aTargetIndex);
+
    void DeselectMode(double aSimTime, Request& aRequest);
 
+   void FindDueRequests(double aSimTime, std::vector<RequestListIndex>& aRequests) const;
+
+   RequestListIndex FindRequest(const WsfTrackId& aRequestId) const;
+
+   void RebuildRequestIndex();
+
+   void RequestVisitTimeChanged(RequestListIndex aRequestIndex);
+
    void SelectMode(double aSimTime, Request& aRequest);
 
    void ResetTrackList();
 
    void ResetSearchList();
 
+   size_t SelectSearchTarget(double aSimTime);
+
    size_t SelectTargetForRequest(Request& aRequest);
 
    bool TargetHasActiveRequest(size_t aTargetIndex) const;
@@ -156,23 +173,15 @@ protected:
 
    void UpdateSearchChanceInterval();
 
+   void UpdateSearchCulling(double aSimTime);
+
    void UpdateSearchFrameTime(double aSimTime);
 
+   bool VisitsBefore(RequestListIndex aLhs, RequestListIndex aRhs) const;
 
-   //! A Functor for locating a track request.
-   class CompareRequestId
-   {
-   public:
-      CompareRequestId(const WsfTrackId& aRequestId)
-         : mRequestId(aRequestId)
-      {
-      }
+   void SiftVisitHeapDown(size_t aHeapIndex);
 
-      bool operator()(const Request& aRequest) const { return (aRequest.mRequestId == mRequestId); }
-
-   private:
-      WsfTrackId mRequestId;
-   };
+   void SiftVisitHeapUp(size_t aHeapIndex);
 
    //! The pointers to the sensor modes, indexed by mode index.
    std::vector<WsfSensorMode*> mModeList;
@@ -192,6 +201,18 @@ protected:
    //! The index of the next request to be performed.
    RequestListIndex mRequestIndex;
 
+   //! The index into mRequestList of each request, by request ID.
+   std::map<WsfTrackId, RequestListIndex> mRequestIdIndex;
+
+   //! The number of requests against each target index.
+   std::unordered_map<size_t, unsigned int> mTargetRequestCount;
+
+   //! A binary min-heap of indices into mRequestList, ordered as defined by VisitsBefore.
+   std::vector<RequestListIndex> mVisitHeap;
+
+   //! The position within mVisitHeap of each request (indexed by the index into mRequestList).
+   std::vector<size_t> mVisitHeapPosition;
+
    //! The last mode explicitly selected (i.e.: via WsfSensor::SelectMode).
    size_t mLastExplicitModeIndex;
 
@@ -208,6 +229,12 @@ protected:
 
    //! How scan chances are added to the search list
    ScanSchedulingMethod mScanSchedulingMethod;
+
+   //! 'true' if search chances for targets outside the envelope of the search mode are culled.
+   bool mSearchCulling;
+
+   //! 'true' for each target culled in the current search frame (indexed by target index).
+   std::vector<bool> mSearchCulled;
 };
 
 #endif
@@ -41,6 +41,15 @@
 #include "WsfTrack.hpp"
 #include "WsfTrackList.hpp"
 
+namespace
+{
+//! Ordering predicate for locating an object index in the sorted state list.
+bool StateKeyLess(const std::pair<size_t, WsfDefaultSensorTracker::State*>& aEntry, size_t aObjectId)
+{
+   return aEntry.first < aObjectId;
+}
+}
+
 // =================================================================================================
 WsfDefaultSensorTracker::WsfDefaultSensorTracker(WsfScenario& aScenario)
    : WsfSensorTracker()
@@ -50,6 +59,9 @@ WsfDefaultSensorTracker::WsfDefaultSensorTracker(WsfScenario& aScenario)
    , mFilterPtr(nullptr)
    , mModeList()
    , mStateList()
+   , mStatePool()
+   , mStateReuseCount(0)
+   , mReuseFilters(false)
    , mSendTrackDropOnTurnOff(false)
    , mTurnOffInProgress(false)
 {
@@ -64,6 +76,9 @@ WsfDefaultSensorTracker::WsfDefaultSensorTracker(const WsfDefaultSensorTracker&
    , mFilterPtr(nullptr)
    , mModeList()
    , mStateList()
+   , mStatePool()
+   , mStateReuseCount(0)
+   , mReuseFilters(aSrc.mReuseFilters)
    , mSendTrackDropOnTurnOff(aSrc.mSendTrackDropOnTurnOff)
    , mTurnOffInProgress(false)
 {
@@ -82,6 +97,10 @@ WsfDefaultSensorTracker::~WsfDefaultSensorTracker()
    {
       delete sli.second;
    }
+   for (State* statePtr : mStatePool)
+   {
+      delete statePtr;
+   }
 }
 
 // =================================================================================================
@@ -176,12 +195,11 @@ void WsfDefaultSensorTracker::GetRequestDataForTarget(size_t      aObjectId,
                                                       size_t&     aModeIndex,
                                                       WsfTrackId& aTrackId) const
 {
-   auto sli = mStateList.find(aObjectId);
-   if (sli != mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr != nullptr)
    {
-      State* statePtr = sli->second;
-      aRequestId      = statePtr->mRequestId;
-      aModeIndex      = statePtr->mModeIndex;
+      aRequestId = statePtr->mRequestId;
+      aModeIndex = statePtr->mModeIndex;
       aTrackId.Null();
       if (statePtr->mTrackPtr != nullptr)
       {
@@ -225,6 +243,10 @@ bool WsfDefaultSensorTracker::ProcessInput(UtInput& aInput)
    {
       aInput.ReadValue(mSendTrackDropOnTurnOff);
    }
+   else if (command == "reuse_filters")
+   {
+      aInput.ReadValue(mReuseFilters);
+   }
    else if (WsfFilterTypes::Get(*GetScenario()).LoadInstance(aInput, filterPtr))
    {
       delete mFilterPtr;
@@ -245,10 +267,9 @@ void WsfDefaultSensorTracker::SchedulerModeChange(double            aSimTime,
                                                   WsfPlatform*      aTargetPtr,
                                                   WsfStringId       aNewModeName)
 {
-   auto sli = mStateList.find(aObjectId);
-   if (sli != mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr != nullptr)
    {
-      State* statePtr     = sli->second;
       size_t newModeIndex = mSensorPtr->GetModeList()->GetModeByName(aNewModeName);
       if (newModeIndex < mSensorPtr->GetModeList()->GetModeCount())
       {
@@ -283,14 +304,13 @@ void WsfDefaultSensorTracker::StopTracking(double aSimTime, const WsfTrackId& aR
    // Now go back and process the applicable targets.
    for (size_t objectKey : objectKeys)
    {
-      auto sli = mStateList.find(objectKey);
-      if (sli != mStateList.end())
+      State* statePtr = FindState(objectKey);
+      if (statePtr != nullptr)
       {
          // NOTE - the order of operations is important to avoid problems with callbacks.
-         State* statePtr = (*sli).second;
-         mStateList.erase(sli);         // 1...
-         DropTrack(aSimTime, statePtr); // 2...
-         delete statePtr;               // 3...
+         RemoveState(objectKey, statePtr); // 1...
+         DropTrack(aSimTime, statePtr);    // 2...
+         ReleaseState(statePtr);           // 3...
       }
    }
 }
@@ -302,10 +322,9 @@ void WsfDefaultSensorTracker::TargetBlocked(double            aSimTime,
                                             const WsfTrackId& aRequestId,
                                             unsigned int      aObjectId)
 {
-   auto sli = mStateList.find((int)aObjectId);
-   if (sli != mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr != nullptr)
    {
-      State* statePtr = (*sli).second;
       if (statePtr->mTrackPtr != nullptr)
       {
          WsfSensorMode* modePtr = GetSensor()->GetModeEntry(statePtr->mModeIndex);
@@ -329,10 +348,9 @@ bool WsfDefaultSensorTracker::TargetDeleted(double            aSimTime,
    // a track is being maintained, then we must not delete the track until it has
    // failed the M/N criteria.
 
-   auto sli = mStateList.find(aObjectId);
-   if (sli != mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr != nullptr)
    {
-      State* statePtr = sli->second;
       assert(statePtr->mModeIndex < mSensorPtr->GetModeCount());
 
       // Unless suppressed, inform observers of change in detection status.
@@ -358,10 +376,10 @@ bool WsfDefaultSensorTracker::TargetDeleted(double            aSimTime,
          if (dropTrack)
          {
             // NOTE - The order of operations is important to avoid problems with callbacks.
-            mStateList.erase(sli); // 1...
+            RemoveState(aObjectId, statePtr); // 1...
             DropTrackP(aSimTime, aSettings, aRequestId, aObjectId, modePtr, statePtr->mTrackPtr);
             DropTrack(aSimTime, statePtr); // 2...
-            delete statePtr;               // 3...
+            ReleaseState(statePtr);        // 3...
          }
          else
          {
@@ -386,17 +404,11 @@ void WsfDefaultSensorTracker::TargetDetected(double            aSimTime,
    // Locate the state data for the requested object ID.  If no data exists then create
    // and initialize state data for the object.
 
-   State* statePtr = nullptr;
-   auto   sli      = mStateList.find(aObjectId);
-   if (sli == mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr == nullptr)
    {
       // State data does not exist for this target.  Create and initialize new state data.
-      statePtr = new State(aRequestId, aResult);
-      mStateList.insert(std::make_pair(aObjectId, statePtr));
-   }
-   else
-   {
-      statePtr = sli->second;
+      statePtr = CreateState(aObjectId, aRequestId, aResult);
    }
 
    // Check for a possible mode switch.
@@ -416,11 +428,12 @@ void WsfDefaultSensorTracker::TargetDetected(double            aSimTime,
    // Allow a component to reject the detection.
    if (!AllowTrackingP(aSimTime, aSettings, aRequestId, aObjectId, statePtr->mTrackPtr, aResult))
    {
-      sli = mStateList.find(aObjectId);
       DropTrackP(aSimTime, aSettings, aRequestId, aObjectId, modePtr, statePtr->mTrackPtr);
       DropTrack(aSimTime, statePtr);
-      mStateList.erase(sli);
-      delete statePtr;
+      if (RemoveState(aObjectId, statePtr))
+      {
+         ReleaseState(statePtr);
+      }
       return;
    }
 
@@ -622,10 +635,9 @@ bool WsfDefaultSensorTracker::TargetSkipped(double            aSimTime,
    // a track is being maintained, then we must not delete the track until it has
    // failed the M/N criteria.
 
-   auto sli = mStateList.find(aObjectId);
-   if (sli != mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr != nullptr)
    {
-      State* statePtr = sli->second;
       assert(statePtr->mModeIndex < mSensorPtr->GetModeCount());
       WsfSensorMode* modePtr      = mModeList[statePtr->mModeIndex];
       statePtr->mDetectionHistory = (statePtr->mDetectionHistory << 1);
@@ -641,10 +653,10 @@ bool WsfDefaultSensorTracker::TargetSkipped(double            aSimTime,
          if (shouldDropTrack)
          {
             // NOTE - The order of operations is important to avoid problems with callbacks.
-            mStateList.erase(sli); // 1...
+            RemoveState(aObjectId, statePtr); // 1...
             DropTrackP(aSimTime, aSettings, aRequestId, aObjectId, modePtr, statePtr->mTrackPtr);
             DropTrack(aSimTime, statePtr); // 2...
-            delete statePtr;               // 3...
+            ReleaseState(statePtr);        // 3...
          }
          else
          {
@@ -653,8 +665,8 @@ bool WsfDefaultSensorTracker::TargetSkipped(double            aSimTime,
       }
       else
       {
-         mStateList.erase(sli);
-         delete statePtr;
+         RemoveState(aObjectId, statePtr);
+         ReleaseState(statePtr);
       }
    }
 
@@ -670,12 +682,11 @@ void WsfDefaultSensorTracker::TargetUndetected(double            aSimTime,
                                                WsfPlatform*      aTargetPtr,
                                                WsfSensorResult&  aResult)
 {
-   auto sli = mStateList.find(aObjectId);
-   if (sli == mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr == nullptr)
    {
       return;
    }
-   State* statePtr = sli->second;
 
    // Check for a possible mode switch.
    // TODO - should this be for tracking requests only??? What about simple mode switches for things like
@@ -819,18 +830,16 @@ void WsfDefaultSensorTracker::TurnOff(double aSimTime)
    mStateList.clear();
 
    mTurnOffInProgress = true;
-   while (!tempStateData.empty())
+   for (auto& sli : tempStateData)
    {
-      auto   sli      = tempStateData.begin();
-      State* statePtr = (*sli).second;     // 1...
-      tempStateData.erase(sli);            // 2...
+      State* statePtr = sli.second;        // 1...
       if (statePtr->mDetectionHistory & 1) // currently detected
       {
          ProcessSensorDetectionChanged(aSimTime, *statePtr,
-                                       WsfSensorResult::cDETECTION_STOP); // 3...
+                                       WsfSensorResult::cDETECTION_STOP); // 2...
       }
-      DropTrack(aSimTime, statePtr); // 4...
-      delete statePtr;               // 5...
+      DropTrack(aSimTime, statePtr); // 3...
+      ReleaseState(statePtr);        // 4...
    }
    mTurnOffInProgress = false;
    mActiveTrackCount  = 0;
@@ -840,6 +849,87 @@ void WsfDefaultSensorTracker::TurnOff(double aSimTime)
 // Start of methods that are not part of the public interface
 // =================================================================================================
 
+// =================================================================================================
+//! Locate the state data for the specified object.
+//! @param aObjectId The object index of the target.
+//! @return The state data, or nullptr if there is no state data for the object.
+// protected
+WsfDefaultSensorTracker::State* WsfDefaultSensorTracker::FindState(size_t aObjectId) const
+{
+   auto sli = std::lower_bound(mStateList.begin(), mStateList.end(), aObjectId, StateKeyLess);
+   if ((sli != mStateList.end()) && (sli->first == aObjectId))
+   {
+      return sli->second;
+   }
+   return nullptr;
+}
+
+// =================================================================================================
+//! Create the state data for the specified object and add it to the state list.
+//! A previously released state is reused if one is available.
+//! @param aObjectId  The object index of the target (there must not already be state data for the object).
+//! @param aRequestId The sensor scheduler request ID associated with the interaction.
+//! @param aResult    The result of the detection attempt that is creating the state.
+//! @return The new state data.
+// protected
+WsfDefaultSensorTracker::State* WsfDefaultSensorTracker::CreateState(size_t                   aObjectId,
+                                                                     const WsfTrackId&        aRequestId,
+                                                                     const WsfSensor::Result& aResult)
+{
+   State* statePtr = nullptr;
+   if (!mStatePool.empty())
+   {
+      statePtr = mStatePool.back();
+      mStatePool.pop_back();
+      statePtr->Reset(aRequestId, aResult);
+      ++mStateReuseCount;
+   }
+   else
+   {
+      statePtr = new State(aRequestId, aResult);
+   }
+
+   auto sli = std::lower_bound(mStateList.begin(), mStateList.end(), aObjectId, StateKeyLess);
+   assert((sli == mStateList.end()) || (sli->first != aObjectId));
+   mStateList.insert(sli, std::make_pair(aObjectId, statePtr));
+   return statePtr;
+}
+
+// =================================================================================================
+//! Remove the state data for the specified object from the state list.
+//! The state itself is not released (see ReleaseState).
+//! @param aObjectId The object index of the target.
+//! @param aStatePtr The state data expected for the object.
+//! @return true if the entry existed and referenced aStatePtr.
+// protected
+bool WsfDefaultSensorTracker::RemoveState(size_t aObjectId, const State* aStatePtr)
+{
+   auto sli = std::lower_bound(mStateList.begin(), mStateList.end(), aObjectId, StateKeyLess);
+   if ((sli != mStateList.end()) && (sli->first == aObjectId) && (sli->second == aStatePtr))
+   {
+      mStateList.erase(sli);
+      return true;
+   }
+   return false;
+}
+
+// =================================================================================================
+//! Return a state that is no longer in the state list to the pool for reuse.
+//! Any remaining track is deleted. The filter is deleted unless 'reuse_filters' was specified.
+//! @param aStatePtr The state to be released.
+// protected
+void WsfDefaultSensorTracker::ReleaseState(State* aStatePtr)
+{
+   delete aStatePtr->mTrackPtr;
+   aStatePtr->mTrackPtr = nullptr;
+   if (!mReuseFilters)
+   {
+      delete aStatePtr->mFilterPtr;
+      aStatePtr->mFilterPtr = nullptr;
+   }
+   mStatePool.push_back(aStatePtr);
+}
+
 // =================================================================================================
 //! Drop the track that may be attached with the specified state.
 //! This routine does nothing if there is not a track that is attached to the state.
@@ -880,10 +970,9 @@ void WsfDefaultSensorTracker::CheckForAutoModeSwitch(double aSimTime, size_t aOb
    // NOTE: If this was called as the result of dropping a track, the call to DropTrack may have resulted in
    // callbacks to which may themselves that end up canceling the tracking request and the eventual deleting
    // of the state object. Therefore we must make sure it still exists prior to actually performing any mode switch.
-   auto sli = mStateList.find(aObjectId);
-   if (sli != mStateList.end())
+   State* statePtr = FindState(aObjectId);
+   if (statePtr != nullptr)
    {
-      State* statePtr = sli->second;
       if (SwitchMode(aSimTime, statePtr, aNewModeIndex))
       {
          // Notify the scheduler of the mode switch.
@@ -993,3 +1082,27 @@ WsfDefaultSensorTracker::State::~State()
    delete mFilterPtr;
    delete mTrackPtr;
 }
+
+//! Reinitialize a released state for a new sensor-target interaction.
+//! The filter (if any) is retained; it is reset when the first detection is processed.
+void WsfDefaultSensorTracker::State::Reset(const WsfTrackId& aRequestId, const WsfSensor::Result& aResult)
+{
+   delete mTrackPtr;
+   mTrackPtr          = nullptr;
+   mRequestId         = aRequestId;
+   mLockonTime        = -1.0;
+   mTargetIndex       = cINVALID_TARGET_INDEX;
+   mModeIndex         = aResult.mModeIndex;
+   mXmtrIndex         = aResult.mXmtrIndex;
+   mRcvrIndex         = aResult.mRcvrIndex;
+   mDetectionHistory  = 0;
+   mFailuresUntilDrop = -1;
+   mModeSwitchActive  = false;
+   mFalseTargetTrack  = false;
+
+   const WsfPlatform* targetPtr = aResult.GetTarget();
+   if (targetPtr != nullptr)
+   {
+      mTargetIndex = targetPtr->GetIndex();
+   }
+}
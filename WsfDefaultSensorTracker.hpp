@@ -14,7 +14,8 @@
 
 #include "wsf_export.h"
 
-#include <map>
+#include <utility>
+#include <vector>
 
 class WsfFilter;
 #include "WsfSensor.hpp"
@@ -83,6 +84,18 @@ public:
 
    WsfScenario* GetScenario() const { return mScenarioPtr; }
 
+   //! @name State storage counters (for profiling).
+   //@{
+   //! Return the number of active sensor-target interaction states.
+   size_t GetStateCount() const { return mStateList.size(); }
+
+   //! Return the number of released states that are available for reuse.
+   size_t GetStatePoolSize() const { return mStatePool.size(); }
+
+   //! Return the number of states that were taken from the pool rather than allocated.
+   size_t GetStateReuseCount() const { return mStateReuseCount; }
+   //@}
+
    //! Used to store state data about the interaction between a sensor and a target
    class WSF_EXPORT State
    {
@@ -90,6 +103,8 @@ public:
       State(const WsfTrackId& aRequestId, const WsfSensor::Result& aResult);
       ~State();
 
+      void Reset(const WsfTrackId& aRequestId, const WsfSensor::Result& aResult);
+
       //! The sensor scheduler request ID associated with the interaction
       WsfTrackId mRequestId;
 
@@ -147,6 +162,14 @@ protected:
 
    void ProcessSensorDetectionChanged(double aSimTime, const State& aState, unsigned int aStatus);
 
+   State* FindState(size_t aObjectId) const;
+
+   State* CreateState(size_t aObjectId, const WsfTrackId& aRequestId, const WsfSensor::Result& aResult);
+
+   bool RemoveState(size_t aObjectId, const State* aStatePtr);
+
+   void ReleaseState(State* aStatePtr);
+
    WsfScenario* mScenarioPtr;
 
    //! The maximum number of tracks that can be maintained by the tracker.
@@ -162,15 +185,27 @@ protected:
    //! The pointers to the sensor modes, indexed by mode index.
    std::vector<WsfSensorMode*> mModeList;
 
-   //! The state data for active sensor-target interactions.
+   //! The state data for active sensor-target interactions, sorted by key.
    //! The key value is the object index of the target (which may be a platform index or any other
    //! index that is unique among all objects of that type.
-   using StateList = std::map<size_t, State*>;
+   //! A sorted vector is used so that adding and removing entries does not allocate once the
+   //! vector has grown, while still iterating in key order.
+   using StateList = std::vector<std::pair<size_t, State*>>;
    StateList mStateList;
 
    //! An iterator for accessing state data.
    using StateListIter = StateList::iterator;
 
+   //! Released states that may be reused by CreateState.
+   std::vector<State*> mStatePool;
+
+   //! The number of states that were taken from mStatePool.
+   size_t mStateReuseCount;
+
+   //! 'true' if a released state should keep its filter for reuse by the next state.
+   //! The filter is then restarted with WsfFilter::Reset rather than being cloned from the prototype.
+   bool mReuseFilters;
+
    //! 'true' if 'Track Drop' messages should be sent when the sensor is turned off.
    bool mSendTrackDropOnTurnOff;
 
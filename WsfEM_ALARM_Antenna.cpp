@@ -42,6 +42,8 @@ antenna::antenna(WsfEM_XmtrRcvr* aXmtrRcvrPtr, WsfEM_Interaction& aInteraction,
    , mEBS_El(0.0)
    , az_point_ang_rad(0.0)
    , el_point_ang_rad(0.0)
+   , cued_az(0.0)
+   , cued_el(0.0)
 {
    // This is a mess, but we need to get the pointing angles in the ALARM coordinate system.
    // The only way to do this is to emulate WsfAntenna::ComputeBeamPosition.
@@ -149,6 +151,8 @@ antenna::antenna(WsfEM_XmtrRcvr* aXmtrRcvrPtr, WsfEM_Interaction& aInteraction,
 
    double absCuedAz = UtMath::NormalizeAngleMinus180_180(absUncuedAz + cuedAz);
    double absCuedEl = absUncuedEl + cuedEl;
+   cued_az          = absCuedAz;
+   cued_el          = absCuedEl;
 
    // Compute the aspect angles of the target with respect to the cued antenna position.
 
@@ -296,6 +300,16 @@ double antenna::get_az_point_ang()
    return az_point_ang_rad;
 }
 
+double antenna::get_cued_az()
+{
+   return cued_az;
+}
+
+double antenna::get_cued_el()
+{
+   return cued_el;
+}
+
 double antenna::get_height_agl()
 {
    double lat, lon, alt;
@@ -491,6 +505,16 @@ double get_az_point_ang(antenna& ant_data)
    return ant_data.get_az_point_ang();
 }
 
+double get_cued_az(antenna& ant_data)
+{
+   return ant_data.get_cued_az();
+}
+
+double get_cued_el(antenna& ant_data)
+{
+   return ant_data.get_cued_el();
+}
+
 double get_height_agl(antenna& ant_data)
 {
    return ant_data.get_height_agl();
@@ -25,6 +25,8 @@ public:
    antenna(WsfEM_XmtrRcvr* aXmtrRcvrPtr, WsfEM_Interaction& aInteraction, double tgt_az, double tgt_el, double slant_range);
 
    double get_az_point_ang();
+   double get_cued_az();
+   double get_cued_el();
    double get_height_agl();
    double get_height_msl();
    void   get_relative_gain(double  az_angle,  // in, radians
@@ -41,9 +43,13 @@ private:
 
    double az_point_ang_rad;
    double el_point_ang_rad;
+   double cued_az;          // absolute azimuth of the cued (unscanned) antenna
+   double cued_el;          // absolute elevation of the cued (unscanned) antenna
 };
 
 double get_az_point_ang(antenna& ant_data);
+double get_cued_az(antenna& ant_data);
+double get_cued_el(antenna& ant_data);
 double get_height_agl(antenna& ant_data);
 double get_height_msl(antenna& ant_data);
 void   get_relative_gain(antenna& ant_data,
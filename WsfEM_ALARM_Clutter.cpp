@@ -23,8 +23,9 @@
 #include "WsfArticulatedPart.hpp"
 #include "WsfEM_ALARM_Antenna.hpp"
 #include "WsfEM_ALARM_Attenuation.hpp"
+#include "WsfEM_ALARM_ClutterMap.hpp"
 #include "WsfEM_ALARM_Fortran.hpp"
-#include "WsfEM_ALARM_Geometry.hpp"
+#include "WsfEM_ALARM_InteractionData.hpp"
 #include "WsfEM_ALARM_Terrain.hpp"
 #include "WsfEM_Interaction.hpp"
 #include "WsfEM_Rcvr.hpp"
@@ -80,17 +81,6 @@ const int ilflc[WsfEM_ALARM_Clutter::max_covers][WsfEM_ALARM_Clutter::max_forms]
    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1}};
 } // namespace
 
-int                 WsfEM_ALARM_Clutter::aprofile = 0;
-bool                WsfEM_ALARM_Clutter::uninit   = true;
-std::vector<int>    WsfEM_ALARM_Clutter::iend;
-std::vector<int>    WsfEM_ALARM_Clutter::istart;
-std::vector<bool>   WsfEM_ALARM_Clutter::visibl;
-std::vector<double> WsfEM_ALARM_Clutter::elvmsl;
-std::vector<double> WsfEM_ALARM_Clutter::rngter; // 0:
-std::vector<double> WsfEM_ALARM_Clutter::tanepp;
-std::vector<double> WsfEM_ALARM_Clutter::xprofl; // 0:
-std::vector<double> WsfEM_ALARM_Clutter::zprofl; // 0
-
 // =================================================================================================
 WsfEM_ALARM_Clutter::WsfEM_ALARM_Clutter()
    : WsfEM_Clutter()
@@ -124,6 +114,9 @@ WsfEM_ALARM_Clutter::WsfEM_ALARM_Clutter()
    , mWSF_LandForm(WsfEnvironment::cLEVEL)
    , mWSF_SeaState(WsfEnvironment::cCALM_GLASSY)
    , mUseSALRAM_DataTables(false)
+   , mPrecomputeClutterMap(false)
+   , mProfileCacheOptions()
+   , mClutterMap()
    , mSimulationPtr(nullptr)
 {
 }
@@ -156,6 +149,9 @@ WsfEM_ALARM_Clutter::WsfEM_ALARM_Clutter(const WsfEM_ALARM_Clutter& aSrc)
    , mWSF_LandForm(aSrc.mWSF_LandForm)
    , mWSF_SeaState(aSrc.mWSF_SeaState)
    , mUseSALRAM_DataTables(aSrc.mUseSALRAM_DataTables)
+   , mPrecomputeClutterMap(aSrc.mPrecomputeClutterMap)
+   , mProfileCacheOptions(aSrc.mProfileCacheOptions)
+   , mClutterMap() // each copy builds its own map
    , mSimulationPtr(aSrc.mSimulationPtr)
 {
 }
@@ -178,16 +174,7 @@ WsfEM_Clutter* WsfEM_ALARM_Clutter::ObjectFactory(const std::string& aTypeName)
 // static
 void WsfEM_ALARM_Clutter::ResetState()
 {
-   aprofile = 0;
-   uninit   = true;
-   iend.clear();
-   istart.clear();
-   visibl.clear();
-   elvmsl.clear();
-   rngter.clear();
-   tanepp.clear();
-   xprofl.clear();
-   zprofl.clear();
+   WsfEM_ALARM_Terrain::GetThreadContext().mClutterProfile.Clear();
 }
 
 // =================================================================================================
@@ -459,6 +446,24 @@ bool WsfEM_ALARM_Clutter::ProcessInput(UtInput& aInput)
       aInput.ReadValue(useAFSIM_TerrainMasking);
       WsfEM_ALARM_Terrain::SetUseAFSIM_TerrainMasking(useAFSIM_TerrainMasking);
    }
+   else if (command == "precompute_clutter_map")
+   {
+      aInput.ReadValue(mPrecomputeClutterMap);
+   }
+   else if (command == "terrain_profile_cache_size")
+   {
+      int cacheSize;
+      aInput.ReadValue(cacheSize);
+      aInput.ValueGreaterOrEqual(cacheSize, 0);
+      mProfileCacheOptions.mSize = static_cast<unsigned int>(cacheSize);
+   }
+   else if (command == "terrain_profile_cache_azimuth_resolution")
+   {
+      double resolution;
+      aInput.ReadValueOfType(resolution, UtInput::cANGLE);
+      aInput.ValueGreaterOrEqual(resolution, 0.0);
+      mProfileCacheOptions.mAzimuthResolution = resolution;
+   }
    else
    {
       myCommand = WsfEM_Clutter::ProcessInput(aInput);
@@ -482,7 +487,7 @@ double WsfEM_ALARM_Clutter::ComputeClutterPower(WsfEM_Interaction& aInteraction,
       return 0.0;
    }
 
-   WsfEM_ALARM_Terrain::Initialize(targetPtr->GetTerrain());
+   WsfEM_ALARM_Terrain::GetThreadContext().Initialize(targetPtr->GetTerrain());
 
    // This model is computationally intensive and should be avoided if possible.
    // If calculations shortcuts are allowed and if the current signal-to-noise is low,
@@ -544,43 +549,16 @@ double WsfEM_ALARM_Clutter::ComputeClutterPower(WsfEM_Interaction& aInteraction,
       return 0.0;
    }
 
-   // Compute the geometry as it is computed in ALARM (geomtr.f90).
-
-   double rdr_lat;
-   double rdr_lon;
-   double rdr_alt_msl;
-   double tgt_lat;
-   double tgt_lon;
-   double tgt_alt_msl;
-   double rkfact;
-   double tgt_x;
-   double tgt_z;
-   double tgt_az;
-   double tgt_el;
-   double tanept;
-   double slant_range;
-   double ground_range;
-
-   WsfEM_ALARM_Geometry::ComputeGeometry(xmtrPtr,
-                                         targetPtr,
-                                         xmtrPtr,
-                                         rdr_alt_msl,
-                                         rdr_lat,
-                                         rdr_lon,
-                                         rkfact,
-                                         tgt_alt_msl,
-                                         tgt_lat,
-                                         tgt_lon,
-                                         ground_range,
-                                         tanept,
-                                         slant_range,
-                                         tgt_az,
-                                         tgt_el,
-                                         tgt_x,
-                                         tgt_z);
-
-   antenna tx_ant(xmtrPtr, aInteraction, tgt_az, tgt_el, slant_range);
-   antenna rx_ant(rcvrPtr, aInteraction, tgt_az, tgt_el, slant_range);
+   // The geometry (as computed in ALARM geomtr.f90), antennas and atmosphere are shared with ALARM propagation.
+   WsfEM_ALARM_InteractionData& alarmData = WsfEM_ALARM_InteractionData::Get(aInteraction);
+
+   double rdr_lat     = alarmData.rdr_lat;
+   double rdr_lon     = alarmData.rdr_lon;
+   double rkfact      = alarmData.rkfact;
+   double slant_range = alarmData.slant_range;
+
+   antenna& tx_ant = alarmData.tx_ant();
+   antenna& rx_ant = alarmData.rx_ant();
 
    // NOTE-BOEING
    // If the azimuth increment is zero then it only a single mainbeam sample is performed.
@@ -668,10 +646,10 @@ double WsfEM_ALARM_Clutter::ComputeClutterPower(WsfEM_Interaction& aInteraction,
    //===========================================================================
 
    mPolarizationVertical = xmtrPtr->GetPolarization() == WsfEM_Types::cPOL_VERTICAL;
-   atmosphere atm_data(xmtrPtr);
-   double     freqin     = xmtrPtr->GetFrequency() * 1.0E-6; // MHz
-   double     radar_proc = aProcessingFactor;
-   double     sigclt;
+   atmosphere& atm_data   = alarmData.atm_data();
+   double      freqin     = xmtrPtr->GetFrequency() * 1.0E-6; // MHz
+   double      radar_proc = aProcessingFactor;
+   double      sigclt;
    /*call*/ clutter_signal_comp(ctauo2,
                                 ctauo4,
                                 freqin,
@@ -873,9 +851,7 @@ void WsfEM_ALARM_Clutter::clutter_signal_comp(double      ctauo2,
    double ztenna_tx;
    double offaz_tx;
 
-   const int hunk = 512;
-
-   // moved to header
+   // moved to the terrain context
    // static int                 aprofile = 0;
    // static bool                uninit = true;
    // static std::vector<int>    iend;
@@ -886,9 +862,18 @@ void WsfEM_ALARM_Clutter::clutter_signal_comp(double      ctauo2,
    // static std::vector<double> tanepp;
    // static std::vector<double> xprofl;     // 0:
    // static std::vector<double> zprofl;     // 0:
-   // BA
-   static std::vector<int> lcprofl;
-   // BA
+   // static std::vector<int>    lcprofl;
+   WsfEM_ALARM_Terrain::Context& context = WsfEM_ALARM_Terrain::GetThreadContext();
+   WsfEM_ALARM_Terrain::Profile& profile = context.mClutterProfile;
+   std::vector<int>&             iend    = profile.iend;
+   std::vector<int>&             istart  = profile.istart;
+   std::vector<bool>&            visibl  = profile.visibl;
+   std::vector<double>&          elvmsl  = profile.elvmsl;
+   std::vector<double>&          rngter  = profile.rngter;
+   std::vector<double>&          tanepp  = profile.tanepp;
+   std::vector<double>&          xprofl  = profile.xprofl;
+   std::vector<double>&          zprofl  = profile.zprofl;
+   std::vector<int>&             lcprofl = profile.lcprofl;
 
    //-------------------------------------------------------------------
    // Initialize SIGCLT, the clutter signal in milliwatts, to zero.
@@ -914,7 +899,7 @@ void WsfEM_ALARM_Clutter::clutter_signal_comp(double      ctauo2,
 
    nazclt     = patch_count;
    dazclr     = az_angle_incr_rad;
-   terrain_sw = WsfEM_ALARM_Terrain::get_terrain_sw();
+   terrain_sw = context.get_terrain_sw();
    hammsl_tx  = get_height_msl(tx_ant);
    ztenna_tx  = get_height_agl(tx_ant);
    offaz_tx   = get_az_point_ang(tx_ant);
@@ -925,41 +910,42 @@ void WsfEM_ALARM_Clutter::clutter_signal_comp(double      ctauo2,
    // arrays.
    //-------------------------------------------------------------------
    nprofile = WsfEM_ALARM_Terrain::get_nprofile(max_range);
-   i        = nprofile;
+   profile.Allocate(nprofile);
 
-   if (i > aprofile || uninit)
+   //-------------------------------------------------------------------
+   // NOTE-C++ Get the precomputed clutter map if enabled. The map can
+   // only be used if the reflectivity is not drawn randomly. The map is
+   // a member built by this routine and so shares its per-call members
+   // (e.g.: mWSF_LandCover). This model does not declare itself
+   // reentrant, so it is never evaluated (or its map built) on multiple
+   // threads.
+   //-------------------------------------------------------------------
+   WsfEM_ALARM_ClutterMap* mapPtr = nullptr;
+   if (mPrecomputeClutterMap &&
+       (mUseMIT_LL_DataTables || ((statistic_opt != stat_stat) && (statistic_opt != stat_numerical))))
    {
-      uninit = false;
-      //----------------------------------------------------------------
-      // Allocate arrays.  Memory is allocated in hunks to minimize
-      // allocate/deallocate thrashing if nprofile is gradually creeping
-      // up.
-      //----------------------------------------------------------------
-
-      aprofile = aprofile + (std::abs(i / hunk) + 1) * hunk;
-
-      iend.resize(aprofile + 1);
-      istart.resize(aprofile + 1);
-      visibl.resize(aprofile + 1);
-      elvmsl.resize(aprofile + 1);
-      rngter.resize(aprofile + 1);
-      tanepp.resize(aprofile + 1);
-      xprofl.resize(aprofile + 1);
-      zprofl.resize(aprofile + 1);
-      // BA
-      lcprofl.resize(aprofile + 1);
-      // BA
-
-      // allocate(iend(aprofile),     istart(aprofile), &
-      //      &   visibl(aprofile),   elvmsl(aprofile),&
-      //      &   rngter(0:aprofile), tanepp(aprofile), &
-      //      &   xprofl(0:aprofile), zprofl(0:aprofile), stat = j)
-
-      // if (j != 0)
-      //    /*call*/ fatal_error('clutter_signal_clut', &
-      //         & 'Can''t allocate memory')
-      // end if
-   } // end if
+      WsfEM_ALARM_ClutterMap::Signature signature;
+      signature.sitphi                = sitphi;
+      signature.sitlam                = sitlam;
+      signature.hammsl                = hammsl_tx;
+      signature.ztenna                = ztenna_tx;
+      signature.rkfact                = rkfact;
+      signature.freqin                = freqin;
+      signature.nprofile              = nprofile;
+      signature.land_cover            = land_cover;
+      signature.land_form             = land_form;
+      signature.wsf_land_cover        = mWSF_LandCover;
+      signature.wsf_land_form         = mWSF_LandForm;
+      signature.wsf_sea_state         = mWSF_SeaState;
+      signature.water_cover           = water_cover;
+      signature.terrain_sw            = terrain_sw;
+      signature.polarization_vertical = mPolarizationVertical;
+      signature.azimuth_resolution    = mProfileCacheOptions.mAzimuthResolution;
+      if (mClutterMap.Update(signature))
+      {
+         mapPtr = &mClutterMap;
+      }
+   }
 
    //-------------------------------------------------------------------
    // Load a single profile for round smooth earth.
@@ -968,7 +954,9 @@ void WsfEM_ALARM_Clutter::clutter_signal_comp(double      ctauo2,
    {
       wsf::Terrain terrain(mSimulationPtr->GetTerrainInterface());
 
-      /*call*/ WsfEM_ALARM_Terrain::visclt(terrain,
+      /*call*/ WsfEM_ALARM_Terrain::visclt(context,
+                                           mProfileCacheOptions,
+                                           terrain,
                                            mSimulationPtr->GetScenario().GetEnvironment(),
                                            alphac,
                                            hammsl_tx,
@@ -1035,11 +1023,34 @@ void WsfEM_ALARM_Clutter::clutter_signal_comp(double      ctauo2,
 
       //----------------------------------------------------------------
       // Load a profile for this azimuth.
+      //
+      // NOTE-C++ If a clutter map is being used and this radial has been
+      // computed, the profile and the per-patch terms come from the map.
+      // (Without terrain, every radial has the same profile.)
       //----------------------------------------------------------------
-      if (terrain_sw)
+      WsfEM_ALARM_ClutterMap::Radial* radialPtr = nullptr;
+      bool                            buildRadial = false;
+      if (mapPtr != nullptr)
+      {
+         double radialAz = terrain_sw ? alphac : 0.0;
+         radialPtr = mapPtr->Find(radialAz);
+         if (radialPtr == nullptr)
+         {
+            radialPtr   = &(mapPtr->Add(radialAz));
+            buildRadial = true;
+         }
+         else
+         {
+            radialPtr->Load(nareas, iend, istart, rngter, xprofl, zprofl);
+         }
+      }
+
+      if (terrain_sw && ((radialPtr == nullptr) || buildRadial))
       {
          wsf::Terrain terrain(mSimulationPtr->GetTerrainInterface());
-         /*call*/ WsfEM_ALARM_Terrain::visclt(terrain,
+         /*call*/ WsfEM_ALARM_Terrain::visclt(context,
+                                              mProfileCacheOptions,
+                                              terrain,
                                               mSimulationPtr->GetScenario().GetEnvironment(),
                                               alphac,
                                               hammsl_tx,
@@ -1059,6 +1070,35 @@ void WsfEM_ALARM_Clutter::clutter_signal_comp(double      ctauo2,
                                               lcprofl);
       }
 
+      if (buildRadial)
+      {
+         //-------------------------------------------------------------
+         // Compute the terms of the clutter sum that do not depend on
+         // the antenna gains for every patch that can be within a range
+         // gate (see loop_i below).
+         //-------------------------------------------------------------
+         radialPtr->Store(nprofile, nareas, iend, istart, rngter, xprofl, zprofl);
+         radialPtr->epslnc.assign(nprofile + 1, 0.0);
+         radialPtr->sigatn.assign(nprofile + 1, 0.0);
+         for (j = 1; j <= nareas; ++j)
+         {
+            for (i = std::max(istart[j] - 1, 1); i <= iend[j]; ++i)
+            {
+               epslnc = atan(tanepp[i]);
+               if (terrain_sw && mUseMIT_LL_DataTables)
+               {
+                  mWSF_LandCover = static_cast<WsfEnvironment::LandCover>(lcprofl[i]);
+               }
+               sigmai = get_reflectivity(elvmsl, freqin, ztenna_tx, i, land_cover, rkfact, rngter,
+                                         water_cover, xprofl, zprofl, epslnc);
+               atnclt = attenuation(atm_data, epslnc, freqin, rngter[i], rkfact);
+
+               radialPtr->epslnc[i] = epslnc;
+               radialPtr->sigatn[i] = sigmai * atnclt * atnclt / pow(rngter[i], 3);
+            }
+         }
+      }
+
       deltax = xprofl[iend[nareas]];
       deltaz = zprofl[iend[nareas]] - hammsl_tx;
       rend   = sqrt(deltax * deltax + deltaz * deltaz);
@@ -1213,6 +1253,19 @@ void WsfEM_ALARM_Clutter::clutter_signal_comp(double      ctauo2,
                      continue;
                   } // cycle;  // to next do loop iteration
 
+                  //----------------------------------------------------
+                  // NOTE-C++ Use the precomputed terms if available.
+                  //----------------------------------------------------
+
+                  if (radialPtr != nullptr)
+                  {
+                     epslnc = radialPtr->epslnc[i];
+                     /*call*/ get_relative_gain(rx_ant, alphac, epslnc, grbelo);
+                     /*call*/ get_relative_gain(tx_ant, alphac, epslnc, gtbelo);
+                     sumclt = sumclt + gtbelo * grbelo * plengi * radialPtr->sigatn[i];
+                     continue;
+                  }
+
                   //----------------------------------------------------
                   // Determine the elevation angle to the I-th
                   // terrain patch.
@@ -0,0 +1,121 @@
+// ****************************************************************************
+// CUI//REL TO USA ONLY
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfEM_ALARM_ClutterMap.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+//! The azimuth resolution (radians) of the radials when the terrain profiles are not computed at a coarser one.
+const double cRADIAL_RESOLUTION = 1.0E-6;
+} // namespace
+
+// =================================================================================================
+bool WsfEM_ALARM_ClutterMap::Signature::operator==(const Signature& aRhs) const
+{
+   return ((sitphi == aRhs.sitphi) && (sitlam == aRhs.sitlam) && (hammsl == aRhs.hammsl) &&
+           (ztenna == aRhs.ztenna) && (rkfact == aRhs.rkfact) && (freqin == aRhs.freqin) &&
+           (nprofile == aRhs.nprofile) && (land_cover == aRhs.land_cover) && (land_form == aRhs.land_form) &&
+           (wsf_land_cover == aRhs.wsf_land_cover) && (wsf_land_form == aRhs.wsf_land_form) &&
+           (wsf_sea_state == aRhs.wsf_sea_state) && (water_cover == aRhs.water_cover) &&
+           (terrain_sw == aRhs.terrain_sw) && (polarization_vertical == aRhs.polarization_vertical) &&
+           (azimuth_resolution == aRhs.azimuth_resolution));
+}
+
+// =================================================================================================
+//! Save the terrain profile data needed by the range gating in clutter_signal_comp.
+//! Point nprofile+1 is included because the patch length calculation references it.
+void WsfEM_ALARM_ClutterMap::Radial::Store(int                        nprofile,
+                                           int                        nareas,
+                                           const std::vector<int>&    iend,
+                                           const std::vector<int>&    istart,
+                                           const std::vector<double>& rngter,
+                                           const std::vector<double>& xprofl,
+                                           const std::vector<double>& zprofl)
+{
+   size_t numPoints = std::min(static_cast<size_t>(nprofile + 2), rngter.size());
+   mNumAreas        = nareas;
+   mIend.assign(iend.begin(), iend.begin() + nareas + 1);
+   mIstart.assign(istart.begin(), istart.begin() + nareas + 1);
+   mRngter.assign(rngter.begin(), rngter.begin() + numPoints);
+   mXprofl.assign(xprofl.begin(), xprofl.begin() + numPoints);
+   mZprofl.assign(zprofl.begin(), zprofl.begin() + numPoints);
+}
+
+// =================================================================================================
+//! Restore the terrain profile data saved by Store.
+//! The output arrays must have been allocated to hold the profile.
+void WsfEM_ALARM_ClutterMap::Radial::Load(int&                 nareas,
+                                          std::vector<int>&    iend,
+                                          std::vector<int>&    istart,
+                                          std::vector<double>& rngter,
+                                          std::vector<double>& xprofl,
+                                          std::vector<double>& zprofl) const
+{
+   nareas = mNumAreas;
+   std::copy(mIend.begin(), mIend.end(), iend.begin());
+   std::copy(mIstart.begin(), mIstart.end(), istart.begin());
+   std::copy(mRngter.begin(), mRngter.end(), rngter.begin());
+   std::copy(mXprofl.begin(), mXprofl.end(), xprofl.begin());
+   std::copy(mZprofl.begin(), mZprofl.end(), zprofl.begin());
+}
+
+// =================================================================================================
+//! Check the inputs to the clutter calculation and prepare the map for use.
+//! @param aSignature The current inputs to the clutter calculation.
+//! @returns true if the map may be used. The map is discarded whenever the signature changes, so a map
+//! is not used until the same signature has been seen on two successive calls. This prevents a moving
+//! radar from building maps that will never be reused.
+bool WsfEM_ALARM_ClutterMap::Update(const Signature& aSignature)
+{
+   if ((! mStable) || (mSignature != aSignature))
+   {
+      mStable    = (mSignature == aSignature);
+      mSignature = aSignature;
+      Clear();
+   }
+   return mStable;
+}
+
+// =================================================================================================
+//! Return the radial for the specified azimuth, or nullptr if it has not been computed.
+WsfEM_ALARM_ClutterMap::Radial* WsfEM_ALARM_ClutterMap::Find(double alphac)
+{
+   auto radialIter = mRadials.find(RadialKey(alphac));
+   return (radialIter != mRadials.end()) ? &(radialIter->second) : nullptr;
+}
+
+// =================================================================================================
+//! Add the radial for the specified azimuth.
+//! The caller is responsible for filling in the returned radial.
+WsfEM_ALARM_ClutterMap::Radial& WsfEM_ALARM_ClutterMap::Add(double alphac)
+{
+   if (mRadials.size() >= cMAX_RADIALS)
+   {
+      mRadials.clear();
+   }
+   return mRadials[RadialKey(alphac)];
+}
+
+// =================================================================================================
+//! Return the key of the radial containing the specified azimuth.
+//! Azimuths are quantized to the terrain profile azimuth resolution of the model (see
+//! WsfEM_ALARM_Terrain::ProfileCacheOptions), or to 1.0E-6 radians if that is zero, so the
+//! number of distinct radials is bounded.
+// private
+long long WsfEM_ALARM_ClutterMap::RadialKey(double alphac) const
+{
+   double resolution = (mSignature.azimuth_resolution > 0.0) ? mSignature.azimuth_resolution : cRADIAL_RESOLUTION;
+   // Rounded as in WsfEM_ALARM_Terrain::visclt so a radial matches the profile computed for it.
+   return static_cast<long long>(std::floor((alphac / resolution) + 0.5));
+}
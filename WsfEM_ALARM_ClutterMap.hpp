@@ -0,0 +1,107 @@
+// ****************************************************************************
+// CUI//REL TO USA ONLY
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFEM_ALARM_CLUTTERMAP_HPP
+#define WSFEM_ALARM_CLUTTERMAP_HPP
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+//! The precomputed clutter map of an ALARM clutter model whose radar site and waveform do not change.
+//!
+//! Along each clutter radial the only terms of the ALARM clutter sum that depend on the radar
+//! pointing are the antenna gains. For a stationary radar the remaining per-patch term
+//! (sigmai * atnclt^2 / R^3) and the terrain profile are computed once per radial, after which a
+//! clutter evaluation only needs to apply the gains and sum over the range gates.
+//!
+//! The map is a member of the clutter model (WsfEM_ALARM_Clutter), so it is discarded with the model.
+//! A clutter model is not evaluated on more than one thread at a time, so the map needs no locking.
+class WsfEM_ALARM_ClutterMap
+{
+public:
+   //! The inputs (other than the azimuth) that determine the clutter terms along a radial.
+   struct Signature
+   {
+      bool operator==(const Signature& aRhs) const;
+      bool operator!=(const Signature& aRhs) const { return !(*this == aRhs); }
+
+      double sitphi                = 0.0; // radians
+      double sitlam                = 0.0; // radians
+      double hammsl                = 0.0; // meters
+      double ztenna                = 0.0; // meters
+      double rkfact                = 0.0;
+      double freqin                = 0.0; // MHz
+      int    nprofile              = 0;
+      int    land_cover            = 0;
+      int    land_form             = 0;
+      int    wsf_land_cover        = 0;
+      int    wsf_land_form         = 0;
+      int    wsf_sea_state         = 0;
+      bool   water_cover           = false;
+      bool   terrain_sw            = false;
+      bool   polarization_vertical = false;
+      double azimuth_resolution    = 0.0; // radians (see RadialKey)
+   };
+
+   //! The terrain profile and the precomputed clutter terms along a single radial.
+   //! Arrays that start at index 1 in ALARM still have element 0 allocated.
+   class Radial
+   {
+   public:
+      void Store(int                        nprofile,
+                 int                        nareas,
+                 const std::vector<int>&    iend,
+                 const std::vector<int>&    istart,
+                 const std::vector<double>& rngter,
+                 const std::vector<double>& xprofl,
+                 const std::vector<double>& zprofl);
+
+      void Load(int&                 nareas,
+                std::vector<int>&    iend,
+                std::vector<int>&    istart,
+                std::vector<double>& rngter,
+                std::vector<double>& xprofl,
+                std::vector<double>& zprofl) const;
+
+      std::vector<double> epslnc; //!< 1:nprofile Elevation angle to each patch (radians)
+      std::vector<double> sigatn; //!< 1:nprofile sigmai * atnclt**2 / rngter**3 for each patch
+
+   private:
+      int                 mNumAreas  = 0;
+      std::vector<int>    mIend;   // 1:nareas
+      std::vector<int>    mIstart; // 1:nareas
+      std::vector<double> mRngter; // 0:nprofile+1
+      std::vector<double> mXprofl; // 0:nprofile+1
+      std::vector<double> mZprofl; // 0:nprofile+1
+   };
+
+   bool Update(const Signature& aSignature);
+
+   Radial* Find(double alphac);
+
+   Radial& Add(double alphac);
+
+   void Clear() { mRadials.clear(); }
+
+private:
+   long long RadialKey(double alphac) const;
+
+   //! The maximum number of radials retained.
+   //! A radar whose pointing changes continuously produces a new set of radials on every call.
+   static const size_t cMAX_RADIALS = 1024;
+
+   Signature                   mSignature;
+   bool                        mStable = false;
+   std::map<long long, Radial> mRadials;
+};
+
+#endif
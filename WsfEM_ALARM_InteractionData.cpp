@@ -0,0 +1,128 @@
+// ****************************************************************************
+// CUI//REL TO USA ONLY
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfEM_ALARM_InteractionData.hpp"
+
+#include "UtLog.hpp"
+#include "UtMemory.hpp"
+#include "UtWallClock.hpp"
+#include "WsfEM_ALARM_Geometry.hpp"
+#include "WsfEM_Rcvr.hpp"
+#include "WsfEM_Xmtr.hpp"
+
+// =================================================================================================
+//! Return the ALARM data for an interaction, computing it if necessary.
+//! The interaction must have a transmitter, receiver and target.
+// static
+WsfEM_ALARM_InteractionData& WsfEM_ALARM_InteractionData::Get(WsfEM_Interaction& aInteraction)
+{
+   WsfEM_ALARM_InteractionData* dataPtr = dynamic_cast<WsfEM_ALARM_InteractionData*>(aInteraction.GetModelCache());
+   if (dataPtr == nullptr)
+   {
+      auto newDataPtr = ut::make_unique<WsfEM_ALARM_InteractionData>();
+      dataPtr         = newDataPtr.get();
+      aInteraction.SetModelCache(std::move(newDataPtr));
+   }
+
+   if ((! dataPtr->mValid) ||
+       (dataPtr->mXmtrPtr != aInteraction.GetTransmitter()) ||
+       (dataPtr->mRcvrPtr != aInteraction.GetReceiver()) ||
+       (dataPtr->mTargetPtr != aInteraction.GetTarget()))
+   {
+      dataPtr->Compute(aInteraction);
+   }
+   return *dataPtr;
+}
+
+// =================================================================================================
+void WsfEM_ALARM_InteractionData::Compute(WsfEM_Interaction& aInteraction)
+{
+   mXmtrPtr   = aInteraction.GetTransmitter();
+   mRcvrPtr   = aInteraction.GetReceiver();
+   mTargetPtr = aInteraction.GetTarget();
+
+   // Compute the geometry as it is computed in ALARM (geomtr.f90).
+   WsfEM_ALARM_Geometry::ComputeGeometry(mXmtrPtr,
+                                         mTargetPtr,
+                                         mXmtrPtr,
+                                         rdr_alt_msl,
+                                         rdr_lat,
+                                         rdr_lon,
+                                         rkfact,
+                                         tgt_alt_msl,
+                                         tgt_lat,
+                                         tgt_lon,
+                                         ground_range,
+                                         tanept,
+                                         slant_range,
+                                         tgt_az,
+                                         tgt_el,
+                                         tgt_x,
+                                         tgt_z);
+
+   mTxAntennaPtr = ut::make_unique<WsfEM_ALARM_Antenna::antenna>(mXmtrPtr, aInteraction, tgt_az, tgt_el, slant_range);
+   mRxAntennaPtr = ut::make_unique<WsfEM_ALARM_Antenna::antenna>(mRcvrPtr, aInteraction, tgt_az, tgt_el, slant_range);
+
+   if ((mAtmospherePtr == nullptr) || (mAtmosphereXmtrPtr != mXmtrPtr))
+   {
+      mAtmospherePtr     = ut::make_unique<WsfEM_ALARM_Attenuation::atmosphere>(mXmtrPtr);
+      mAtmosphereXmtrPtr = mXmtrPtr;
+   }
+   mValid = true;
+}
+
+// =================================================================================================
+//! Time the ALARM detection path for an interaction (the 'interaction_data_benchmark' command of
+//! ALARM propagation), with the data shared between the models and with the data computed by each model
+//! as it was before it was shared (the geometry and antennas twice and the atmosphere once per attempt).
+//! The times per detection attempt are written to the log.
+//! @param aInteraction The interaction. Its transmitter, receiver and target must be defined.
+//! @param aModels      Evaluates the ALARM models for the interaction (they get their data using Get).
+//! @param aRepeatCount The number of detection attempts to time.
+// static
+void WsfEM_ALARM_InteractionData::RunBenchmark(WsfEM_Interaction&           aInteraction,
+                                               const std::function<void()>& aModels,
+                                               int                          aRepeatCount)
+{
+   WsfEM_ALARM_InteractionData& data = Get(aInteraction);
+
+   UtWallClock clock;
+   for (int n = 0; n < aRepeatCount; ++n)
+   {
+      data.mAtmospherePtr.reset();
+      data.Compute(aInteraction);
+      data.Reset();
+      aModels();
+   }
+   double separateTime = clock.GetClock() / aRepeatCount;
+
+   clock.ResetClock();
+   for (int n = 0; n < aRepeatCount; ++n)
+   {
+      data.Reset();
+      aModels();
+   }
+   double sharedTime = clock.GetClock() / aRepeatCount;
+
+   clock.ResetClock();
+   for (int n = 0; n < aRepeatCount; ++n)
+   {
+      data.Reset();
+      Get(aInteraction);
+   }
+   double dataTime = clock.GetClock() / aRepeatCount;
+
+   auto logger = ut::log::info() << "ALARM interaction data benchmark:";
+   logger.AddNote() << "Detection attempts: " << aRepeatCount;
+   logger.AddNote() << "Data computed by each model: " << 1.0E6 * separateTime << " us/attempt";
+   logger.AddNote() << "Data shared by the models: " << 1.0E6 * sharedTime << " us/attempt";
+   logger.AddNote() << "Shared data alone: " << 1.0E6 * dataTime << " us/attempt";
+}
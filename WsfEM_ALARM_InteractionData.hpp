@@ -0,0 +1,79 @@
+// ****************************************************************************
+// CUI//REL TO USA ONLY
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFEM_ALARM_INTERACTIONDATA_HPP
+#define WSFEM_ALARM_INTERACTIONDATA_HPP
+
+#include <functional>
+#include <memory>
+
+#include "WsfEM_ALARM_Antenna.hpp"
+#include "WsfEM_ALARM_Attenuation.hpp"
+#include "WsfEM_Interaction.hpp"
+class WsfEM_Rcvr;
+class WsfEM_Xmtr;
+class WsfPlatform;
+
+//! The ALARM geometry, antenna and atmosphere data for an interaction.
+//!
+//! ALARM propagation and ALARM clutter both need the ALARM geometry (geomtr.f90) and the
+//! transmit and receive 'antenna' objects for the same interaction. This data is computed once and
+//! cached on the interaction (see WsfEM_Interaction::ModelCache) so the second model can reuse it.
+//! The cache is invalidated when the interaction is reset.
+class WsfEM_ALARM_InteractionData : public WsfEM_Interaction::ModelCache
+{
+public:
+   static WsfEM_ALARM_InteractionData& Get(WsfEM_Interaction& aInteraction);
+
+   void Reset() override { mValid = false; }
+
+   static void RunBenchmark(WsfEM_Interaction& aInteraction, const std::function<void()>& aModels, int aRepeatCount);
+
+   WsfEM_ALARM_Antenna::antenna&       tx_ant() { return *mTxAntennaPtr; }
+   WsfEM_ALARM_Antenna::antenna&       rx_ant() { return *mRxAntennaPtr; }
+   WsfEM_ALARM_Attenuation::atmosphere& atm_data() { return *mAtmospherePtr; }
+
+   //! @name Geometry from WsfEM_ALARM_Geometry::ComputeGeometry.
+   //@{
+   double rdr_alt_msl  = 0.0; // meters
+   double rdr_lat      = 0.0; // radians
+   double rdr_lon      = 0.0; // radians
+   double rkfact       = 0.0;
+   double tgt_alt_msl  = 0.0; // meters
+   double tgt_lat      = 0.0; // radians
+   double tgt_lon      = 0.0; // radians
+   double ground_range = 0.0; // meters
+   double tanept       = 0.0;
+   double slant_range  = 0.0; // meters
+   double tgt_az       = 0.0; // radians
+   double tgt_el       = 0.0; // radians
+   double tgt_x        = 0.0; // meters
+   double tgt_z        = 0.0; // meters
+   //@}
+
+private:
+   void Compute(WsfEM_Interaction& aInteraction);
+
+   bool         mValid     = false;
+   WsfEM_Xmtr*  mXmtrPtr   = nullptr;
+   WsfEM_Rcvr*  mRcvrPtr   = nullptr;
+   WsfPlatform* mTargetPtr = nullptr;
+
+   std::unique_ptr<WsfEM_ALARM_Antenna::antenna>       mTxAntennaPtr;
+   std::unique_ptr<WsfEM_ALARM_Antenna::antenna>       mRxAntennaPtr;
+
+   //! The atmosphere depends only on the transmitter, so it (and the platform it creates) is retained
+   //! while the transmitter does not change.
+   std::unique_ptr<WsfEM_ALARM_Attenuation::atmosphere> mAtmospherePtr;
+   WsfEM_Xmtr*                                          mAtmosphereXmtrPtr = nullptr;
+};
+
+#endif
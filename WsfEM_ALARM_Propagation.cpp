@@ -25,6 +25,7 @@
 
 #include "WsfEM_ALARM_Propagation.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <complex>
 #include <cstdlib> // for abs(int)
@@ -35,6 +36,8 @@
 #include "WsfEM_ALARM_Antenna.hpp"
 #include "WsfEM_ALARM_Fortran.hpp"
 #include "WsfEM_ALARM_Geometry.hpp"
+#include "WsfEM_ALARM_InteractionData.hpp"
+#include "WsfEM_ALARM_SpecialFunctions.hpp"
 #include "WsfEM_ALARM_Terrain.hpp"
 #include "WsfEM_Interaction.hpp"
 #include "WsfEM_Rcvr.hpp"
@@ -67,6 +70,56 @@ std::complex<float> em1pi3(0.5F, -0.86602540F);  // (+0.5,-sqr3o2)
 std::complex<float> ep2pi3(-0.5F, 0.86602540F);  // (-0.5,+sqr3o2)
 std::complex<float> em2pi3(-0.5F, -0.86602540F); // (-0.5,-sqr3o2)
 
+// ==============================================================================================
+// The following is from 'sediff' (also used by the 'special_function_self_test' command).
+// ==============================================================================================
+
+const int airy_terms = 35;
+
+const double airdot[] = {0.0,        0.70121E0, -0.80311E0, 0.86520E0, -0.91085E0, 0.94733E0,
+                         -0.97792E0, 1.00437E0, -1.02773E0, 1.04872E0, -1.06779E0, 1.08530E0,
+                         -1.10150E0, 1.11659E0, -1.13073E0, 1.14403E0, -1.15660E0, 1.16853E0,
+                         -1.17988E0, 1.19070E0, -1.20106E0, 1.21098E0, -1.22052E0, 1.22970E0,
+                         -1.23854E0, 1.24708E0, -1.25534E0, 1.26334E0, -1.27109E0, 1.27861E0,
+                         -1.28592E0, 1.29302E0, -1.29994E0, 1.30667E0, -1.31324E0, 1.31965E0};
+
+const double airzro[] = {0.0,
+                         -2.33810741E0,
+                         -4.08794944E0,
+                         -5.52055983E0,
+                         -6.78670809E0,
+                         -7.94413359E0,
+                         -9.02265085E0,
+                         -10.04017434E0,
+                         -11.00852430E0,
+                         -11.93601556E0,
+                         -12.82877675E0,
+                         -13.69148903E0,
+                         -14.52782995E0,
+                         -15.34075514E0,
+                         -16.13268516E0,
+                         -16.90563400E0,
+                         -17.66130011E0,
+                         -18.40113260E0,
+                         -19.12638047E0,
+                         -19.83812989E0,
+                         -20.53733291E0,
+                         -21.22482994E0,
+                         -21.90136760E0,
+                         -22.56761292E0,
+                         -23.22416500E0,
+                         -23.87156446E0,
+                         -24.51030124E0,
+                         -25.14082117E0,
+                         -25.76353140E0,
+                         -26.37880505E0,
+                         -26.98698511E0,
+                         -27.58838781E0,
+                         -28.18330550E0,
+                         -28.77200917E0,
+                         -29.35475056E0,
+                         -29.93176412E0};
+
 // ==============================================================================================
 // The following is from 'SalramPropagation.f90'
 // ==============================================================================================
@@ -75,22 +128,6 @@ const double sWaveHeight[20] = {0.0, 0.152, 0.457, 0.762, 1.22, 1.82, 3.049, 0.0
                                 0.0, 0.0,   0.0,   0.0,   0.0,  0.0,  0.0,   0.0, 0.0, 0.0};
 } // namespace
 
-// See note in header file...
-
-bool                WsfEM_ALARM_Propagation::uninit   = true;
-int                 WsfEM_ALARM_Propagation::aprofile = 0;
-std::vector<double> WsfEM_ALARM_Propagation::dratio;
-std::vector<double> WsfEM_ALARM_Propagation::elvmsl;
-std::vector<int>    WsfEM_ALARM_Propagation::iend;
-std::vector<int>    WsfEM_ALARM_Propagation::istart;
-std::vector<double> WsfEM_ALARM_Propagation::tanepp;
-std::vector<bool>   WsfEM_ALARM_Propagation::visibl;
-std::vector<double> WsfEM_ALARM_Propagation::xprofl;
-std::vector<double> WsfEM_ALARM_Propagation::zprofl;
-
-int              WsfEM_ALARM_Propagation::indxmx_size = 0;
-std::vector<int> WsfEM_ALARM_Propagation::indxmx;
-
 // =================================================================================================
 WsfEM_ALARM_Propagation::WsfEM_ALARM_Propagation()
    : WsfEM_Propagation()
@@ -112,6 +149,17 @@ WsfEM_ALARM_Propagation::WsfEM_ALARM_Propagation()
    , mWSF_LandCover(0)
    , mWSF_LandForm(0)
    , mWSF_SeaState(0)
+   , mProfileCacheOptions()
+   , mUseSpecialFunctionTables(false)
+   , mInteractionBenchmarkCount(0)
+   , mUseFactorTable(false)
+   , mFactorTableRangeStep(500.0)
+   , mFactorTableAltitudeStep(25.0)
+   , mFactorTableSectorWidth(0.5 * UtMath::cRAD_PER_DEG)
+   , mFactorTableTolerance(UtMath::DB_ToLinear(1.0))
+   , mFactorTableNullThreshold(UtMath::DB_ToLinear(-20.0))
+   , mFactorTables()
+   , mFactorTableMutex()
    , mSimulationPtr(nullptr)
 {
 }
@@ -137,6 +185,17 @@ WsfEM_ALARM_Propagation::WsfEM_ALARM_Propagation(const WsfEM_ALARM_Propagation&
    , mWSF_LandCover(0)
    , mWSF_LandForm(0)
    , mWSF_SeaState(0)
+   , mProfileCacheOptions(aSrc.mProfileCacheOptions)
+   , mUseSpecialFunctionTables(aSrc.mUseSpecialFunctionTables)
+   , mInteractionBenchmarkCount(aSrc.mInteractionBenchmarkCount)
+   , mUseFactorTable(aSrc.mUseFactorTable)
+   , mFactorTableRangeStep(aSrc.mFactorTableRangeStep)
+   , mFactorTableAltitudeStep(aSrc.mFactorTableAltitudeStep)
+   , mFactorTableSectorWidth(aSrc.mFactorTableSectorWidth)
+   , mFactorTableTolerance(aSrc.mFactorTableTolerance)
+   , mFactorTableNullThreshold(aSrc.mFactorTableNullThreshold)
+   , mFactorTables()
+   , mFactorTableMutex()
    , mSimulationPtr(aSrc.mSimulationPtr)
 {
 }
@@ -146,19 +205,10 @@ WsfEM_ALARM_Propagation::WsfEM_ALARM_Propagation(const WsfEM_ALARM_Propagation&
 // static
 void WsfEM_ALARM_Propagation::ResetState()
 {
-   uninit   = true;
-   aprofile = 0;
-   dratio.clear();
-   elvmsl.clear();
-   iend.clear();
-   istart.clear();
-   tanepp.clear();
-   visibl.clear();
-   xprofl.clear();
-   zprofl.clear();
-
-   indxmx_size = 0;
-   indxmx.clear();
+   WsfEM_ALARM_Terrain::Context& context = WsfEM_ALARM_Terrain::GetThreadContext();
+   context.mPropagationProfile.Clear();
+   context.indxmx_size = 0;
+   context.indxmx.clear();
 }
 
 // =================================================================================================
@@ -212,45 +262,38 @@ double WsfEM_ALARM_Propagation::ComputePropagationFactor(WsfEM_Interaction& aInt
       }
    }
 
-   // Compute the geometry as it is computed in ALARM (geomtr.f90).
-
-   double rdr_lat;
-   double rdr_lon;
-   double rdr_alt_msl;
-   double tgt_lat;
-   double tgt_lon;
-   double tgt_alt_msl;
-   double rkfact;
-   double tgt_x;
-   double tgt_z;
-   double tgt_az;
-   double tgt_el;
-   double tanept;
-   double slant_range;
-   double ground_range;
-
-   WsfEM_ALARM_Terrain::Initialize(targetPtr->GetTerrain());
-
-   WsfEM_ALARM_Geometry::ComputeGeometry(xmtrPtr,
-                                         targetPtr,
-                                         xmtrPtr,
-                                         rdr_alt_msl,
-                                         rdr_lat,
-                                         rdr_lon,
-                                         rkfact,
-                                         tgt_alt_msl,
-                                         tgt_lat,
-                                         tgt_lon,
-                                         ground_range,
-                                         tanept,
-                                         slant_range,
-                                         tgt_az,
-                                         tgt_el,
-                                         tgt_x,
-                                         tgt_z);
+   if (mInteractionBenchmarkCount > 0)
+   {
+      // Run once, for the first interaction.
+      int repeatCount            = mInteractionBenchmarkCount;
+      mInteractionBenchmarkCount = 0;
+      WsfEM_ALARM_InteractionData::RunBenchmark(aInteraction,
+                                                [&]() { ComputePropagationFactor(aInteraction, aEnvironment); },
+                                                repeatCount);
+   }
 
-   antenna tx_ant(xmtrPtr, aInteraction, tgt_az, tgt_el, slant_range);
-   antenna rx_ant(rcvrPtr, aInteraction, tgt_az, tgt_el, slant_range);
+   Context& context = WsfEM_ALARM_Terrain::GetThreadContext();
+   context.Initialize(targetPtr->GetTerrain());
+
+   // The geometry (as computed in ALARM geomtr.f90) and antennas are shared with ALARM clutter.
+   WsfEM_ALARM_InteractionData& alarmData = WsfEM_ALARM_InteractionData::Get(aInteraction);
+
+   double rdr_lat      = alarmData.rdr_lat;
+   double rdr_lon      = alarmData.rdr_lon;
+   double tgt_lat      = alarmData.tgt_lat;
+   double tgt_lon      = alarmData.tgt_lon;
+   double tgt_alt_msl  = alarmData.tgt_alt_msl;
+   double rkfact       = alarmData.rkfact;
+   double tgt_x        = alarmData.tgt_x;
+   double tgt_z        = alarmData.tgt_z;
+   double tgt_az       = alarmData.tgt_az;
+   double tgt_el       = alarmData.tgt_el;
+   double tanept       = alarmData.tanept;
+   double slant_range  = alarmData.slant_range;
+   double ground_range = alarmData.ground_range;
+
+   antenna& tx_ant = alarmData.tx_ant();
+   antenna& rx_ant = alarmData.rx_ant();
 
    double pulse_width = xmtrPtr->GetPulseWidth() * 1.0E+6; // in usec
    // BOEING-BEG:
@@ -360,42 +403,30 @@ double WsfEM_ALARM_Propagation::ComputePropagationFactor(WsfEM_Interaction& aInt
    const3 = pow((wavelength / pi), onethr);
    const4 = 0.5 * const3 * const3;
 
+   FactorArgs args;
+   args.const3       = const3;
+   args.const4       = const4;
+   args.deltag       = deltag;
+   args.polarization = polarization;
+   args.water_cover  = water_cover;
+   args.pulse_width  = pulse_width;
+   args.wavelength   = wavelength;
+   args.ground_range = ground_range;
+   args.tgt_alt_msl  = tgt_alt_msl;
+   args.slant_range  = slant_range;
+   args.rkfact       = rkfact;
+   args.rdr_lat      = rdr_lat;
+   args.rdr_lon      = rdr_lon;
+   args.tanept       = tanept;
+   args.tgt_lat      = tgt_lat;
+   args.tgt_lon      = tgt_lon;
+   args.tgt_az       = tgt_az;
+   args.tgt_el       = tgt_el;
+   args.tgt_x        = tgt_x;
+   args.tgt_z        = tgt_z;
+
    // Compute the propagation factor to the TX antenna
-   /*call*/ laprop(tx_ant,
-                   tgt_az,
-                   const3,
-                   const4,
-                   deltag,
-                   tgt_el,
-                   this->epsilon_one,
-                   prop_tx,
-                   ground_range,
-                   tgt_alt_msl,
-                   polarization,
-                   water_cover,
-                   this->prop_sw,
-                   masked,
-                   pulse_width,
-                   slant_range,
-                   rkfact,
-                   wavelength,
-                   this->roughness,
-                   this->sigma_zero,
-                   rdr_lon,
-                   rdr_lat,
-                   tanept,
-                   tgt_lon,
-                   tgt_lat,
-                   this->sea_relaxation,
-                   this->wind_speed,
-                   tgt_x,
-                   tgt_z,
-                   this->diff_sw,
-                   this->use_surface_height,
-                   this->surface_height,
-                   this->soil_moisture,
-                   this->water_temp,
-                   this->sea_water);
+   /*call*/ ComputeFactor(context, aInteraction, xmtrPtr, tx_ant, args, prop_tx, masked);
 
    // if (is_same(rx_ant, tx_ant))
    if (!aInteraction.mBistatic)
@@ -406,41 +437,7 @@ double WsfEM_ALARM_Propagation::ComputePropagationFactor(WsfEM_Interaction& aInt
    else
    {
       // Compute the propagation factor to the RX antenna
-      /*call*/ laprop(rx_ant,
-                      tgt_az,
-                      const3,
-                      const4,
-                      deltag,
-                      tgt_el,
-                      this->epsilon_one,
-                      prop_rx,
-                      ground_range,
-                      tgt_alt_msl,
-                      polarization,
-                      water_cover,
-                      this->prop_sw,
-                      masked,
-                      pulse_width,
-                      slant_range,
-                      rkfact,
-                      wavelength,
-                      this->roughness,
-                      this->sigma_zero,
-                      rdr_lon,
-                      rdr_lat,
-                      tanept,
-                      tgt_lon,
-                      tgt_lat,
-                      this->sea_relaxation,
-                      this->wind_speed,
-                      tgt_x,
-                      tgt_z,
-                      this->diff_sw,
-                      this->use_surface_height,
-                      this->surface_height,
-                      this->soil_moisture,
-                      this->water_temp,
-                      this->sea_water);
+      /*call*/ ComputeFactor(context, aInteraction, rcvrPtr, rx_ant, args, prop_rx, masked);
    }
 
    COMPLEX fto4th = prop_rx * prop_tx;
@@ -457,6 +454,219 @@ double WsfEM_ALARM_Propagation::ComputePropagationFactor(WsfEM_Interaction& aInt
    return static_cast<double>(cabs(fto4th));
 }
 
+// =================================================================================================
+//! Compute the one-way pattern propagation factor (squared) for an antenna.
+//! If 'propagation_factor_table' is enabled the value is interpolated from the antenna's table when
+//! the containing cell is known to be accurate, otherwise laprop is evaluated directly.
+//! @note The tables are shared by all callers of the model and are accessed under mFactorTableMutex.
+void WsfEM_ALARM_Propagation::ComputeFactor(Context&           aContext,
+                                            WsfEM_Interaction& aInteraction,
+                                            WsfEM_XmtrRcvr*    aXmtrRcvrPtr,
+                                            antenna&           ant_data,
+                                            const FactorArgs&  aArgs,
+                                            COMPLEX&           fsquared,
+                                            bool&              masked)
+{
+   if ((!mUseFactorTable) || (aArgs.ground_range < mFactorTableRangeStep))
+   {
+      // Cells that contain the site are always evaluated directly.
+      ComputeExactFactor(aContext, ant_data, aArgs, fsquared, masked);
+      return;
+   }
+
+   // The table is rebuilt if anything other than the target location has changed (site, cue, frequency,
+   // environment...). The scanned beam position is not included because it follows the target.
+   std::vector<double> signature{aArgs.rdr_lat,
+                                 aArgs.rdr_lon,
+                                 get_height_msl(ant_data),
+                                 get_cued_az(ant_data),
+                                 get_cued_el(ant_data),
+                                 aArgs.rkfact,
+                                 aArgs.wavelength,
+                                 aArgs.pulse_width,
+                                 static_cast<double>(aArgs.polarization),
+                                 aArgs.water_cover ? 1.0 : 0.0,
+                                 epsilon_one,
+                                 sigma_zero,
+                                 roughness,
+                                 wind_speed,
+                                 static_cast<double>(mWSF_LandForm),
+                                 static_cast<double>(mWSF_SeaState)};
+   std::lock_guard<std::mutex> lock(mFactorTableMutex);
+   FactorTable&                table = mFactorTables[aXmtrRcvrPtr];
+   if (table.mSignature != signature)
+   {
+      table.mSignature = signature;
+      table.mNodes.clear();
+      table.mCells.clear();
+   }
+
+   // Locate the cell that contains the target.
+   double az     = UtMath::NormalizeAngle0_TwoPi(aArgs.tgt_az);
+   int    sector = static_cast<int>(floor(az / mFactorTableSectorWidth + 0.5));
+   double xr     = aArgs.ground_range / mFactorTableRangeStep;
+   double xh     = aArgs.tgt_alt_msl / mFactorTableAltitudeStep;
+   int    ir     = static_cast<int>(floor(xr));
+   int    ih     = static_cast<int>(floor(xh));
+   double fr     = xr - ir;
+   double fh     = xh - ih;
+
+   if ((table.mCells.size() >= FactorTable::cMAX_CELLS) || (table.mNodes.size() >= FactorTable::cMAX_NODES))
+   {
+      // The target has covered a large area. Start again rather than let the table grow without bound.
+      table.mNodes.clear();
+      table.mCells.clear();
+   }
+
+   FactorTable::Cell& cell = table.mCells[FactorTable::Index(sector, ir, ih)];
+   if (cell.mExact)
+   {
+      ComputeExactFactor(aContext, ant_data, aArgs, fsquared, masked);
+      return;
+   }
+
+   // Get the corners of the cell, evaluating any that have not yet been evaluated.
+   float corners[2][2];
+   for (int i = 0; i < 2; ++i)
+   {
+      for (int j = 0; j < 2; ++j)
+      {
+         FactorTable::Index node(sector, ir + i, ih + j);
+         auto               nodeIter = table.mNodes.find(node);
+         if (nodeIter == table.mNodes.end())
+         {
+            nodeIter = table.mNodes.emplace(node, ComputeTableNode(aContext, aInteraction, aXmtrRcvrPtr, aArgs, node)).first;
+         }
+         corners[i][j] = nodeIter->second;
+      }
+   }
+   double value = (1.0 - fr) * ((1.0 - fh) * corners[0][0] + fh * corners[0][1]) +
+                  fr * ((1.0 - fh) * corners[1][0] + fh * corners[1][1]);
+
+   if ((cell.mValidCount < FactorTable::cVALIDATION_SAMPLES) || (++cell.mUseCount >= FactorTable::cREVALIDATION_INTERVAL))
+   {
+      // The cell is still being validated or is due to be checked again. Compare the interpolated value with the
+      // exact value at this point. The cell is only interpolated if it agrees within the tolerance and it is not
+      // near a null, otherwise it is evaluated exactly from now on.
+      ComputeExactFactor(aContext, ant_data, aArgs, fsquared, masked);
+      double exact    = cabs(fsquared);
+      double minValue = std::min(std::min(corners[0][0], corners[0][1]), std::min(corners[1][0], corners[1][1]));
+      bool   accurate = (minValue >= mFactorTableNullThreshold) && (exact >= mFactorTableNullThreshold) &&
+                      (value <= exact * mFactorTableTolerance) && (exact <= value * mFactorTableTolerance);
+      if (accurate)
+      {
+         ++cell.mValidCount;
+         cell.mUseCount = 0;
+      }
+      else
+      {
+         cell.mExact = true;
+      }
+      return;
+   }
+
+   // Only the magnitude of the factor is used by the caller, so the phase is not tabulated.
+   fsquared = COMPLEX(static_cast<float>(value), 0.0F);
+}
+
+// =================================================================================================
+//! Compute the one-way pattern propagation factor (squared) for an antenna using laprop.
+void WsfEM_ALARM_Propagation::ComputeExactFactor(Context&          aContext,
+                                                 antenna&          ant_data,
+                                                 const FactorArgs& aArgs,
+                                                 COMPLEX&          fsquared,
+                                                 bool&             masked)
+{
+   /*call*/ laprop(aContext,
+                   ant_data,
+                   aArgs.tgt_az,
+                   aArgs.const3,
+                   aArgs.const4,
+                   aArgs.deltag,
+                   aArgs.tgt_el,
+                   this->epsilon_one,
+                   fsquared,
+                   aArgs.ground_range,
+                   aArgs.tgt_alt_msl,
+                   aArgs.polarization,
+                   aArgs.water_cover,
+                   this->prop_sw,
+                   masked,
+                   aArgs.pulse_width,
+                   aArgs.slant_range,
+                   aArgs.rkfact,
+                   aArgs.wavelength,
+                   this->roughness,
+                   this->sigma_zero,
+                   aArgs.rdr_lon,
+                   aArgs.rdr_lat,
+                   aArgs.tanept,
+                   aArgs.tgt_lon,
+                   aArgs.tgt_lat,
+                   this->sea_relaxation,
+                   this->wind_speed,
+                   aArgs.tgt_x,
+                   aArgs.tgt_z,
+                   this->diff_sw,
+                   this->use_surface_height,
+                   this->surface_height,
+                   this->soil_moisture,
+                   this->water_temp,
+                   this->sea_water);
+}
+
+// =================================================================================================
+//! Evaluate the magnitude of the pattern propagation factor (squared) at a table node.
+//! The target is placed at the center azimuth of the sector, and at the ground range and altitude of the node.
+float WsfEM_ALARM_Propagation::ComputeTableNode(Context&                  aContext,
+                                                WsfEM_Interaction&        aInteraction,
+                                                WsfEM_XmtrRcvr*           aXmtrRcvrPtr,
+                                                const FactorArgs&         aArgs,
+                                                const FactorTable::Index& aIndex)
+{
+   double az           = std::get<0>(aIndex) * mFactorTableSectorWidth;
+   double ground_range = std::get<1>(aIndex) * mFactorTableRangeStep;
+   double tgt_alt_msl  = std::get<2>(aIndex) * mFactorTableAltitudeStep;
+
+   // Locate the target on the (spherical) earth. This is the inverse of the computation in ComputeGeometry.
+   double betat   = ground_range / rezero;
+   double siphis  = sin(aArgs.rdr_lat);
+   double cophis  = cos(aArgs.rdr_lat);
+   double siphit  = siphis * cos(betat) + cophis * sin(betat) * cos(az);
+   double tgt_lat = asin(siphit);
+   double tgt_lon = aArgs.rdr_lon + atan2(sin(az) * sin(betat) * cophis, cos(betat) - siphis * siphit);
+
+   // The geometry is always computed with respect to the transmitter (see ComputePropagationFactor).
+   FactorArgs args = aArgs;
+   double     rdr_alt_msl;
+   WsfEM_ALARM_Geometry::ComputeGeometry(aInteraction.GetTransmitter(),
+                                         nullptr,
+                                         aInteraction.GetTransmitter(),
+                                         rdr_alt_msl,
+                                         args.rdr_lat,
+                                         args.rdr_lon,
+                                         args.rkfact,
+                                         tgt_alt_msl,
+                                         tgt_lat,
+                                         tgt_lon,
+                                         args.ground_range,
+                                         args.tanept,
+                                         args.slant_range,
+                                         args.tgt_az,
+                                         args.tgt_el,
+                                         args.tgt_x,
+                                         args.tgt_z);
+   args.tgt_alt_msl = tgt_alt_msl;
+   args.tgt_lat     = tgt_lat;
+   args.tgt_lon     = tgt_lon;
+
+   antenna node_ant(aXmtrRcvrPtr, aInteraction, args.tgt_az, args.tgt_el, args.slant_range);
+   COMPLEX fsquared(1.0, 0.0);
+   bool    masked = false;
+   ComputeExactFactor(aContext, node_ant, args, fsquared, masked);
+   return cabs(fsquared);
+}
+
 // =================================================================================================
 // virtual
 bool WsfEM_ALARM_Propagation::Initialize(WsfEM_XmtrRcvr* aXmtrRcvrPtr)
@@ -565,6 +775,65 @@ bool WsfEM_ALARM_Propagation::ProcessInput(UtInput& aInput)
       aInput.ReadValue(useAFSIM_TerrainMasking);
       WsfEM_ALARM_Terrain::SetUseAFSIM_TerrainMasking(useAFSIM_TerrainMasking);
    }
+   else if (command == "terrain_profile_cache_size")
+   {
+      int cacheSize;
+      aInput.ReadValue(cacheSize);
+      aInput.ValueGreaterOrEqual(cacheSize, 0);
+      mProfileCacheOptions.mSize = static_cast<unsigned int>(cacheSize);
+   }
+   else if (command == "terrain_profile_cache_azimuth_resolution")
+   {
+      double resolution;
+      aInput.ReadValueOfType(resolution, UtInput::cANGLE);
+      aInput.ValueGreaterOrEqual(resolution, 0.0);
+      mProfileCacheOptions.mAzimuthResolution = resolution;
+   }
+   else if (command == "propagation_factor_table")
+   {
+      aInput.ReadValue(mUseFactorTable);
+   }
+   else if (command == "propagation_factor_table_range_step")
+   {
+      aInput.ReadValueOfType(mFactorTableRangeStep, UtInput::cLENGTH);
+      aInput.ValueGreater(mFactorTableRangeStep, 0.0);
+   }
+   else if (command == "propagation_factor_table_altitude_step")
+   {
+      aInput.ReadValueOfType(mFactorTableAltitudeStep, UtInput::cLENGTH);
+      aInput.ValueGreater(mFactorTableAltitudeStep, 0.0);
+   }
+   else if (command == "propagation_factor_table_azimuth_sector")
+   {
+      aInput.ReadValueOfType(mFactorTableSectorWidth, UtInput::cANGLE);
+      aInput.ValueGreater(mFactorTableSectorWidth, 0.0);
+   }
+   else if (command == "propagation_factor_table_tolerance")
+   {
+      aInput.ReadValueOfType(mFactorTableTolerance, UtInput::cRATIO);
+      aInput.ValueGreaterOrEqual(mFactorTableTolerance, 1.0);
+   }
+   else if (command == "propagation_factor_table_null_threshold")
+   {
+      aInput.ReadValueOfType(mFactorTableNullThreshold, UtInput::cRATIO);
+      aInput.ValueGreaterOrEqual(mFactorTableNullThreshold, 0.0);
+   }
+   else if (command == "special_function_tables")
+   {
+      aInput.ReadValue(mUseSpecialFunctionTables);
+   }
+   else if (command == "special_function_self_test") // for test only; do not document.
+   {
+      if (!WsfEM_ALARM_SpecialFunctions::RunSelfTest(&airy, &fresnl, airzro, airdot, airy_terms))
+      {
+         throw UtInput::BadValue(aInput, "ALARM special functions are outside their documented accuracy.");
+      }
+   }
+   else if (command == "interaction_data_benchmark") // for test only; do not document.
+   {
+      aInput.ReadValue(mInteractionBenchmarkCount);
+      aInput.ValueGreater(mInteractionBenchmarkCount, 0);
+   }
    else if (command == "unit_test_propagation") // for test only; do not document.
    {
       aInput.ReadValue(mUnitTestPropagation);
@@ -824,7 +1093,8 @@ bool WsfEM_ALARM_Propagation::ProcessInput(UtInput& aInput)
 //                      statement. See SPCR #1357.
 //---------------------------------------------------------------------
 
-void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
+void WsfEM_ALARM_Propagation::laprop(Context& aContext,
+                                     antenna& ant_data,
                                      double   alphat,
                                      double   const3,
                                      double   const4,
@@ -915,10 +1185,6 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
    // Local variables
    //-------------------------------------------------------------------
 
-   enum
-   {
-      hunk = 512
-   };
    enum
    {
       mxacol = 1
@@ -941,7 +1207,7 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
 
    bool convrg;
 
-   // NOTE-C++ The following have been moved to class static variables
+   // NOTE-C++ The following have been moved to the terrain context
    // logical,              save :: uninit   = true
    // integer,              save :: aprofile = 0
    // real(8), allocatable, save :: dratio(:)
@@ -952,6 +1218,15 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
    // logical, allocatable, save :: visibl(:)
    // real(8), allocatable, save :: xprofl(:)
    // real(8), allocatable, save :: zprofl(:)
+   WsfEM_ALARM_Terrain::Profile& profile = aContext.mPropagationProfile;
+   std::vector<double>&          dratio  = profile.dratio;
+   std::vector<double>&          elvmsl  = profile.elvmsl;
+   std::vector<int>&             iend    = profile.iend;
+   std::vector<int>&             istart  = profile.istart;
+   std::vector<double>&          tanepp  = profile.tanepp;
+   std::vector<bool>&            visibl  = profile.visibl;
+   std::vector<double>&          xprofl  = profile.xprofl;
+   std::vector<double>&          zprofl  = profile.zprofl;
 
    double hammsl;
 
@@ -959,42 +1234,13 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
    // Allocate profile arrays as necessary.
    //-------------------------------------------------------------------
    nprofl = WsfEM_ALARM_Terrain::get_nprofile(grangt);
-
-   if ((nprofl > aprofile) || uninit)
-   {
-      uninit = false;
-
-      //----------------------------------------------------------------
-      // Allocate arrays.  Memory is allocated in hunks to minimize
-      // allocate/deallocate thrashing if nprofl is gradually creeping
-      // up.
-      //----------------------------------------------------------------
-      aprofile = aprofile + (abs(nprofl / hunk) + 1) * hunk;
-
-      // NOTE: Arrays that are start at index 1 will still have element 0 allocated
-      //       (but ignored) so as to allow the code to continue 1-based indexing.
-      dratio.resize(aprofile + 1); // 0:aprofile
-      elvmsl.resize(aprofile + 1); // 1:aprofile
-      iend.resize(aprofile + 1);   // 1:aprofile
-      istart.resize(aprofile + 1); // 1:aprofile
-      tanepp.resize(aprofile + 1); // 1:aprofile
-      visibl.resize(aprofile + 1); // 1:aprofile
-      xprofl.resize(aprofile + 1); // 0:aprofile
-      zprofl.resize(aprofile + 1); // 0:aprofile
-
-      // allocate(dratio(0:aprofile), elvmsl(aprofile), &
-      //      &   iend(aprofile),     istart(aprofile), &
-      //      &   tanepp(aprofile),   visibl(aprofile),&
-      //      &   xprofl(0:aprofile), zprofl(0:aprofile), stat = i)
-
-      // if (i != 0) then
-      //    call fatal_error('LAPROP', 'Can't allocate memory')
-      // end if
-   }
+   profile.Allocate(nprofl);
 
    hammsl = get_height_msl(ant_data);
    wsf::Terrain terrain(mSimulationPtr->GetTerrainInterface());
-   /*call*/ WsfEM_ALARM_Terrain::profil(terrain,
+   /*call*/ WsfEM_ALARM_Terrain::profil(aContext,
+                                        mProfileCacheOptions,
+                                        terrain,
                                         mSimulationPtr->GetScenario().GetEnvironment(),
                                         alphat,
                                         epslnt,
@@ -1121,7 +1367,8 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
                         // diffraction loss.
                         //----------------------------------------------
 
-                        /*call*/ kediff(ant_data,
+                        /*call*/ kediff(aContext,
+                                        ant_data,
                                         alphat,
                                         dratio,
                                         epslnt,
@@ -1164,7 +1411,8 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
                            // FSUBM, the multipath loss.
                            //-------------------------------------------
 
-                           /*call*/ mltpth(ant_data,
+                           /*call*/ mltpth(aContext,
+                                           ant_data,
                                            alphat,
                                            epslnt,
                                            epsln1,
@@ -1212,7 +1460,8 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
                            // the knife-edge diffraction loss.
                            //-------------------------------------------
 
-                           /*call*/ kediff(ant_data,
+                           /*call*/ kediff(aContext,
+                                           ant_data,
                                            alphat,
                                            dratio,
                                            epslnt,
@@ -1243,7 +1492,8 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
                         // diffraction loss.
                         //----------------------------------------------
 
-                        /*call*/ kediff(ant_data,
+                        /*call*/ kediff(aContext,
+                                        ant_data,
                                         alphat,
                                         dratio,
                                         epslnt,
@@ -1271,7 +1521,7 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
                   // the knife-edge diffraction loss.
                   //----------------------------------------------------
 
-                  /*call*/ kediff(ant_data, alphat, dratio, epslnt, fsubk, hammsl, indxfc, nprofl, rlamda, xprofl, xtprof, zprofl, ztprof);
+                  /*call*/ kediff(aContext, ant_data, alphat, dratio, epslnt, fsubk, hammsl, indxfc, nprofl, rlamda, xprofl, xtprof, zprofl, ztprof);
 
                   fpprop = cmplx(real(fsubk));
 
@@ -1284,7 +1534,8 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
                // multipath loss and diffraction loss.  Call subroutine
                // MLTPTH to determine FSUBM, the multipath loss.
                //-------------------------------------------------------
-               /*call*/ mltpth(ant_data,
+               /*call*/ mltpth(aContext,
+                               ant_data,
                                alphat,
                                epslnt,
                                epsln1,
@@ -1380,7 +1631,8 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
                         // FSUBK, the knife-edge diffraction loss.
                         //----------------------------------------------
 
-                        /*call*/ kediff(ant_data,
+                        /*call*/ kediff(aContext,
+                                        ant_data,
                                         alphat,
                                         dratio,
                                         epslnt,
@@ -1447,7 +1699,8 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
                         // diffraction loss.
                         //----------------------------------------------
 
-                        /*call*/ kediff(ant_data,
+                        /*call*/ kediff(aContext,
+                                        ant_data,
                                         alphat,
                                         dratio,
                                         epslnt,
@@ -1487,7 +1740,7 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
                   // to FSUBK, the knife-edge diffraction loss.
                   //----------------------------------------------------
 
-                  /*call*/ kediff(ant_data, alphat, dratio, epslnt, fsubk, hammsl, indxfc, nprofl, rlamda, xprofl, xtprof, zprofl, ztprof);
+                  /*call*/ kediff(aContext, ant_data, alphat, dratio, epslnt, fsubk, hammsl, indxfc, nprofl, rlamda, xprofl, xtprof, zprofl, ztprof);
 
                   fsubd = fsubk;
 
@@ -1517,7 +1770,8 @@ void WsfEM_ALARM_Propagation::laprop(antenna& ant_data,
                // multipath loss.
                //----------------------------------------------------------
 
-               /*call*/ mltpth(ant_data,
+               /*call*/ mltpth(aContext,
+                               ant_data,
                                alphat,
                                epslnt,
                                epsln1,
@@ -2286,50 +2540,6 @@ void WsfEM_ALARM_Propagation::sediff(antenna&                   ant_data,
 
    //-------------------------------------------------------------------
 
-   const double airdot[iterations + 1] = {0.0,        0.70121E0, -0.80311E0, 0.86520E0, -0.91085E0, 0.94733E0,
-                                          -0.97792E0, 1.00437E0, -1.02773E0, 1.04872E0, -1.06779E0, 1.08530E0,
-                                          -1.10150E0, 1.11659E0, -1.13073E0, 1.14403E0, -1.15660E0, 1.16853E0,
-                                          -1.17988E0, 1.19070E0, -1.20106E0, 1.21098E0, -1.22052E0, 1.22970E0,
-                                          -1.23854E0, 1.24708E0, -1.25534E0, 1.26334E0, -1.27109E0, 1.27861E0,
-                                          -1.28592E0, 1.29302E0, -1.29994E0, 1.30667E0, -1.31324E0, 1.31965E0};
-
-   const double airzro[iterations + 1] = {0.0,
-                                          -2.33810741E0,
-                                          -4.08794944E0,
-                                          -5.52055983E0,
-                                          -6.78670809E0,
-                                          -7.94413359E0,
-                                          -9.02265085E0,
-                                          -10.04017434E0,
-                                          -11.00852430E0,
-                                          -11.93601556E0,
-                                          -12.82877675E0,
-                                          -13.69148903E0,
-                                          -14.52782995E0,
-                                          -15.34075514E0,
-                                          -16.13268516E0,
-                                          -16.90563400E0,
-                                          -17.66130011E0,
-                                          -18.40113260E0,
-                                          -19.12638047E0,
-                                          -19.83812989E0,
-                                          -20.53733291E0,
-                                          -21.22482994E0,
-                                          -21.90136760E0,
-                                          -22.56761292E0,
-                                          -23.22416500E0,
-                                          -23.87156446E0,
-                                          -24.51030124E0,
-                                          -25.14082117E0,
-                                          -25.76353140E0,
-                                          -26.37880505E0,
-                                          -26.98698511E0,
-                                          -27.58838781E0,
-                                          -28.18330550E0,
-                                          -28.77200917E0,
-                                          -29.35475056E0,
-                                          -29.93176412E0};
-
    rearth = rkfact * rezero;
 
    /*call*/ parfit(apara0, apara1, apara2, deltag, elvmsl, nprofl);
@@ -2384,12 +2594,57 @@ void WsfEM_ALARM_Propagation::sediff(antenna&                   ant_data,
    atjm1  = 10000.0;
    fofxyz = cmplx(0.0, 0.0);
 
+   // NOTE-C++: If enabled, the airy terms for all iterations are interpolated from a table. If the arguments
+   // are outside the table the terms are evaluated with the batched Airy function, 'airy_block' terms at a time
+   // (the series usually converges well before all the iterations are needed).
+   enum
+   {
+      airy_block = 8
+   };
+   COMPLEX fsubny_table[iterations + 1];
+   COMPLEX fsubnz_table[iterations + 1];
+   int     table_count = 0;
+   if (mUseSpecialFunctionTables)
+   {
+      static const WsfEM_ALARM_SpecialFunctions::ResidueTable residues(&airy, airzro, airdot, iterations);
+      if (residues.Evaluate(yargmt, fsubny_table) && residues.Evaluate(zargmt, fsubnz_table))
+      {
+         table_count = iterations;
+      }
+   }
+
    for (j = 1; j <= iterations; ++j)
    {
       znexpy = cmplx(airzro[j], 0.0) + ep1pi3 * cmplx(yargmt, 0.0);
-      fsubny = airy(znexpy) / (ep1pi3 * cmplx(airdot[j], 0.0));
       znexpz = cmplx(airzro[j], 0.0) + ep1pi3 * cmplx(zargmt, 0.0);
-      fsubnz = airy(znexpz) / (ep1pi3 * cmplx(airdot[j], 0.0));
+      if (mUseSpecialFunctionTables && (j > table_count))
+      {
+         COMPLEX args[2 * airy_block];
+         COMPLEX values[2 * airy_block];
+         int     count = std::min(static_cast<int>(airy_block), iterations + 1 - j);
+         for (int k = 0; k < count; ++k)
+         {
+            args[k]         = cmplx(airzro[j + k], 0.0) + ep1pi3 * cmplx(yargmt, 0.0);
+            args[count + k] = cmplx(airzro[j + k], 0.0) + ep1pi3 * cmplx(zargmt, 0.0);
+         }
+         WsfEM_ALARM_SpecialFunctions::Airy(args, values, 2 * count);
+         for (int k = 0; k < count; ++k)
+         {
+            fsubny_table[j + k] = values[k] / (ep1pi3 * cmplx(airdot[j + k], 0.0));
+            fsubnz_table[j + k] = values[count + k] / (ep1pi3 * cmplx(airdot[j + k], 0.0));
+         }
+         table_count = j + count - 1;
+      }
+      if (mUseSpecialFunctionTables)
+      {
+         fsubny = fsubny_table[j];
+         fsubnz = fsubnz_table[j];
+      }
+      else
+      {
+         fsubny = airy(znexpy) / (ep1pi3 * cmplx(airdot[j], 0.0));
+         fsubnz = airy(znexpz) / (ep1pi3 * cmplx(airdot[j], 0.0));
+      }
 
       psi    = ctwoth * (znexpy * csqrt(znexpy));
       zeta   = ctwoth * (znexpz * csqrt(znexpz));
@@ -2554,7 +2809,8 @@ label_20:;
 //                      OFFAZT from argument list.  See SPCR #1310.
 //---------------------------------------------------------------------
 
-void WsfEM_ALARM_Propagation::kediff(antenna&                   ant_data,
+void WsfEM_ALARM_Propagation::kediff(Context&                   aContext,
+                                     antenna&                   ant_data,
                                      double                     alphat,
                                      std::vector<double>&       dratio,
                                      double                     epslnt,
@@ -2615,9 +2871,11 @@ void WsfEM_ALARM_Propagation::kediff(antenna&                   ant_data,
 
    int i, ileft, imain, iright, isave, j, k, l, nedges, nlocal;
 
-   // moved to header
+   // moved to the terrain context
    // static int indxmx_size = 0;
    // static std::vector<int> indxmx;
+   int&              indxmx_size = aContext.indxmx_size;
+   std::vector<int>& indxmx      = aContext.indxmx;
 
    //-------------------------------------------------------------------
    // Allocate memory and initialize
@@ -2855,7 +3113,22 @@ void WsfEM_ALARM_Propagation::kediff(antenna&                   ant_data,
       // Determine FSUBK, the knife-edge diffraction loss.
       //----------------------------------------------------------------
 
-      /*call*/ deygou(ant_data, alphat, dratio, epslnt, fsubk, hammsl, ileft, imain, indxfc, iright, rlamda, xprofl, xtprof, zprofl, ztprof);
+      /*call*/ deygou(ant_data,
+                      alphat,
+                      dratio,
+                      epslnt,
+                      fsubk,
+                      hammsl,
+                      ileft,
+                      imain,
+                      indxfc,
+                      iright,
+                      rlamda,
+                      xprofl,
+                      xtprof,
+                      zprofl,
+                      ztprof,
+                      mUseSpecialFunctionTables);
    }
    if (DebugEnabled())
    {
@@ -3529,7 +3802,8 @@ void WsfEM_ALARM_Propagation::deygou(antenna&                   ant_data,
                                      const std::vector<double>& xprofl,
                                      double                     xtprof,
                                      const std::vector<double>& zprofl,
-                                     double                     ztprof)
+                                     double                     ztprof,
+                                     bool                       use_tables)
 {
    // use physical_consts, only : sqrt2
    // use propagation_consts
@@ -3613,7 +3887,7 @@ void WsfEM_ALARM_Propagation::deygou(antenna&                   ant_data,
       //----------------------------------------------------------------
 
       w = sqrt2 * ratiom;
-      /*call*/ fresnl(fcoswi, fsinwi, w);
+      /*call*/ fresnl_table(fcoswi, fsinwi, w, use_tables);
 
       fmain = sqrt(pow((fcoswi + 0.5), 2) + pow((fsinwi + 0.5), 2)) / sqrt2;
 
@@ -3702,7 +3976,7 @@ void WsfEM_ALARM_Propagation::deygou(antenna&                   ant_data,
          //-------------------------------------------------------------
 
          w = sqrt2 * ratiol;
-         /*call*/ fresnl(fcoswi, fsinwi, w);
+         /*call*/ fresnl_table(fcoswi, fsinwi, w, use_tables);
 
          fleft = sqrt(pow((fcoswi + 0.5), 2) + pow((fsinwi + 0.5), 2)) / sqrt2;
       }
@@ -3768,7 +4042,7 @@ void WsfEM_ALARM_Propagation::deygou(antenna&                   ant_data,
          //-------------------------------------------------------------
 
          w = sqrt2 * ratior;
-         /*call*/ fresnl(fcoswi, fsinwi, w);
+         /*call*/ fresnl_table(fcoswi, fsinwi, w, use_tables);
 
          fright = sqrt(pow((fcoswi + 0.5), 2) + pow((fsinwi + 0.5), 2)) / sqrt2;
       }
@@ -3997,6 +4271,22 @@ void WsfEM_ALARM_Propagation::fresnl(double& cosint, double& sinint, double xarg
    }
 }
 
+// =================================================================================================
+//! The Fresnel cosine and sine integrals, interpolated from a table if use_tables is true ('special_function_tables').
+// static
+void WsfEM_ALARM_Propagation::fresnl_table(double& cosint, double& sinint, double xargmt, bool use_tables)
+{
+   if (use_tables)
+   {
+      static const WsfEM_ALARM_SpecialFunctions::FresnelTable table(&fresnl);
+      if (table.Evaluate(cosint, sinint, xargmt))
+      {
+         return;
+      }
+   }
+   fresnl(cosint, sinint, xargmt);
+}
+
 // =================================================================================================
 // Code from ALARM 'multipath.f90'
 // =================================================================================================
@@ -4253,7 +4543,8 @@ void WsfEM_ALARM_Propagation::fresnl(double& cosint, double& sinint, double xarg
 //                     See SPCR #1310.
 //---------------------------------------------------------------------
 
-void WsfEM_ALARM_Propagation::mltpth(antenna&                   ant_data,
+void WsfEM_ALARM_Propagation::mltpth(const Context&             aContext,
+                                     antenna&                   ant_data,
                                      double                     alphat,
                                      double                     epslnt,
                                      double                     epsln1,
@@ -4402,7 +4693,7 @@ void WsfEM_ALARM_Propagation::mltpth(antenna&                   ant_data,
    freqhz     = vlight / rlamda;
    pulsew     = vlight * pulwid * 1.0E-6 / 2.0E0;
    sumwid     = 0.0;
-   terrain_sw = WsfEM_ALARM_Terrain::get_terrain_sw();
+   terrain_sw = aContext.get_terrain_sw();
 
    if (use_surface_height)
    {
@@ -27,11 +27,15 @@
 #define WSFEM_ALARM_PROPAGATION_HPP
 
 #include <complex>
+#include <map>
+#include <mutex>
 #include <string>
+#include <tuple>
 #include <vector>
 
 class WsfEM_Antenna;
 #include "WsfEM_ALARM_Antenna.hpp"
+#include "WsfEM_ALARM_Terrain.hpp"
 #include "WsfEM_Interaction.hpp"
 #include "WsfEM_Propagation.hpp"
 #include "WsfEM_Types.hpp"
@@ -67,10 +71,80 @@ protected:
 private:
    using COMPLEX = std::complex<float>;
    using antenna = WsfEM_ALARM_Antenna::antenna;
+   using Context = WsfEM_ALARM_Terrain::Context;
+
+   //! The inputs to laprop that are common to the transmit and receive antennas.
+   struct FactorArgs
+   {
+      double const3;
+      double const4;
+      double deltag;
+      int    polarization;
+      bool   water_cover;
+      double pulse_width;  // usec
+      double wavelength;   // meters
+      double ground_range; // meters
+      double tgt_alt_msl;  // meters
+      double slant_range;  // meters
+      double rkfact;
+      double rdr_lat; // radians
+      double rdr_lon; // radians
+      double tanept;
+      double tgt_lat; // radians
+      double tgt_lon; // radians
+      double tgt_az;  // radians
+      double tgt_el;  // radians
+      double tgt_x;   // meters
+      double tgt_z;   // meters
+   };
+
+   //! A tabulated pattern propagation factor for one antenna (see 'propagation_factor_table').
+   //! The magnitude of the factor is stored on a (azimuth sector, ground range, target altitude MSL)
+   //! grid. Nodes are evaluated when a cell is first used. A cell is only interpolated after it has
+   //! agreed with the exact evaluation at cVALIDATION_SAMPLES points, and it is checked again every
+   //! cREVALIDATION_INTERVAL uses. A cell that disagrees is evaluated exactly from then on.
+   //! The table is cleared when it reaches cMAX_CELLS cells or cMAX_NODES nodes.
+   struct FactorTable
+   {
+      static const unsigned int cVALIDATION_SAMPLES    = 3;
+      static const unsigned int cREVALIDATION_INTERVAL = 64;
+      static const size_t       cMAX_CELLS             = 65536;
+      static const size_t       cMAX_NODES             = 4 * cMAX_CELLS;
+
+      struct Cell
+      {
+         unsigned int mValidCount = 0;     //!< The number of exact evaluations that agreed with the table
+         unsigned int mUseCount   = 0;     //!< The number of interpolations since the last check
+         bool         mExact      = false; //!< true if the cell must be evaluated exactly
+      };
+
+      using Index = std::tuple<int, int, int>; // (sector, ground range, altitude)
+
+      std::vector<double>    mSignature; //!< The inputs that were used to build the table
+      std::map<Index, float> mNodes;
+      std::map<Index, Cell>  mCells;
+   };
+
+   void ComputeFactor(Context&           aContext,
+                      WsfEM_Interaction& aInteraction,
+                      WsfEM_XmtrRcvr*    aXmtrRcvrPtr,
+                      antenna&           ant_data,
+                      const FactorArgs&  aArgs,
+                      COMPLEX&           fsquared,
+                      bool&              masked);
+
+   void ComputeExactFactor(Context& aContext, antenna& ant_data, const FactorArgs& aArgs, COMPLEX& fsquared, bool& masked);
+
+   float ComputeTableNode(Context&                  aContext,
+                          WsfEM_Interaction&        aInteraction,
+                          WsfEM_XmtrRcvr*           aXmtrRcvrPtr,
+                          const FactorArgs&         aArgs,
+                          const FactorTable::Index& aIndex);
 
    //! @name from ALARM propagation.f90
    //{@
-   void        laprop(antenna& ant_data,
+   void        laprop(Context& aContext,
+                      antenna& ant_data,
                       double   alphat,
                       double   const3,
                       double   const4,
@@ -149,7 +223,8 @@ private:
                const std::vector<double>& xprofl,
                const std::vector<double>& zprofl);
 
-   void kediff(antenna&                   ant_data,
+   void kediff(Context&                   aContext,
+               antenna&                   ant_data,
                double                     alphat,
                std::vector<double>&       dratio,
                double                     epslnt,
@@ -188,14 +263,18 @@ private:
                       const std::vector<double>& xprofl,
                       double                     xtprof,
                       const std::vector<double>& zprofl,
-                      double                     ztprof);
+                      double                     ztprof,
+                      bool                       use_tables);
 
    static void fresnl(double& cosint, double& sinint, double xargmt);
+
+   static void fresnl_table(double& cosint, double& sinint, double xargmt, bool use_tables);
    //@}
 
    //! @name from ALARAM multipath.f90
    //@{
-   void mltpth(antenna&                   ant_data,
+   void mltpth(const Context&             aContext,
+               antenna&                   ant_data,
                double                     alphat,
                double                     epslnt,
                double                     epsln1,
@@ -261,33 +340,36 @@ private:
    bool sea_water;
    bool use_surface_height;
 
-   //! @name Internal saved variables in LAPROP.
-   //! The following variables were local variables in LAPROP that had the 'SAVE'd attribute.
-   //! They could have remained in LAPROP as locally scoped static variables, but I decided
-   //! to move them out here in preparation for multi-threading.
-   //!
-   //! @note As written the code is NOT thread-safe!!!
-   //@{
-   static bool                uninit;
-   static int                 aprofile;
-   static std::vector<double> dratio;
-   static std::vector<double> elvmsl;
-   static std::vector<int>    iend;
-   static std::vector<int>    istart;
-   static std::vector<double> tanepp;
-   static std::vector<bool>   visibl;
-   static std::vector<double> xprofl;
-   static std::vector<double> zprofl;
-
-   static int              indxmx_size;
-   static std::vector<int> indxmx;
-   //@}
-
    bool           mUseMIT_LL_DataTables; // true if to use MIT-LL data tables (from SALRAM)
    bool           mAllowCalculationShortcuts;
    int            mWSF_LandCover; // land cover from WSF environment
    int            mWSF_LandForm;  // land form from WSF environment
    int            mWSF_SeaState;  // sea state from WSF environment
+
+   //! Terrain profile cache controls ('terrain_profile_cache_size' and 'terrain_profile_cache_azimuth_resolution').
+   WsfEM_ALARM_Terrain::ProfileCacheOptions mProfileCacheOptions;
+
+   //! true if diffraction uses the approximations in WsfEM_ALARM_SpecialFunctions ('special_function_tables').
+   bool mUseSpecialFunctionTables;
+
+   //! The number of detection attempts timed by WsfEM_ALARM_InteractionData::RunBenchmark for the first
+   //! interaction ('interaction_data_benchmark'; 0 = none).
+   int mInteractionBenchmarkCount;
+
+   //! @name Tabulated propagation factor ('propagation_factor_table' and related commands).
+   //@{
+   bool   mUseFactorTable;
+   double mFactorTableRangeStep;     //!< meters
+   double mFactorTableAltitudeStep;  //!< meters
+   double mFactorTableSectorWidth;   //!< radians
+   double mFactorTableTolerance;     //!< absolute ratio (>= 1)
+   double mFactorTableNullThreshold; //!< absolute ratio
+
+   //! The tables, by the transmitter or receiver whose antenna they represent.
+   std::map<WsfEM_XmtrRcvr*, FactorTable> mFactorTables;
+   std::mutex                             mFactorTableMutex; //!< Protects mFactorTables
+   //@}
+
    WsfSimulation* mSimulationPtr;
 };
 #endif
@@ -0,0 +1,519 @@
+// ****************************************************************************
+// CUI//REL TO USA ONLY
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfEM_ALARM_SpecialFunctions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib> // for abs(int)
+
+#include "UtLog.hpp"
+#include "UtWallClock.hpp"
+#include "WsfEM_ALARM_Fortran.hpp"
+
+namespace
+{
+using COMPLEX = WsfEM_ALARM_SpecialFunctions::COMPLEX;
+
+// The residue table covers cRESIDUE_STEP <= y < cRESIDUE_MAX_Y.
+const double cRESIDUE_MAX_Y = 32.0;
+const double cRESIDUE_STEP  = 1.0 / 32.0;
+
+// The Fresnel table covers |x| < cFRESNEL_MAX_X.
+const double cFRESNEL_MAX_X = 8.0;
+const double cFRESNEL_STEP  = 1.0 / 128.0;
+
+const COMPLEX cEP1PI3(0.5F, 0.86602540F);   // (+0.5,+sqr3o2)
+const COMPLEX cEM1PI3(0.5F, -0.86602540F);  // (+0.5,-sqr3o2)
+const COMPLEX cEP2PI3(-0.5F, 0.86602540F);  // (-0.5,+sqr3o2)
+const COMPLEX cEM2PI3(-0.5F, -0.86602540F); // (-0.5,-sqr3o2)
+const COMPLEX cFORTH(1.33333333F, 0.0F);    // (forthr,0.0)
+const COMPLEX cTWOTH(0.66666667F, 0.0F);    // (twothr,0.0)
+
+// The number of arguments evaluated together by Airy. 'conect' needs two series per argument.
+const int cAIRY_BLOCK = 32;
+const int cSERIES_MAX = 2 * cAIRY_BLOCK;
+
+// The coefficients from WsfEM_ALARM_Propagation::gaussq.
+const float cGAUSSQ_WEIGHT[] = {0.0F,
+                                2.677084371247434E-14F,
+                                6.636768688175870E-11F,
+                                1.758405638619854E-08F,
+                                1.371239148976848E-06F,
+                                4.435096659959217E-05F,
+                                7.155501075431907E-04F,
+                                6.488956601264211E-03F,
+                                3.644041585109798E-02F,
+                                1.439979241604145E-01F,
+                                8.123114134235980E-01F};
+
+const float cGAUSSQ_ZEROES[] = {0.0F,
+                                1.408308107197377E+01F,
+                                1.021488548060315E+01F,
+                                7.441601846833691E+00F,
+                                5.307094307915284E+00F,
+                                3.634013504378772E+00F,
+                                2.331065231384954E+00F,
+                                1.344797083139945E+00F,
+                                6.418885840366331E-01F,
+                                2.010034600905718E-01F,
+                                8.059435921534400E-03F};
+
+// The coefficients from WsfEM_ALARM_Propagation::powers.
+const float cPOWERS_GCOEFF[] = {0.0F,    12.0F,   42.0F,   90.0F,   156.0F,  240.0F,  342.0F,  462.0F,   600.0F,
+                                756.0F,  930.0F,  1122.0F, 1332.0F, 1560.0F, 1806.0F, 2070.0F, 2352.0F,  2652.0F,
+                                2970.0F, 3306.0F, 3660.0F, 4032.0F, 4422.0F, 4830.0F, 5256.0F, 5700.0F,  6162.0F,
+                                6642.0F, 7140.0F, 7656.0F, 8190.0F, 8742.0F, 9312.0F, 9900.0F, 10506.0F, 11130.0F};
+
+const float cPOWERS_HCOEFF[] = {0.0F,    6.0F,    30.0F,   72.0F,   132.0F,  210.0F,  306.0F,  420.0F,   552.0F,
+                                702.0F,  870.0F,  1056.0F, 1260.0F, 1482.0F, 1722.0F, 1980.0F, 2256.0F,  2550.0F,
+                                2862.0F, 3192.0F, 3540.0F, 3906.0F, 4290.0F, 4692.0F, 5112.0F, 5550.0F,  6006.0F,
+                                6480.0F, 6972.0F, 7482.0F, 8010.0F, 8556.0F, 9120.0F, 9702.0F, 10302.0F, 10920.0F};
+
+const int cPOWERS_MAX_TERMS = 35;
+
+// =================================================================================================
+//! The asymptotic series (WsfEM_ALARM_Propagation::gaussq) for aCount <= cSERIES_MAX arguments.
+//! The real and imaginary parts are kept in separate arrays so the inner loop vectorizes.
+void GaussqSeries(const COMPLEX* aArgs, COMPLEX* aValues, int aCount)
+{
+   float zetaRe[cSERIES_MAX];
+   float zetaIm[cSERIES_MAX];
+   float sumRe[cSERIES_MAX];
+   float sumIm[cSERIES_MAX];
+   for (int k = 0; k < aCount; ++k)
+   {
+      COMPLEX zeta = cTWOTH * aArgs[k] * csqrt(aArgs[k]);
+      zetaRe[k]    = zeta.real();
+      zetaIm[k]    = zeta.imag();
+      sumRe[k]     = 0.0F;
+      sumIm[k]     = 0.0F;
+   }
+
+   for (int i = 1; i <= 10; ++i)
+   {
+      const float weight = cGAUSSQ_WEIGHT[i];
+      const float zero   = cGAUSSQ_ZEROES[i];
+      for (int k = 0; k < aCount; ++k)
+      {
+         // sum += weight / (1 + zero / zeta)
+         float zetaMag2 = zetaRe[k] * zetaRe[k] + zetaIm[k] * zetaIm[k];
+         float denRe    = 1.0F + zero * zetaRe[k] / zetaMag2;
+         float denIm    = -zero * zetaIm[k] / zetaMag2;
+         float denMag2  = denRe * denRe + denIm * denIm;
+         sumRe[k] += weight * denRe / denMag2;
+         sumIm[k] -= weight * denIm / denMag2;
+      }
+   }
+
+   for (int k = 0; k < aCount; ++k)
+   {
+      aValues[k] = cmplx(dsqrpi, 0.0) / (csqrt(csqrt(aArgs[k]))) * COMPLEX(sumRe[k], sumIm[k]);
+   }
+}
+
+// =================================================================================================
+//! The power series (WsfEM_ALARM_Propagation::powers) for aCount <= cSERIES_MAX arguments.
+//! Every argument is iterated to the largest term count in the block; the extra terms are masked off.
+void PowersSeries(const COMPLEX* aArgs, COMPLEX* aValues, int aCount)
+{
+   const float alpha = 0.355028053887817F;
+   const float beta  = 0.258819403792807F;
+
+   int   termCount[cSERIES_MAX];
+   float cubedRe[cSERIES_MAX];
+   float cubedIm[cSERIES_MAX];
+   float hRe[cSERIES_MAX];
+   float hIm[cSERIES_MAX];
+   float gRe[cSERIES_MAX];
+   float gIm[cSERIES_MAX];
+   float fRe[cSERIES_MAX];
+   float fIm[cSERIES_MAX];
+   int   maxTermCount = 0;
+   for (int k = 0; k < aCount; ++k)
+   {
+      termCount[k]  = std::min(nint(7.0 + 4.0 * cabs(aArgs[k])), cPOWERS_MAX_TERMS);
+      maxTermCount  = std::max(maxTermCount, termCount[k]);
+      COMPLEX cubed = aArgs[k] * aArgs[k] * aArgs[k];
+      cubedRe[k]    = cubed.real();
+      cubedIm[k]    = cubed.imag();
+      hRe[k]        = 1.0F;
+      hIm[k]        = 0.0F;
+      gRe[k]        = aArgs[k].real();
+      gIm[k]        = aArgs[k].imag();
+      fRe[k]        = alpha - beta * gRe[k];
+      fIm[k]        = -beta * gIm[k];
+   }
+
+   for (int i = 1; i <= maxTermCount; ++i)
+   {
+      const float hcoeff = cPOWERS_HCOEFF[i];
+      const float gcoeff = cPOWERS_GCOEFF[i];
+      for (int k = 0; k < aCount; ++k)
+      {
+         // h = h / hcoeff * z^3, g = g / gcoeff * z^3, f += alpha * h - beta * g
+         float hr     = hRe[k] / hcoeff;
+         float hi     = hIm[k] / hcoeff;
+         float nextHr = hr * cubedRe[k] - hi * cubedIm[k];
+         float nextHi = hr * cubedIm[k] + hi * cubedRe[k];
+         float gr     = gRe[k] / gcoeff;
+         float gi     = gIm[k] / gcoeff;
+         float nextGr = gr * cubedRe[k] - gi * cubedIm[k];
+         float nextGi = gr * cubedIm[k] + gi * cubedRe[k];
+         bool  active = (i <= termCount[k]);
+         hRe[k]       = active ? nextHr : hRe[k];
+         hIm[k]       = active ? nextHi : hIm[k];
+         gRe[k]       = active ? nextGr : gRe[k];
+         gIm[k]       = active ? nextGi : gIm[k];
+         fRe[k]       = active ? (fRe[k] + alpha * nextHr - beta * nextGr) : fRe[k];
+         fIm[k]       = active ? (fIm[k] + alpha * nextHi - beta * nextGi) : fIm[k];
+      }
+   }
+
+   for (int k = 0; k < aCount; ++k)
+   {
+      aValues[k] = COMPLEX(fRe[k], fIm[k]) * cexp(cTWOTH * aArgs[k] * csqrt(aArgs[k]));
+   }
+}
+
+// =================================================================================================
+//! Evaluate the Airy function for aCount <= cAIRY_BLOCK arguments.
+void AiryBlock(const COMPLEX* aArgs, COMPLEX* aValues, int aCount)
+{
+   // Each argument needs one series, or two for 'conect'. The series are gathered by type, evaluated
+   // together and scattered back to aSeries[2 * k] and aSeries[2 * k + 1].
+   COMPLEX gaussqArgs[cSERIES_MAX];
+   COMPLEX gaussqValues[cSERIES_MAX];
+   int     gaussqSlots[cSERIES_MAX];
+   int     gaussqCount = 0;
+   COMPLEX powersArgs[cSERIES_MAX];
+   COMPLEX powersValues[cSERIES_MAX];
+   int     powersSlots[cSERIES_MAX];
+   int     powersCount = 0;
+   COMPLEX series[cSERIES_MAX];
+   bool    useConect[cAIRY_BLOCK];
+
+   // The selection made by 'airy' (without the 'conect' branch) and by 'conect'.
+   auto addSeries = [&](const COMPLEX& aArg, int aSlot)
+   {
+      double x     = real(aArg);
+      double limit = (x < 0.0) ? 4.0 : 2.0;
+      if (cabs(aArg) > limit)
+      {
+         gaussqArgs[gaussqCount]  = aArg;
+         gaussqSlots[gaussqCount] = aSlot;
+         ++gaussqCount;
+      }
+      else
+      {
+         powersArgs[powersCount]  = aArg;
+         powersSlots[powersCount] = aSlot;
+         ++powersCount;
+      }
+   };
+
+   for (int k = 0; k < aCount; ++k)
+   {
+      double x     = real(aArgs[k]);
+      useConect[k] = false;
+      if (x < 0.0)
+      {
+         // The same (unqualified) call as 'airy' so the same overload is selected.
+         double tanarg = aimag(aArgs[k]) / x;
+         useConect[k]  = (abs(tanarg) < dsqrt3);
+      }
+      if (useConect[k])
+      {
+         addSeries(aArgs[k] * cEM2PI3, 2 * k);
+         addSeries(aArgs[k] * cEP2PI3, 2 * k + 1);
+      }
+      else
+      {
+         addSeries(aArgs[k], 2 * k);
+      }
+   }
+
+   GaussqSeries(gaussqArgs, gaussqValues, gaussqCount);
+   PowersSeries(powersArgs, powersValues, powersCount);
+   for (int i = 0; i < gaussqCount; ++i)
+   {
+      series[gaussqSlots[i]] = gaussqValues[i];
+   }
+   for (int i = 0; i < powersCount; ++i)
+   {
+      series[powersSlots[i]] = powersValues[i];
+   }
+
+   for (int k = 0; k < aCount; ++k)
+   {
+      if (useConect[k])
+      {
+         // From WsfEM_ALARM_Propagation::conect
+         COMPLEX exparg = cFORTH * aArgs[k] * csqrt(aArgs[k]);
+         double  xr     = real(exparg);
+         double  yi     = aimag(exparg);
+         if (xr < -64.0)
+         {
+            xr = -64.0;
+         }
+         if (yi < -64.0)
+         {
+            yi = dmod(yi, twopi);
+         }
+         exparg       = cmplx(xr, yi);
+         COMPLEX zeta = cexp(exparg);
+         aValues[k]   = cEP1PI3 * series[2 * k] * zeta + cEM1PI3 * series[2 * k + 1];
+      }
+      else
+      {
+         aValues[k] = series[2 * k];
+      }
+   }
+}
+} // namespace
+
+namespace WsfEM_ALARM_SpecialFunctions
+{
+// =================================================================================================
+//! @param aAiry        The scalar 'airy' function.
+//! @param aZeros       The zeros of the Airy function, airzro(1:aTermCount).
+//! @param aDerivatives The derivative of the Airy function at the zeros, airdot(1:aTermCount).
+//! @param aTermCount   The number of terms in the residue series.
+ResidueTable::ResidueTable(AiryFunction aAiry, const double* aZeros, const double* aDerivatives, int aTermCount)
+   : mTermCount(aTermCount)
+   , mPointCount(static_cast<int>(cRESIDUE_MAX_Y / cRESIDUE_STEP) + 3)
+   , mValues(static_cast<size_t>(mPointCount) * (aTermCount + 1))
+{
+   for (int i = 0; i < mPointCount; ++i)
+   {
+      double   y   = i * cRESIDUE_STEP;
+      COMPLEX* row = &mValues[static_cast<size_t>(i) * (mTermCount + 1)];
+      for (int j = 1; j <= mTermCount; ++j)
+      {
+         COMPLEX znexp = cmplx(aZeros[j], 0.0) + cEP1PI3 * cmplx(y, 0.0);
+         row[j]        = aAiry(znexp) / (cEP1PI3 * cmplx(aDerivatives[j], 0.0));
+      }
+   }
+}
+
+// =================================================================================================
+//! Evaluate all the terms of the series for a given argument.
+//! @param aY     The argument (the normalized height).
+//! @param aTerms [output] aTerms[1..N] are the terms. aTerms[0] is not used.
+//! @returns true if the argument is within the table, false if the scalar routines must be used.
+bool ResidueTable::Evaluate(double aY, COMPLEX* aTerms) const
+{
+   // The first interval is not tabulated. 'airy' changes branches near y = 0, so a centered stencil is not
+   // available and a one-sided stencil is not accurate enough.
+   if ((aY < cRESIDUE_STEP) || (aY >= cRESIDUE_MAX_Y))
+   {
+      return false;
+   }
+
+   // The stencil is the points i-1, i, i+1 and i+2 around the interval [i, i+1).
+   double x    = aY / cRESIDUE_STEP;
+   int    base = static_cast<int>(x) - 1;
+   float  u    = static_cast<float>(x - base);
+
+   // Lagrange weights for the points at u = 0, 1, 2 and 3.
+   float w0 = -(u - 1.0F) * (u - 2.0F) * (u - 3.0F) / 6.0F;
+   float w1 = u * (u - 2.0F) * (u - 3.0F) / 2.0F;
+   float w2 = -u * (u - 1.0F) * (u - 3.0F) / 2.0F;
+   float w3 = u * (u - 1.0F) * (u - 2.0F) / 6.0F;
+
+   size_t         stride = static_cast<size_t>(mTermCount + 1);
+   const COMPLEX* p0     = &mValues[base * stride];
+   const COMPLEX* p1     = p0 + stride;
+   const COMPLEX* p2     = p1 + stride;
+   const COMPLEX* p3     = p2 + stride;
+   for (int j = 1; j <= mTermCount; ++j)
+   {
+      aTerms[j] = w0 * p0[j] + w1 * p1[j] + w2 * p2[j] + w3 * p3[j];
+   }
+   return true;
+}
+
+// =================================================================================================
+//! @param aFresnel The scalar 'fresnl' function.
+FresnelTable::FresnelTable(FresnelFunction aFresnel)
+   : mPointCount(static_cast<int>(cFRESNEL_MAX_X / cFRESNEL_STEP) + 2)
+   , mCosine(mPointCount)
+   , mSine(mPointCount)
+   , mCosineSlope(mPointCount)
+   , mSineSlope(mPointCount)
+{
+   for (int i = 0; i < mPointCount; ++i)
+   {
+      double x = i * cFRESNEL_STEP;
+      double z = halfpi * x * x;
+      aFresnel(mCosine[i], mSine[i], x);
+      mCosineSlope[i] = cos(z) * cFRESNEL_STEP;
+      mSineSlope[i]   = sin(z) * cFRESNEL_STEP;
+   }
+}
+
+// =================================================================================================
+//! Evaluate the Fresnel cosine and sine integrals.
+//! @returns true if the argument is within the table, false if the scalar routine must be used.
+bool FresnelTable::Evaluate(double& cosint, double& sinint, double xargmt) const
+{
+   double xabs = fabs(xargmt);
+   if (xabs >= cFRESNEL_MAX_X)
+   {
+      return false;
+   }
+
+   double x = xabs / cFRESNEL_STEP;
+   int    i = static_cast<int>(x);
+   double t = x - i;
+
+   // Cubic Hermite basis functions.
+   double h00 = (1.0 + 2.0 * t) * (1.0 - t) * (1.0 - t);
+   double h10 = t * (1.0 - t) * (1.0 - t);
+   double h01 = t * t * (3.0 - 2.0 * t);
+   double h11 = t * t * (t - 1.0);
+
+   cosint = h00 * mCosine[i] + h10 * mCosineSlope[i] + h01 * mCosine[i + 1] + h11 * mCosineSlope[i + 1];
+   sinint = h00 * mSine[i] + h10 * mSineSlope[i] + h01 * mSine[i + 1] + h11 * mSineSlope[i + 1];
+
+   // The integrals are odd functions.
+   if (xargmt < 0.0)
+   {
+      cosint = -cosint;
+      sinint = -sinint;
+   }
+   return true;
+}
+
+// =================================================================================================
+void Airy(const COMPLEX* aArgs, COMPLEX* aValues, int aCount)
+{
+   for (int first = 0; first < aCount; first += cAIRY_BLOCK)
+   {
+      AiryBlock(aArgs + first, aValues + first, std::min(cAIRY_BLOCK, aCount - first));
+   }
+}
+
+// =================================================================================================
+bool RunSelfTest(AiryFunction aAiry, FresnelFunction aFresnel, const double* aZeros, const double* aDerivatives, int aTermCount)
+{
+   auto logger = ut::log::info() << "ALARM special function self test:";
+
+   // The residue series terms, at points between the table nodes.
+   ResidueTable residues(aAiry, aZeros, aDerivatives, aTermCount);
+   std::vector<COMPLEX> terms(aTermCount + 1);
+   std::vector<COMPLEX> residueArgs;
+   std::vector<COMPLEX> residueExact;
+   double               residueAbsError = 0.0;
+   double               residueRelError = 0.0;
+   for (double y = cRESIDUE_STEP; y < cRESIDUE_MAX_Y; y += 0.00377)
+   {
+      residues.Evaluate(y, terms.data());
+      for (int j = 1; j <= aTermCount; ++j)
+      {
+         COMPLEX znexp = cmplx(aZeros[j], 0.0) + cEP1PI3 * cmplx(y, 0.0);
+         COMPLEX airy  = aAiry(znexp);
+         COMPLEX exact = airy / (cEP1PI3 * cmplx(aDerivatives[j], 0.0));
+         double  error = std::abs(terms[j] - exact);
+         residueAbsError = std::max(residueAbsError, error);
+         if (std::abs(exact) > 1.0E-3)
+         {
+            residueRelError = std::max(residueRelError, error / std::abs(exact));
+         }
+         residueArgs.push_back(znexp);
+         residueExact.push_back(airy);
+      }
+   }
+
+   // The Airy function, at the residue series arguments and beyond the tabulated range.
+   for (double y = 0.0; y < 2.0 * cRESIDUE_MAX_Y; y += 0.173)
+   {
+      for (int j = 1; j <= aTermCount; ++j)
+      {
+         COMPLEX znexp = cmplx(aZeros[j], 0.0) + cEP1PI3 * cmplx(y, 0.0);
+         residueArgs.push_back(znexp);
+         residueExact.push_back(aAiry(znexp));
+      }
+   }
+   std::vector<COMPLEX> airyValues(residueArgs.size());
+   Airy(residueArgs.data(), airyValues.data(), static_cast<int>(residueArgs.size()));
+   double airyRelError = 0.0;
+   for (size_t i = 0; i < residueArgs.size(); ++i)
+   {
+      if (std::abs(residueExact[i]) > 1.0E-3F)
+      {
+         airyRelError = std::max(airyRelError, static_cast<double>(std::abs(airyValues[i] - residueExact[i]) /
+                                                                   std::abs(residueExact[i])));
+      }
+   }
+
+   // The Fresnel integrals.
+   FresnelTable fresnel(aFresnel);
+   double       fresnelAbsError = 0.0;
+   for (double x = -cFRESNEL_MAX_X + 0.001; x < cFRESNEL_MAX_X; x += 0.000913)
+   {
+      double cosint;
+      double sinint;
+      double exactCosint;
+      double exactSinint;
+      fresnel.Evaluate(cosint, sinint, x);
+      aFresnel(exactCosint, exactSinint, x);
+      fresnelAbsError = std::max(fresnelAbsError, std::max(fabs(cosint - exactCosint), fabs(sinint - exactSinint)));
+   }
+
+   // The time per evaluation of the scalar and batched routines over the same arguments.
+   const int   cREPEAT   = 3;
+   auto        argCount  = static_cast<double>(residueArgs.size() * cREPEAT);
+   float       checksum  = 0.0F;
+   UtWallClock clock;
+   for (int n = 0; n < cREPEAT; ++n)
+   {
+      for (const COMPLEX& arg : residueArgs)
+      {
+         checksum += aAiry(arg).real();
+      }
+   }
+   double scalarAiryTime = clock.GetClock() / argCount;
+
+   clock.ResetClock();
+   for (int n = 0; n < cREPEAT; ++n)
+   {
+      Airy(residueArgs.data(), airyValues.data(), static_cast<int>(residueArgs.size()));
+      checksum += airyValues[0].real();
+   }
+   double batchAiryTime = clock.GetClock() / argCount;
+
+   clock.ResetClock();
+   int tableCount = 0;
+   for (int n = 0; n < cREPEAT; ++n)
+   {
+      for (double y = cRESIDUE_STEP; y < cRESIDUE_MAX_Y; y += 0.00377)
+      {
+         residues.Evaluate(y, terms.data());
+         checksum += terms[1].real();
+         tableCount += aTermCount;
+      }
+   }
+   double tableTime = clock.GetClock() / tableCount;
+
+   bool ok = (residueAbsError < 2.0E-5) && (residueRelError < 5.2E-4) && (fresnelAbsError < 2.0E-7) && (airyRelError < 2.0E-6);
+   logger.AddNote() << "Residue table absolute error: " << residueAbsError;
+   logger.AddNote() << "Residue table relative error: " << residueRelError;
+   logger.AddNote() << "Fresnel table absolute error: " << fresnelAbsError;
+   logger.AddNote() << "Airy relative error: " << airyRelError;
+   logger.AddNote() << "Scalar airy: " << 1.0E9 * scalarAiryTime << " ns/term";
+   logger.AddNote() << "Batched Airy: " << 1.0E9 * batchAiryTime << " ns/term";
+   logger.AddNote() << "Residue table: " << 1.0E9 * tableTime << " ns/term";
+   logger.AddNote() << "Checksum: " << checksum;
+   logger.AddNote() << "Result: " << (ok ? "passed" : "FAILED");
+   return ok;
+}
+} // namespace WsfEM_ALARM_SpecialFunctions
@@ -0,0 +1,86 @@
+// ****************************************************************************
+// CUI//REL TO USA ONLY
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFEM_ALARM_SPECIALFUNCTIONS_HPP
+#define WSFEM_ALARM_SPECIALFUNCTIONS_HPP
+
+#include <complex>
+#include <vector>
+
+//! Tabulated and batched approximations of the special functions used by ALARM diffraction.
+//!
+//! The tables are built once from the scalar ALARM routines (see WsfEM_ALARM_Propagation). They and the
+//! batched Airy function are only used by a propagation model for which 'special_function_tables' is enabled.
+//!
+//! Accuracy, measured against the scalar routines (verified by RunSelfTest):
+//! - ResidueTable: absolute error < 2.0E-5, relative error < 5.2E-4 for terms larger than 1.0E-3 over the
+//!   tabulated range. The error is dominated by the discontinuities where 'airy' switches between conect,
+//!   gaussq and powers.
+//! - FresnelTable: absolute error < 2.0E-7 over the tabulated range.
+//! - Airy: relative error < 2.0E-6 for values larger than 1.0E-3. The power series is evaluated with the same operations as 'powers'.
+//!   The asymptotic series performs its complex divisions without the scaling done by std::complex.
+namespace WsfEM_ALARM_SpecialFunctions
+{
+using COMPLEX = std::complex<float>;
+
+using AiryFunction    = COMPLEX (*)(const COMPLEX&);
+using FresnelFunction = void (*)(double&, double&, double);
+
+//! The terms of the residue series for spherical-earth diffraction (see WsfEM_ALARM_Propagation::sediff):
+//!
+//!    T(j, y) = airy(airzro(j) + exp(i*pi/3) * y) / (exp(i*pi/3) * airdot(j))
+//!
+//! for j = 1..N and 1/32 <= y < 32. Values are interpolated with a 4-point (cubic) Lagrange polynomial.
+//! The terms for a given 'y' are stored contiguously so all N terms are evaluated with one set of weights.
+class ResidueTable
+{
+public:
+   ResidueTable(AiryFunction aAiry, const double* aZeros, const double* aDerivatives, int aTermCount);
+
+   bool Evaluate(double aY, COMPLEX* aTerms) const;
+
+private:
+   int                  mTermCount;
+   int                  mPointCount;
+   std::vector<COMPLEX> mValues; //!< [point * (mTermCount + 1) + term], term 0 is not used
+};
+
+//! The Fresnel cosine and sine integrals for |x| < 8 (see WsfEM_ALARM_Propagation::fresnl).
+//! Values are interpolated with a cubic Hermite polynomial using the exact derivatives cos(pi*x*x/2) and sin(pi*x*x/2).
+class FresnelTable
+{
+public:
+   explicit FresnelTable(FresnelFunction aFresnel);
+
+   bool Evaluate(double& cosint, double& sinint, double xargmt) const;
+
+private:
+   int                 mPointCount;
+   std::vector<double> mCosine;
+   std::vector<double> mSine;
+   std::vector<double> mCosineSlope; //!< The derivatives, scaled by the table step
+   std::vector<double> mSineSlope;
+};
+
+//! Evaluate the Airy function (see WsfEM_ALARM_Propagation::airy) for an array of arguments.
+//! The arguments are processed in blocks, with the series for all arguments in a block evaluated together.
+//! @param aArgs   The arguments.
+//! @param aValues [output] The values.
+//! @param aCount  The number of arguments.
+void Airy(const COMPLEX* aArgs, COMPLEX* aValues, int aCount);
+
+//! Compare the tables and Airy against the scalar routines and time them (the 'special_function_self_test' command).
+//! The errors and timings are written to the log.
+//! @returns true if the errors are within the bounds documented above.
+bool RunSelfTest(AiryFunction aAiry, FresnelFunction aFresnel, const double* aZeros, const double* aDerivatives, int aTermCount);
+} // namespace WsfEM_ALARM_SpecialFunctions
+
+#endif
@@ -31,24 +31,135 @@
 const int WsfEM_ALARM_Terrain::min_points_var(100);
 // Assume Level 1 DTED (see 'get_ground_range_incr' in terrain_cell.f90)
 const double        WsfEM_ALARM_Terrain::deltag(pi* rezero / (180.0 * 1200.0));
-bool                WsfEM_ALARM_Terrain::terrain_sw(false);                // TODO
 bool                WsfEM_ALARM_Terrain::use_AFSIM_terrain_masking(false); // TODO
-bool                WsfEM_ALARM_Terrain::initialized = false;
-int                 WsfEM_ALARM_Terrain::aprofile    = 0;
-double              WsfEM_ALARM_Terrain::last_rkfact = 0.0;
-double              WsfEM_ALARM_Terrain::rearth      = 0.0;
-std::vector<double> WsfEM_ALARM_Terrain::cbetap;
-std::vector<double> WsfEM_ALARM_Terrain::cosbet;
-std::vector<double> WsfEM_ALARM_Terrain::sbetap;
-std::vector<double> WsfEM_ALARM_Terrain::sinbet;
+std::atomic<unsigned int> WsfEM_ALARM_Terrain::profile_cache_generation(0);
 
 // =================================================================================================
-// static
-void WsfEM_ALARM_Terrain::Initialize(wsf::Terrain& aTerrain)
+//! Allocate the profile arrays so they can hold at least 'nprofl' points.
+//! Memory is allocated in hunks to minimize allocate/deallocate thrashing if nprofl is gradually
+//! creeping up.
+void WsfEM_ALARM_Terrain::Profile::Allocate(int nprofl)
+{
+   const int hunk = 512;
+
+   if ((nprofl > aprofile) || xprofl.empty())
+   {
+      aprofile = aprofile + (std::abs(nprofl / hunk) + 1) * hunk;
+
+      dratio.resize(aprofile + 1);
+      elvmsl.resize(aprofile + 1);
+      iend.resize(aprofile + 1);
+      istart.resize(aprofile + 1);
+      rngter.resize(aprofile + 1);
+      tanepp.resize(aprofile + 1);
+      visibl.resize(aprofile + 1);
+      xprofl.resize(aprofile + 1);
+      zprofl.resize(aprofile + 1);
+      lcprofl.resize(aprofile + 1);
+   }
+}
+
+// =================================================================================================
+void WsfEM_ALARM_Terrain::Profile::Clear()
+{
+   aprofile = 0;
+   dratio.clear();
+   elvmsl.clear();
+   iend.clear();
+   istart.clear();
+   rngter.clear();
+   tanepp.clear();
+   visibl.clear();
+   xprofl.clear();
+   zprofl.clear();
+   lcprofl.clear();
+}
+
+// =================================================================================================
+//! Return the cached profile for the specified key if it has at least 'nprofl' points.
+//! The hit and miss counts are updated and a returned entry becomes the most recently used.
+const WsfEM_ALARM_Terrain::ProfileCache::Entry* WsfEM_ALARM_Terrain::ProfileCache::Find(const Key& aKey, int nprofl)
+{
+   auto indexIter = mIndex.find(aKey);
+   if ((indexIter == mIndex.end()) || (indexIter->second->second.nprofl < nprofl))
+   {
+      ++mMissCount;
+      return nullptr;
+   }
+   ++mHitCount;
+   mEntries.splice(mEntries.begin(), mEntries, indexIter->second);
+   return &(indexIter->second->second);
+}
+
+// =================================================================================================
+//! Return the entry for the specified key, creating it if necessary.
+//! The entry becomes the most recently used. If a new entry would cause the cache to exceed
+//! 'aMaxSize' entries then the least recently used entries are discarded.
+WsfEM_ALARM_Terrain::ProfileCache::Entry& WsfEM_ALARM_Terrain::ProfileCache::Insert(const Key& aKey, unsigned int aMaxSize)
+{
+   auto indexIter = mIndex.find(aKey);
+   if (indexIter != mIndex.end())
+   {
+      mEntries.splice(mEntries.begin(), mEntries, indexIter->second);
+      return mEntries.front().second;
+   }
+
+   while ((! mEntries.empty()) && (mEntries.size() >= aMaxSize))
+   {
+      mIndex.erase(mEntries.back().first);
+      mEntries.pop_back();
+   }
+   mEntries.emplace_front(aKey, Entry());
+   mIndex[aKey] = mEntries.begin();
+   return mEntries.front().second;
+}
+
+// =================================================================================================
+void WsfEM_ALARM_Terrain::ProfileCache::Clear()
+{
+   mEntries.clear();
+   mIndex.clear();
+   mHitCount  = 0;
+   mMissCount = 0;
+}
+
+// =================================================================================================
+void WsfEM_ALARM_Terrain::Context::Initialize(wsf::Terrain& aTerrain)
 {
    terrain_sw = aTerrain.IsEnabled();
 }
 
+// =================================================================================================
+void WsfEM_ALARM_Terrain::Context::Reset()
+{
+   terrain_sw  = false;
+   initialized = false;
+   aprofile    = 0;
+   last_rkfact = 0.0;
+   rearth      = 0.0;
+   cbetap.clear();
+   cosbet.clear();
+   sbetap.clear();
+   sinbet.clear();
+   lcprofl.clear();
+   mPropagationProfile.Clear();
+   mClutterProfile.Clear();
+   indxmx_size = 0;
+   indxmx.clear();
+   mProfileCache.Clear();
+}
+
+// =================================================================================================
+//! Return the terrain context for the calling thread.
+//! Each thread gets its own context, so ALARM propagation and clutter calculations performed on
+//! different threads do not share any working storage.
+// static
+WsfEM_ALARM_Terrain::Context& WsfEM_ALARM_Terrain::GetThreadContext()
+{
+   static thread_local Context sContext;
+   return sContext;
+}
+
 // =================================================================================================
 // static
 void WsfEM_ALARM_Terrain::SetUseAFSIM_TerrainMasking(bool aUse)
@@ -57,19 +168,15 @@ void WsfEM_ALARM_Terrain::SetUseAFSIM_TerrainMasking(bool aUse)
 }
 
 // =================================================================================================
+//! Reset all global/static data to default values.
+//! @note Only the context of the calling thread is reset. The terrain profile caches of the other
+//! threads are invalidated and will be cleared the next time they are used.
 // static
 void WsfEM_ALARM_Terrain::ResetState()
 {
-   terrain_sw                = false;
    use_AFSIM_terrain_masking = false;
-   initialized               = false;
-   aprofile                  = 0;
-   last_rkfact               = 0.0;
-   rearth                    = 0.0;
-   cbetap.clear();
-   cosbet.clear();
-   sbetap.clear();
-   sinbet.clear();
+   ++profile_cache_generation;
+   GetThreadContext().Reset();
 }
 
 // =================================================================================================
@@ -94,7 +201,7 @@ void WsfEM_ALARM_Terrain::AdjustAltitude(WsfPlatform* aPlatformPtr,
                                          double       aLon, // degrees
                                          double&      aAlt)      // meters
 {
-   if (terrain_sw)
+   if (aPlatformPtr->GetTerrain().IsEnabled())
    {
       aAlt -= aPlatformPtr->GetTerrainHeight();
       aAlt += get_cell_height_deg(aPlatformPtr->GetTerrain(), aLat, aLon);
@@ -169,7 +276,7 @@ double WsfEM_ALARM_Terrain::get_terrain_height(wsf::Terrain& aTerrain, double la
    //--------------------------------------------------------------------
 
    double terrain_height = 0.0;
-   if (terrain_sw)
+   if (aTerrain.IsEnabled())
    {
       if (units == "RAD")
       {
@@ -281,7 +388,9 @@ double WsfEM_ALARM_Terrain::get_terrain_height(wsf::Terrain& aTerrain, double la
 //!! public
 
 // static
-void WsfEM_ALARM_Terrain::profil(wsf::Terrain&        aTerrain,
+void WsfEM_ALARM_Terrain::profil(Context&                   aContext,
+                                 const ProfileCacheOptions& aCacheOptions,
+                                 wsf::Terrain&        aTerrain,
                                  WsfEnvironment&      aEnvironment,
                                  double               aztrad,
                                  double               eltrad,
@@ -343,11 +452,13 @@ void WsfEM_ALARM_Terrain::profil(wsf::Terrain&        aTerrain,
    //--------------------------------------------------------------------
 
    // BA
-   std::vector<int> lcprofl;
+   std::vector<int>& lcprofl = aContext.lcprofl;
    lcprofl.resize(xprofl.size());
    // BA
 
-   /*call*/ visble2(aTerrain,
+   /*call*/ visble2(aContext,
+                    aCacheOptions,
+                    aTerrain,
                     aEnvironment,
                     aztrad,
                     eltrad,
@@ -433,7 +544,9 @@ void WsfEM_ALARM_Terrain::profil(wsf::Terrain&        aTerrain,
 //!! public
 
 // static
-void WsfEM_ALARM_Terrain::visclt(wsf::Terrain&        aTerrain,
+void WsfEM_ALARM_Terrain::visclt(Context&                   aContext,
+                                 const ProfileCacheOptions& aCacheOptions,
+                                 wsf::Terrain&        aTerrain,
                                  WsfEnvironment&      aEnvironment,
                                  double               alphac,
                                  double               hammsl,
@@ -496,7 +609,9 @@ void WsfEM_ALARM_Terrain::visclt(wsf::Terrain&        aTerrain,
    // Get the terrain profile data.
    //--------------------------------------------------------------------
 
-   /*call*/ visble2(aTerrain,
+   /*call*/ visble2(aContext,
+                    aCacheOptions,
+                    aTerrain,
                     aEnvironment,
                     alphac,
                     dummy2,
@@ -543,7 +658,7 @@ void WsfEM_ALARM_Terrain::visclt(wsf::Terrain&        aTerrain,
          {
             iend[nareas] = i - 1;
          }
-         if (!terrain_sw)
+         if (!aContext.terrain_sw)
          {
             return;
          } // early exit
@@ -647,7 +762,9 @@ void WsfEM_ALARM_Terrain::visclt(wsf::Terrain&        aTerrain,
 //----------------------------------------------------------------------
 
 // static
-void WsfEM_ALARM_Terrain::visble2(wsf::Terrain&        aTerrain,
+void WsfEM_ALARM_Terrain::visble2(Context&                   aContext,
+                                  const ProfileCacheOptions& aCacheOptions,
+                                  wsf::Terrain&        aTerrain,
                                   WsfEnvironment&      aEnvironment,
                                   double               azin,
                                   double               eltrad,
@@ -704,7 +821,7 @@ void WsfEM_ALARM_Terrain::visble2(wsf::Terrain&        aTerrain,
 
    const int hunk = 512;
 
-   // NOTE-C++ The following have been moved to class static variables
+   // NOTE-C++ The following have been moved to the terrain context
    // static bool                initialized = false;
    // static int                 aprofile = 0;
    // static double              last_rkfact = 0.0;
@@ -714,10 +831,71 @@ void WsfEM_ALARM_Terrain::visble2(wsf::Terrain&        aTerrain,
    // static std::vector<double> sbetap;
    // static std::vector<double> sinbet;
 
+   bool&                initialized = aContext.initialized;
+   int&                 aprofile    = aContext.aprofile;
+   double&              last_rkfact = aContext.last_rkfact;
+   double&              rearth      = aContext.rearth;
+   std::vector<double>& cbetap      = aContext.cbetap;
+   std::vector<double>& cosbet      = aContext.cosbet;
+   std::vector<double>& sbetap      = aContext.sbetap;
+   std::vector<double>& sinbet      = aContext.sinbet;
+
    double betap, betapp, coazin, cophis, grangp, siazin, siphis, stphii, terlam = 0.0, terphi = 0.0, terang, el_delta;
 
    int i;
 
+   //-------------------------------------------------------------------
+   // NOTE-C++ Use the cached profile if one exists. The cache is bypassed if
+   // the full profile is not being computed or if the AFSIM masking check
+   // (which needs the location of the last point) is being used.
+   //-------------------------------------------------------------------
+
+   bool                 useCache = (aCacheOptions.mSize > 0) && (!quick_flag) && (!variable_flag) && (!use_AFSIM_terrain_masking);
+   ProfileCache&        cache    = aContext.mProfileCache;
+   ProfileCache::Key    cacheKey;
+   if (useCache)
+   {
+      unsigned int generation = profile_cache_generation;
+      if (aContext.mProfileCacheGeneration != generation)
+      {
+         cache.Clear();
+         aContext.mProfileCacheGeneration = generation;
+      }
+
+      if (aCacheOptions.mAzimuthResolution > 0.0)
+      {
+         azin = aCacheOptions.mAzimuthResolution * std::floor((azin / aCacheOptions.mAzimuthResolution) + 0.5);
+      }
+      cacheKey = ProfileCache::Key(sitphi, sitlam, hammsl, azin, rkfact, aContext.terrain_sw);
+
+      const ProfileCache::Entry* entryPtr = cache.Find(cacheKey, nprofl);
+      if (entryPtr != nullptr)
+      {
+         xprofl[0] = entryPtr->xprofl[0];
+         zprofl[0] = entryPtr->zprofl[0];
+         tanmax    = -1.0E+32;
+         for (i = 1; i <= nprofl; ++i)
+         {
+            elvmsl[i]  = entryPtr->elvmsl[i];
+            lcprofl[i] = entryPtr->lcprofl[i];
+            xprofl[i]  = entryPtr->xprofl[i];
+            zprofl[i]  = entryPtr->zprofl[i];
+            tanepp[i]  = entryPtr->tanepp[i];
+            visibl[i]  = entryPtr->visibl[i];
+            if (tanepp[i] > tanmax)
+            {
+               tanmax = tanepp[i];
+            }
+         }
+         terang = atan(tanmax);
+         if (terang > eltrad)
+         {
+            masked = true;
+         }
+         return;
+      }
+   }
+
    //-------------------------------------------------------------------
 
    if ((!initialized) || (rkfact != last_rkfact) || (nprofl > aprofile))
@@ -946,6 +1124,18 @@ void WsfEM_ALARM_Terrain::visble2(wsf::Terrain&        aTerrain,
 
    } // end do
 
+   if (useCache)
+   {
+      ProfileCache::Entry& entry = cache.Insert(cacheKey, aCacheOptions.mSize);
+      entry.nprofl = nprofl;
+      entry.elvmsl.assign(elvmsl.begin(), elvmsl.begin() + nprofl + 1);
+      entry.tanepp.assign(tanepp.begin(), tanepp.begin() + nprofl + 1);
+      entry.visibl.assign(visibl.begin(), visibl.begin() + nprofl + 1);
+      entry.xprofl.assign(xprofl.begin(), xprofl.begin() + nprofl + 1);
+      entry.zprofl.assign(zprofl.begin(), zprofl.begin() + nprofl + 1);
+      entry.lcprofl.assign(lcprofl.begin(), lcprofl.begin() + nprofl + 1);
+   }
+
    // Note: AFSIM sometimes shows a terrain blockage when ALARM shows it to be clear.
    // The reason for this discrepancy is under investigation.
    if (use_AFSIM_terrain_masking)
@@ -19,7 +19,11 @@
 #ifndef WSFEM_ALARM_TERRAIN_HPP
 #define WSFEM_ALARM_TERRAIN_HPP
 
+#include <atomic>
+#include <list>
+#include <map>
 #include <string>
+#include <tuple>
 #include <vector>
 
 class WsfPlatform;
@@ -31,11 +35,139 @@ class Terrain;
 }
 
 //! Terrain handling code from ALARM (terrrain.f90 and friends).
-// TODO Remove statics.
+//!
+//! The data that ALARM kept in SAVE'd module variables (the terrain switch, the earth-curvature
+//! tables and the profile work arrays) is held in a Context rather than in class statics. Every
+//! thread that evaluates ALARM propagation or clutter uses its own Context (see GetThreadContext),
+//! so the profiling routines are reentrant.
+//!
+//! Terrain profiles extracted by visble2 are retained in a least-recently-used cache in the Context.
+//! For a radar whose site does not move the profile along a given azimuth is the same from call to
+//! call, so the terrain and land cover sampling can be skipped. The cache controls belong to each
+//! model (see ProfileCacheOptions) and are passed to the profiling routines.
 class WsfEM_ALARM_Terrain
 {
 public:
-   static void Initialize(wsf::Terrain& aTerrain);
+   //! Work arrays for a single terrain profile.
+   //! Arrays that start at index 1 in ALARM still have element 0 allocated (but ignored) so as to
+   //! allow the code to continue 1-based indexing.
+   class Profile
+   {
+   public:
+      void Allocate(int nprofl);
+      void Clear();
+
+      int                 aprofile = 0;
+      std::vector<double> dratio;  // 0:aprofile
+      std::vector<double> elvmsl;  // 1:aprofile
+      std::vector<int>    iend;    // 1:aprofile
+      std::vector<int>    istart;  // 1:aprofile
+      std::vector<double> rngter;  // 0:aprofile
+      std::vector<double> tanepp;  // 1:aprofile
+      std::vector<bool>   visibl;  // 1:aprofile
+      std::vector<double> xprofl;  // 0:aprofile
+      std::vector<double> zprofl;  // 0:aprofile
+      std::vector<int>    lcprofl; // 1:aprofile (site-specific land cover)
+   };
+
+   //! A least-recently-used cache of the terrain profiles computed by visble2.
+   //!
+   //! A profile is identified by the site location, the site height, the azimuth and the refractivity
+   //! factor. The points in a profile do not depend on the length of the profile, so an entry can satisfy
+   //! a request for any number of points up to the number it holds.
+   class ProfileCache
+   {
+   public:
+      //! (sitphi, sitlam, hammsl, azin, rkfact, terrain_sw)
+      using Key = std::tuple<double, double, double, double, double, bool>;
+
+      struct Entry
+      {
+         int                 nprofl = 0;
+         std::vector<double> elvmsl; // 1:nprofl
+         std::vector<double> tanepp; // 1:nprofl
+         std::vector<bool>   visibl; // 1:nprofl
+         std::vector<double> xprofl; // 0:nprofl
+         std::vector<double> zprofl; // 0:nprofl
+         std::vector<int>    lcprofl; // 1:nprofl
+      };
+
+      const Entry* Find(const Key& aKey, int nprofl);
+
+      Entry& Insert(const Key& aKey, unsigned int aMaxSize);
+
+      void Clear();
+
+      //! @name Cache statistics.
+      //@{
+      unsigned long GetHitCount() const  { return mHitCount; }
+      unsigned long GetMissCount() const { return mMissCount; }
+      size_t        GetSize() const      { return mEntries.size(); }
+      //@}
+
+   private:
+      using EntryList = std::list<std::pair<Key, Entry>>;
+
+      EntryList                           mEntries; //!< Most recently used first
+      std::map<Key, EntryList::iterator>  mIndex;
+      unsigned long                       mHitCount  = 0;
+      unsigned long                       mMissCount = 0;
+   };
+
+   //! The terrain profile cache controls of a propagation or clutter model.
+   struct ProfileCacheOptions
+   {
+      //! Maximum number of profiles retained by the thread's cache (0 disables the cache for the model).
+      unsigned int mSize = 128;
+      //! If non-zero, profiles are computed along azimuths that are a multiple of this value (radians)
+      //! so nearby azimuths share a profile. If zero, only identical azimuths share a profile and the
+      //! cache has no effect on the results.
+      double mAzimuthResolution = 0.0;
+   };
+
+   //! The working state of the terrain routines for one thread of evaluation.
+   class Context
+   {
+   public:
+      void Initialize(wsf::Terrain& aTerrain);
+
+      void Reset();
+
+      bool get_terrain_sw() const { return terrain_sw; }
+
+      const ProfileCache& GetProfileCache() const { return mProfileCache; }
+
+      Profile mPropagationProfile; //!< Work arrays for WsfEM_ALARM_Propagation::laprop
+      Profile mClutterProfile;     //!< Work arrays for WsfEM_ALARM_Clutter::clutter_signal_comp
+
+      //! Work array for WsfEM_ALARM_Propagation::kediff
+      int              indxmx_size = 0;
+      std::vector<int> indxmx;
+
+   private:
+      friend class WsfEM_ALARM_Terrain;
+
+      bool terrain_sw = false;
+
+      //! @name Saved variables from VISBLE2.
+      //@{
+      bool                initialized = false;
+      int                 aprofile    = 0;
+      double              last_rkfact = 0.0;
+      double              rearth      = 0.0;
+      std::vector<double> cbetap;
+      std::vector<double> cosbet;
+      std::vector<double> sbetap;
+      std::vector<double> sinbet;
+      //@}
+
+      std::vector<int> lcprofl; //!< Land cover scratch for profil (which does not return it)
+
+      ProfileCache mProfileCache;
+      unsigned int mProfileCacheGeneration = 0; //!< See WsfEM_ALARM_Terrain::ResetState
+   };
+
+   static Context& GetThreadContext();
 
    static void ResetState();
 
@@ -47,11 +179,11 @@ public:
    //@{
    static int get_nprofile(double ground_range);
 
-   static bool get_terrain_sw() { return terrain_sw; }
-
    static double get_terrain_height(wsf::Terrain& aTerrain, double lat, double lon, const std::string& units);
 
-   static void profil(wsf::Terrain&        aTerrain,
+   static void profil(Context&                   aContext,
+                      const ProfileCacheOptions& aCacheOptions,
+                      wsf::Terrain&        aTerrain,
                       WsfEnvironment&      aEnvironment,
                       double               aztrad,
                       double               eltrad,
@@ -71,7 +203,9 @@ public:
                       std::vector<double>& xprofl,
                       std::vector<double>& zprofl);
 
-   static void visclt(wsf::Terrain&        aTerrain,
+   static void visclt(Context&                   aContext,
+                      const ProfileCacheOptions& aCacheOptions,
+                      wsf::Terrain&        aTerrain,
                       WsfEnvironment&      aEnvironment,
                       double               alphac,
                       double               hammsl,
@@ -90,7 +224,9 @@ public:
                       std::vector<double>& zprofl,
                       std::vector<int>&    lcprofl); // added for site-specific land cover
 
-   static void visble2(wsf::Terrain&        aTerrain,
+   static void visble2(Context&                   aContext,
+                       const ProfileCacheOptions& aCacheOptions,
+                       wsf::Terrain&        aTerrain,
                        WsfEnvironment&      aEnvironment,
                        double               azin,
                        double               eltrad,
@@ -123,17 +259,8 @@ public:
 private:
    static const int    min_points_var;
    static const double deltag;
-   static bool         terrain_sw;
    static bool         use_AFSIM_terrain_masking;
 
-   // Moved there to deal with statics
-   static bool                initialized;
-   static int                 aprofile;
-   static double              last_rkfact;
-   static double              rearth;
-   static std::vector<double> cbetap;
-   static std::vector<double> cosbet;
-   static std::vector<double> sbetap;
-   static std::vector<double> sinbet;
+   static std::atomic<unsigned int> profile_cache_generation; //!< Incremented to invalidate every thread's cache
 };
 #endif
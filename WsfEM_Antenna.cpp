@@ -442,6 +442,34 @@ void WsfEM_Antenna::UpdatePosition(double aSimTime)
    mArticulatedPartPtr->UpdatePosition(aSimTime);
 }
 
+// =================================================================================================
+//! Ensure the lazily computed location and coordinate transforms of the antenna are current.
+//! This should be called after UpdatePosition when the antenna is about to be used by multiple threads
+//! (e.g.: parallel detection attempts), so that the subsequent queries only read the cached values.
+void WsfEM_Antenna::UpdateCachedState()
+{
+   if (!mLocationWCS_IsValid)
+   {
+      UpdateLocationWCS();
+   }
+   if (!mLocationLLA_IsValid)
+   {
+      UpdateLocationLLA();
+   }
+   if (!mWCS_ToACS_TransformIsValid)
+   {
+      UpdateWCS_ToACS_Transform();
+   }
+   if (!mWCS_ToNED_TransformIsValid)
+   {
+      UpdateWCS_ToNED_Transform();
+   }
+   if ((mScanStabilization != cSS_NONE) && (!mWCS_ToSSCS_TransformIsValid))
+   {
+      UpdateWCS_ToSSCS_Transform();
+   }
+}
+
 // =================================================================================================
 //! Set the height of the antenna with respect to the host articulated part.
 //! @param aHeight Offset of the antenna with respect to the articulated part to which it is attached.
@@ -91,6 +91,8 @@ public:
 
    virtual void UpdatePosition(double aSimTime);
 
+   void UpdateCachedState();
+
    const char* GetScriptClassName() const override { return "WsfEM_Antenna"; }
 
    //! @name Antenna parameter definition methods.
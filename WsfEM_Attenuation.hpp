@@ -77,6 +77,11 @@ class WSF_EXPORT WsfEM_Attenuation : public WsfObject
       //! @note See the code in WsfEM_Attenuation as to why this is present.
       virtual bool IsNullModel() const                     { return false; }
 
+      //! May ComputeAttenuationFactor be called concurrently for different interactions?
+      //! Models that keep per-call state in member variables must return false (the default).
+      //! Sensors that evaluate detection attempts on multiple threads require this.
+      virtual bool IsReentrant() const                     { return false; }
+
       //! Does the accept inline block input?
       //!
       //! This is called by WsfEM_Attenuation::LoadReference when attempting to load a
@@ -0,0 +1,90 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfEM_BistaticLinkCache.hpp"
+
+namespace
+{
+bool SameLocation(const double aLoc1[3], const double aLoc2[3])
+{
+   return (aLoc1[0] == aLoc2[0]) && (aLoc1[1] == aLoc2[1]) && (aLoc1[2] == aLoc2[2]);
+}
+} // namespace
+
+// =================================================================================================
+WsfEM_BistaticLinkCache& WsfEM_BistaticLinkCache::operator=(const WsfEM_BistaticLinkCache& aRhs)
+{
+   if (this != &aRhs)
+   {
+      Clear();
+   }
+   return *this;
+}
+
+// =================================================================================================
+//! Find the link for a transmitter.
+//! @param aXmtrId     The transmitter.
+//! @param aXmtrLocWCS The current location of the transmitter antenna.
+//! @param aRcvrLocWCS The current location of the receiver antenna.
+//! @param aCategoryId The zone attenuation category of the interaction.
+//! @param aLink       [output] The link (valid only if the return value is true).
+//! @returns true if the link was found and neither antenna has moved since it was computed.
+bool WsfEM_BistaticLinkCache::Find(const XmtrId& aXmtrId,
+                                   const double  aXmtrLocWCS[3],
+                                   const double  aRcvrLocWCS[3],
+                                   WsfStringId   aCategoryId,
+                                   Link&         aLink)
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   auto                        iter = mLinks.find(aXmtrId);
+   if ((iter == mLinks.end()) || (iter->second.mCategoryId != aCategoryId) ||
+       (!SameLocation(iter->second.mXmtrLocWCS, aXmtrLocWCS)) ||
+       (!SameLocation(iter->second.mRcvrLocWCS, aRcvrLocWCS)))
+   {
+      return false;
+   }
+   aLink = iter->second;
+   return true;
+}
+
+// =================================================================================================
+//! Save the link for a transmitter, replacing any previous link.
+void WsfEM_BistaticLinkCache::Insert(const XmtrId& aXmtrId, const Link& aLink)
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   mLinks[aXmtrId] = aLink;
+}
+
+// =================================================================================================
+//! Discard the links of the transmitters on a platform that is being deleted.
+void WsfEM_BistaticLinkCache::RemovePlatform(size_t aPlatformIndex)
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   for (auto iter = mLinks.begin(); iter != mLinks.end();)
+   {
+      if (iter->first.first == aPlatformIndex)
+      {
+         iter = mLinks.erase(iter);
+      }
+      else
+      {
+         ++iter;
+      }
+   }
+}
+
+// =================================================================================================
+//! Discard all links.
+void WsfEM_BistaticLinkCache::Clear()
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   mLinks.clear();
+}
@@ -0,0 +1,81 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFEM_BISTATICLINKCACHE_HPP
+#define WSFEM_BISTATICLINKCACHE_HPP
+
+#include "wsf_export.h"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "WsfEM_Interaction.hpp"
+#include "WsfStringId.hpp"
+
+//! The results of the transmitter-to-receiver pre-pass of bistatic two-way interactions.
+//!
+//! WsfEM_Interaction::BeginTwoWayInteraction must validate the transmitter-to-receiver link of a
+//! bistatic interaction before it can consider the target. That link does not depend on the target,
+//! so each receiver keeps the result for each transmitter and it is shared by every target until
+//! either antenna moves.
+//!
+//! A transmitter is identified by its platform index (which is never reused within a simulation)
+//! and the name of its articulated part, so a link cannot be matched by a transmitter that reuses
+//! the memory of a deleted one. The links of a deleted platform are removed by RemovePlatform.
+//!
+//! All methods may be called from multiple threads.
+class WSF_EXPORT WsfEM_BistaticLinkCache
+{
+public:
+   //! The target-independent state produced by the pre-pass.
+   struct Link
+   {
+      double       mXmtrLocWCS[3];
+      double       mRcvrLocWCS[3];
+      WsfStringId  mCategoryId;
+      unsigned int mCheckedStatus;
+      unsigned int mFailedStatus;
+      double       mZoneAttenuationValue;
+
+      WsfEM_Interaction::LocationData mXmtrLoc;
+      WsfEM_Interaction::LocationData mRcvrLoc;
+      WsfEM_Interaction::RelativeData mXmtrToRcvr;
+      WsfEM_Interaction::RelativeData mRcvrToXmtr;
+   };
+
+   //! Identifies a transmitter: the platform index and the name of the articulated part.
+   using XmtrId = std::pair<size_t, WsfStringId>;
+
+   WsfEM_BistaticLinkCache() = default;
+   //! Links are not copied (a copied receiver has its own links).
+   WsfEM_BistaticLinkCache(const WsfEM_BistaticLinkCache& /*aSrc*/) {}
+   WsfEM_BistaticLinkCache& operator=(const WsfEM_BistaticLinkCache& aRhs);
+
+   bool Find(const XmtrId& aXmtrId,
+             const double  aXmtrLocWCS[3],
+             const double  aRcvrLocWCS[3],
+             WsfStringId   aCategoryId,
+             Link&         aLink);
+
+   void Insert(const XmtrId& aXmtrId, const Link& aLink);
+
+   void RemovePlatform(size_t aPlatformIndex);
+
+   void Clear();
+
+private:
+   std::map<XmtrId, Link> mLinks;
+   std::mutex             mMutex;
+};
+
+#endif
@@ -85,6 +85,11 @@ class WSF_EXPORT WsfEM_Clutter : public WsfObject
       //! @note See the code in WsfEM_ClutterTypes as to why this is present.
       virtual bool IsNullModel() const                     { return false; }
 
+      //! May ComputeClutterPower be called concurrently for different interactions?
+      //! Models that keep per-call state in member variables must return false (the default).
+      //! Sensors that evaluate detection attempts on multiple threads require this.
+      virtual bool IsReentrant() const                     { return false; }
+
    protected:
       WsfEM_Clutter(const WsfEM_Clutter& aSrc);
       WsfEM_Clutter& operator=(const WsfEM_Clutter& aRhs);
@@ -63,6 +63,8 @@ class WSF_EXPORT WsfEM_FastMultipath : public WsfEM_Propagation
       double ComputePropagationFactor(WsfEM_Interaction& aInteraction,
                                               WsfEnvironment&    aEnvironment) override;
 
+      bool IsReentrant() const override { return true; }
+
       virtual double ComputeReflectionGain(WsfEM_XmtrRcvr*                        aXmtrRcvrPtr,
                                            const WsfEM_Interaction::BeamData&     aBeamData,
                                            const WsfEM_Interaction::RelativeData& aRelTgtLoc,
@@ -94,7 +94,12 @@ WsfEM_GroundWavePropagation::WsfEM_GroundWavePropagation()
     mReflectionCounter(1),
     mReflectionNF(0),
     mXmtrAlt(1.0),                              // 发射机高度（米）
-    mRcvrAlt(1.0)                               // 接收机高度（米）
+    mRcvrAlt(1.0),                              // 接收机高度（米）
+    mGroundDistance(0.0),                       // 地面距离（米）
+    mLossTableHeightInterval(0.0),              // 损耗表高度间隔（米，0 表示不使用）
+    mLossTableDistanceInterval(0.0),            // 损耗表距离间隔（米，0 表示不使用）
+    mModeSets(),
+    mReplaceModeSetIndex(0)
 {
     // 初始化所有模态相关的复数变量（共支持9个模式）
    for (size_t i = 0; i < 9; ++i)
@@ -133,7 +138,12 @@ WsfEM_GroundWavePropagation::WsfEM_GroundWavePropagation(const WsfEM_GroundWaveP
      mReflectionCounter(aSrc.mReflectionCounter),
      mReflectionNF(aSrc.mReflectionNF),
      mXmtrAlt(aSrc.mXmtrAlt),
-     mRcvrAlt(aSrc.mRcvrAlt)
+     mRcvrAlt(aSrc.mRcvrAlt),
+     mGroundDistance(aSrc.mGroundDistance),
+     mLossTableHeightInterval(aSrc.mLossTableHeightInterval),
+     mLossTableDistanceInterval(aSrc.mLossTableDistanceInterval),
+     mModeSets(),
+     mReplaceModeSetIndex(0)
 {
    for (size_t i = 0; i < 9; ++i)
    {
@@ -222,6 +232,16 @@ bool WsfEM_GroundWavePropagation::ProcessInput(UtInput& aInput)
       aInput.ValueGreater(mDistanceInterval, 0.0);
       mDistanceInterval *= 0.001;
    }
+   else if (command == "loss_table_height_interval")
+   {
+      aInput.ReadValueOfType(mLossTableHeightInterval, UtInput::cLENGTH);
+      aInput.ValueGreaterOrEqual(mLossTableHeightInterval, 0.0);
+   }
+   else if (command == "loss_table_distance_interval")
+   {
+      aInput.ReadValueOfType(mLossTableDistanceInterval, UtInput::cLENGTH);
+      aInput.ValueGreaterOrEqual(mLossTableDistanceInterval, 0.0);
+   }
    else
    {
       myCommand = WsfEM_Propagation::ProcessInput(aInput);
@@ -235,11 +255,10 @@ bool WsfEM_GroundWavePropagation::ProcessInput(UtInput& aInput)
 //! •	核心方法，用于计算地波传播因子。
 //•	主要步骤：
 //1.	获取发射机和接收机的频率。
-//2.	设置指数大气模型参数（调用 SetupExponentialAtmosphere）。
-//3.	计算波数和地球的折射率平方。
-//4.	根据极化类型调整表面阻抗。
-//5.	分别计算从发射机到目标和从目标到接收机的传播因子。
-//6.	返回总传播因子（出站传播因子 × 入站传播因子）。
+//2.	获取（或计算并缓存）该频率和极化的模态（调用 GetModeSet）。
+//3.	计算地面距离。
+//4.	分别计算从发射机到目标和从目标到接收机的传播因子。
+//5.	返回总传播因子（出站传播因子 × 入站传播因子）。
 double WsfEM_GroundWavePropagation::ComputePropagationFactor(WsfEM_Interaction& aInteraction,
                                                              WsfEnvironment&    aEnvironment)
 {
@@ -252,74 +271,238 @@ double WsfEM_GroundWavePropagation::ComputePropagationFactor(WsfEM_Interaction&
       frequency = aInteraction.GetReceiver()->GetFrequency();
    }
 
-   // 设置指数大气模型相关参数
-   double scale = 0.0;
-   double d1p0 = 0.0;
-   SetupExponentialAtmosphere(scale, d1p0);
+   // 获取模态（传播常数和激励因子），仅在频率或极化首次出现时计算
+   bool verticalPol = (aInteraction.GetTransmitter()->GetPolarization() != WsfEM_Types::cPOL_HORIZONTAL);
+   ModeSet& modes = GetModeSet(frequency, verticalPol);
+
+   mGroundDistance = ComputeGroundDistance(aInteraction);
+
+   // ---------- 出射路径计算（发射机 -> 目标） ----------
+   // compute one-way propagation factor from radar transmitter
+   // to target
+   double propagationFactorOutbound = ComputeOneWayFactor(aInteraction,
+                                                          modes,
+                                                          aInteraction.mXmtrLoc.mAlt,
+                                                          aInteraction.mTgtLoc.mAlt);
+
+   // ---------- 入射路径计算（目标 -> 接收机） ----------
+   double propagationFactorInbound = ComputeOneWayFactor(aInteraction,
+                                                         modes,
+                                                         aInteraction.mTgtLoc.mAlt,
+                                                         aInteraction.mRcvrLoc.mAlt);
+
+   // 计算总传播因子 = 出射因子 × 入射因子
+   double propagationFactor = propagationFactorOutbound * propagationFactorInbound;
 
+   return propagationFactor;
+}
+
+// =================================================================================================
+//! Return the modes for a frequency and polarization, computing them if they are not cached.
+//! This also sets the wavenumber and refractivity state used by the remainder of the computation.
+//!protected
+WsfEM_GroundWavePropagation::ModeSet& WsfEM_GroundWavePropagation::GetModeSet(double aFrequency,
+                                                                               bool   aVerticalPol)
+{
    // 计算波数 k（单位 MHz -> km）
-   mWavenumber = 0.02094395 * frequency * 1.0e-6;  // GRWAVE uses freq in MHz
+   mWavenumber = 0.02094395 * aFrequency * 1.0e-6;  // GRWAVE uses freq in MHz
    mWavenumberSquared = mWavenumber * mWavenumber;
    complex<double> dummyComplex(0.0, mWavenumber);
    mWavenumberImaginary = dummyComplex;
 
+   for (auto& modes : mModeSets)
+   {
+      if ((modes.mFrequency == aFrequency) && (modes.mVerticalPol == aVerticalPol))
+      {
+         mDel = modes.mDel;
+         return modes;
+      }
+   }
+
+   // Not in the cache. Add a new entry, or replace the oldest one if the cache is full.
+   static const size_t cMAX_MODE_SETS = 8;
+   size_t index = mModeSets.size();
+   if (index < cMAX_MODE_SETS)
+   {
+      mModeSets.emplace_back();
+   }
+   else
+   {
+      index = mReplaceModeSetIndex;
+      mReplaceModeSetIndex = (mReplaceModeSetIndex + 1) % cMAX_MODE_SETS;
+   }
+   ModeSet& modes = mModeSets[index];
+   modes.mFrequency = aFrequency;
+   modes.mVerticalPol = aVerticalPol;
+   modes.mLossTable.clear();
+
+   // 设置指数大气模型相关参数
+   SetupExponentialAtmosphere(modes.mScale, modes.mD1P0);
+
    // 计算地球介质复折射率平方（包括相对介电常数和导电率）
-   complex<double> nSquared(mRelativePermittivity, -1.8e4 * mConductivity / (frequency * 1.e-6));
+   complex<double> nSquared(mRelativePermittivity, -1.8e4 * mConductivity / (aFrequency * 1.e-6));
 
    // 表面阻抗（归一化到自由空间）
-   complex<double> surfaceImpedance = std::sqrt(nSquared - 1.0);
+   modes.mImpedance = std::sqrt(nSquared - 1.0);
 
    // 若为垂直极化，需调整阻抗和折射率
-   if (aInteraction.GetTransmitter()->GetPolarization() != WsfEM_Types::cPOL_HORIZONTAL)
+   if (aVerticalPol)
    {
-      surfaceImpedance /= nSquared;
-      ModifyValuesForVerticalPol(scale,
-                                 d1p0,
-                                 surfaceImpedance,
-                                 d1p0,
-                                 surfaceImpedance);
+      modes.mImpedance /= nSquared;
+      ModifyValuesForVerticalPol(modes.mScale,
+                                 modes.mD1P0,
+                                 modes.mImpedance,
+                                 modes.mD1P0,
+                                 modes.mImpedance);
    }
-   // ---------- 出射路径计算（发射机 -> 目标） ----------
-   double propagationFactorOutbound = 1.0;
-   // compute one-way propagation factor from radar transmitter
-   // to target
-   mXmtrAlt = aInteraction.mXmtrLoc.mAlt;
-   mRcvrAlt = aInteraction.mTgtLoc.mAlt;
+   modes.mDel = mDel;
+
+   // compute propagation constant P0 and excitation factors
+   // fid(m) m=0,8
+   complex<double> fid[9];   // 模态激励因子
+   for (unsigned int i = 0; i < 9; ++i)
+   {
+      Eigen(this,
+            i,
+            modes.mImpedance,
+            modes.mScale,
+            modes.mD1P0,
+            fid);
+      modes.mSm1[i] = mWavenumberImaginary * (mDel - mP0[i]) /
+                      (std::sqrt(1.0 + mDel - mP0[i]) + 1.0);
+      modes.mExc[i] = std::log(-2.0 * fid[i] * (1.0 + modes.mSm1[i] / mWavenumberImaginary));
+   }
+   for (unsigned int i = 0; i < 9; ++i)
+   {
+      modes.mP0[i] = mP0[i];
+      modes.mTurningPoint[i] = mTurningPoint[i];
+      modes.mHeightChange[i] = mHeightChange[i];
+   }
+   return modes;
+}
+
+// =================================================================================================
+//! Restore the mode state computed by GetModeSet (the geometrical optics solution overwrites it).
+//!protected
+void WsfEM_GroundWavePropagation::RestoreModes(const ModeSet& aModes)
+{
+   mDel = aModes.mDel;
+   for (unsigned int i = 0; i < 9; ++i)
+   {
+      mP0[i] = aModes.mP0[i];
+      mTurningPoint[i] = aModes.mTurningPoint[i];
+      mHeightChange[i] = aModes.mHeightChange[i];
+   }
+}
+
+// =================================================================================================
+//! Compute the one-way propagation factor between two heights separated by mGroundDistance.
+//! If the loss table is enabled the factor is interpolated from the table nodes that
+//! bracket the heights and the distance, and the nodes are computed the first time they are used.
+//!protected
+double WsfEM_GroundWavePropagation::ComputeOneWayFactor(WsfEM_Interaction& aInteraction,
+                                                        ModeSet&           aModes,
+                                                        double             aHeight1,
+                                                        double             aHeight2)
+{
+   // Heights and distances within the first interval are computed directly, as the solution is
+   // singular at zero (and the height-gain integration is poorly conditioned just above the ground).
+   if ((mLossTableHeightInterval <= 0.0) ||
+       (mLossTableDistanceInterval <= 0.0) ||
+       (min(aHeight1, aHeight2) < mLossTableHeightInterval) ||
+       (mGroundDistance < mLossTableDistanceInterval))
+   {
+      mXmtrAlt = aHeight1;
+      mRcvrAlt = aHeight2;
+      return EvaluateOneWayFactor(aInteraction, aModes);
+   }
+
+   double groundDistance = mGroundDistance;
+   double x = aHeight1 / mLossTableHeightInterval;
+   double y = aHeight2 / mLossTableHeightInterval;
+   double z = groundDistance / mLossTableDistanceInterval;
+   double ix = floor(x);
+   double iy = floor(y);
+   double iz = floor(z);
+   double fx = x - ix;
+   double fy = y - iy;
+   double fz = z - iz;
+
+   // The key is formed from the two height indices and the distance index (21 bits each).
+   // Nodes that cannot be represented are not tabulated, so the factor is computed directly.
+   static const double cMAX_NODE_INDEX = static_cast<double>((1 << 21) - 2);
+   if ((ix > cMAX_NODE_INDEX) || (iy > cMAX_NODE_INDEX) || (iz > cMAX_NODE_INDEX))
+   {
+      mXmtrAlt = aHeight1;
+      mRcvrAlt = aHeight2;
+      return EvaluateOneWayFactor(aInteraction, aModes);
+   }
+
+   // The table is discarded if it grows too large (e.g. many widely separated targets).
+   static const size_t cMAX_LOSS_TABLE_SIZE = 65536;
+   if (aModes.mLossTable.size() > (cMAX_LOSS_TABLE_SIZE - 8))
+   {
+      aModes.mLossTable.clear();
+   }
+
+   double cornerDB[8];
+   for (unsigned int corner = 0; corner < 8; ++corner)
+   {
+      auto i = static_cast<std::uint64_t>(ix) + (corner & 1);
+      auto j = static_cast<std::uint64_t>(iy) + ((corner >> 1) & 1);
+      auto k = static_cast<std::uint64_t>(iz) + ((corner >> 2) & 1);
+
+      std::uint64_t key = (i << 42) | (j << 21) | k;
+      auto iter = aModes.mLossTable.find(key);
+      if (iter == aModes.mLossTable.end())
+      {
+         mXmtrAlt = static_cast<double>(i) * mLossTableHeightInterval;
+         mRcvrAlt = static_cast<double>(j) * mLossTableHeightInterval;
+         mGroundDistance = static_cast<double>(k) * mLossTableDistanceInterval;
+         double factor = EvaluateOneWayFactor(aInteraction, aModes);
+         iter = aModes.mLossTable.emplace(key, UtMath::SafeLinearToDB(factor)).first;
+      }
+      cornerDB[corner] = iter->second;
+   }
+   mGroundDistance = groundDistance;
+
+   // The factor decays exponentially with distance, so it is interpolated in dB along distance.
+   // The height-gain functions are smooth in field strength, so the heights are interpolated in field strength.
+   double field[4];
+   for (unsigned int corner = 0; corner < 4; ++corner)
+   {
+      double lossDB = cornerDB[corner] + fz * (cornerDB[corner + 4] - cornerDB[corner]);
+      field[corner] = UtMath::DB_ToLinear(0.5 * lossDB);
+   }
+   double field0 = field[0] + fx * (field[1] - field[0]);
+   double field1 = field[2] + fx * (field[3] - field[2]);
+   double fieldValue = field0 + fy * (field1 - field0);
+   return fieldValue * fieldValue;
+}
+
+// =================================================================================================
+//! Compute the one-way propagation factor between mXmtrAlt and mRcvrAlt separated by mGroundDistance.
+//!protected
+double WsfEM_GroundWavePropagation::EvaluateOneWayFactor(WsfEM_Interaction& aInteraction,
+                                                         const ModeSet&     aModes)
+{
+   RestoreModes(aModes);
 
    // 优先尝试远场传播模型
+   double propagationFactor = 1.0;
    bool farFieldValid = FarFieldTransmissionLoss(aInteraction,
-                                                 scale,
-                                                 d1p0,
-                                                 surfaceImpedance,
-                                                 propagationFactorOutbound);
+                                                 aModes,
+                                                 propagationFactor);
    // 若远场传播不适用，则退回到几何光学模型
    if (! farFieldValid)
+   {
+      complex<double> impedance = aModes.mImpedance;
       GeometricalOptics(aInteraction,
-                        scale,
-                        d1p0,
-                        surfaceImpedance,
-                        propagationFactorOutbound);
-
-   // ---------- 入射路径计算（目标 -> 接收机） ----------
-   double propagationFactorInbound = 1.0;
-   mXmtrAlt = aInteraction.mTgtLoc.mAlt;
-   mRcvrAlt = aInteraction.mRcvrLoc.mAlt;
-
-   // 同样优先使用远场传播
-   farFieldValid = FarFieldTransmissionLoss(aInteraction,
-                                            scale,
-                                            d1p0,
-                                            surfaceImpedance,
-                                            propagationFactorInbound);
-   if (! farFieldValid)
-      GeometricalOptics(aInteraction,
-                        scale,
-                        d1p0,
-                        surfaceImpedance,
-                        propagationFactorInbound);
-   // 计算总传播因子 = 出射因子 × 入射因子
-   double propagationFactor = propagationFactorOutbound * propagationFactorInbound;
-
+                        aModes.mScale,
+                        aModes.mD1P0,
+                        impedance,
+                        propagationFactor);
+   }
    return propagationFactor;
 }
 
@@ -383,37 +566,14 @@ void WsfEM_GroundWavePropagation::ModifyValuesForVerticalPol(double
 //! •	使用远场传播模型计算传播因子。
 //！•	涉及复杂的数学计算，包括复数运算、对数和指数函数。
 bool WsfEM_GroundWavePropagation::FarFieldTransmissionLoss(WsfEM_Interaction&    aInteraction,
-                                                           double                aScale,
-                                                           double                aD1P0,
-                                                           std::complex<double>& aImpedance,
+                                                           const ModeSet&        aModes,
                                                            double&               aPropagationFactor)
 {
-   // compute propagation constant P0 and excitation factors
-   // fid(m) m=0,8
-   // 模态相关变量定义
-   complex<double> fid[9];   // 模态激励因子
-   complex<double> p0Sub[9];    // 初始传播常数备份
-   complex<double> sm1[9];  // 修正波数项
-   complex<double> exc[9];  // 模态激励项对数
-   // 计算模态激励项和传播常数
-   for (unsigned int i = 0; i < 9; ++i)
-   {
-      Eigen(this,
-            i,
-            aImpedance,
-            aScale,
-            aD1P0,
-            fid);
-      p0Sub[i] = mP0[i];
-      sm1[i] = mWavenumberImaginary * (mDel - mP0[i]) /
-               (std::sqrt(1.0 + mDel - mP0[i]) + 1.0);
-      exc[i] = std::log(-2.0 * fid[i] * (1.0 + sm1[i] / mWavenumberImaginary));
-   }
-   // 恢复传播常数状态
-   for (unsigned int i = 0; i < 9; ++i)
-   {
-      mP0[i] = p0Sub[i];
-   }
+   // 模态激励项和传播常数已由 GetModeSet 计算（见 RestoreModes）
+   double                 scale = aModes.mScale;
+   complex<double>        impedance = aModes.mImpedance;
+   const complex<double>* sm1 = aModes.mSm1;  // 修正波数项
+   const complex<double>* exc = aModes.mExc;  // 模态激励项对数
 
    // 自由空间参考场强（150mV/m @1km）
    double a = 0.5 * log(8.877e10 * mWavenumber * mWavenumberSquared);
@@ -430,55 +590,51 @@ bool WsfEM_GroundWavePropagation::FarFieldTransmissionLoss(WsfEM_Interaction&
       // the boundary condition at the surface (H=0) for the reciprocal
       // of the reflection coefficient, height-gain function and
       // the wave impedance are:
-      complex<double> reflectionCoefficient = 1.0 - 2.0 * aImpedance /
-                                              (aImpedance + std::sqrt(mP0[i]));
+      complex<double> reflectionCoefficient = 1.0 - 2.0 * impedance /
+                                              (impedance + std::sqrt(mP0[i]));
 
       double hSub = 0.0;
       if (mRcvrAlt <= mXmtrAlt)
       {
          Height(i,
-                aScale,
+                scale,
                 reflectionCoefficient,
                 heightGainRcvr[i],
                 hSub,
                 mRcvrAlt);
+         // continue the integration from the lower height
          hSub = mRcvrAlt;
+         heightGainXmtr[i] = heightGainRcvr[i];
          if (hSub != mXmtrAlt)
          {
             Height(i,
-                   aScale,
+                   scale,
                    reflectionCoefficient,
                    heightGainXmtr[i],
                    hSub,
                    mXmtrAlt);
          }
-         else
-         {
-            heightGainXmtr[i] = heightGainRcvr[i];
-         }
       }
       else
       {
          Height(i,
-                aScale,
+                scale,
                 reflectionCoefficient,
                 heightGainXmtr[i],
                 hSub,
                 mXmtrAlt);
+         // continue the integration from the lower height
          hSub = mXmtrAlt;
+         heightGainRcvr[i] = heightGainXmtr[i];
          if (hSub != mRcvrAlt)
          {
             Height(i,
-                   aScale,
+                   scale,
                    reflectionCoefficient,
                    heightGainRcvr[i],
                    hSub,
                    mRcvrAlt);
          }
-         else
-         {
-            heightGainRcvr[i] = heightGainXmtr[i];
-         }
       }
    }
 
@@ -488,7 +644,7 @@ bool WsfEM_GroundWavePropagation::FarFieldTransmissionLoss(WsfEM_Interaction&
 
    int na = 100;
 
-   double range = ComputeGroundDistance(aInteraction) * 0.001;
+   double range = mGroundDistance * 0.001;
 
    complex<double> term[9];
    complex<double> series[9];
@@ -593,7 +749,7 @@ void WsfEM_GroundWavePropagation::GeometricalOptics(WsfEM_Interaction&    aInter
    // set loss to default value
    aPropagationFactor = 1.0;
    // 传播距离（km）
-   double range = ComputeGroundDistance(aInteraction) * 0.001;
+   double range = mGroundDistance * 0.001;
 
    double hn = 120.0 * pow(mWavenumber, -2.0 / 3.0);
    complex<double> factor = 2.0e-3 * (1.0 + 0.5 * mDel) / mWavenumberImaginary;
@@ -634,7 +790,7 @@ void WsfEM_GroundWavePropagation::GeometricalOptics(WsfEM_Interaction&    aInter
       // compute the first range d
       int n = 0;
       double d = mMinDistance;
-      if (d == ComputeGroundDistance(aInteraction) * 0.001)
+      if (d == mGroundDistance * 0.001)
       { return; }
 
       int ifin = 0;
@@ -2043,7 +2199,7 @@ double WsfEM_GroundWavePropagation::FlatEarthPropagation(WsfEM_Interaction&    a
    double distance = mMinDistance;
    int n = 0;
    bool convergence = false;
-   double range = ComputeGroundDistance(aInteraction) * 0.001;
+   double range = mGroundDistance * 0.001;
    double tlc = UtMath::DB_ToLinear(BasicTransmissionLoss(aInteraction));
    double propagationFactor = 1.0;
    while ((! convergence) && (distance <= range))
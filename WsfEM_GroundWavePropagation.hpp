@@ -40,6 +40,9 @@
 #include "wsf_export.h"
 
 #include <complex>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 #include "WsfEM_Antenna.hpp"
 #include "WsfEM_Interaction.hpp"
@@ -66,6 +69,40 @@ class WSF_EXPORT WsfEM_GroundWavePropagation : public WsfEM_Propagation
                                       WsfEnvironment&    aEnvironment) override;
 
    protected:
+      //! The propagation constants and excitation factors of the residue series modes.
+      //! These depend only on the frequency, the polarization and the ground and atmosphere
+      //! constants, so they are computed once and reused for every interaction.
+      struct ModeSet
+      {
+         double               mFrequency;
+         bool                 mVerticalPol;
+         double               mScale;
+         double               mD1P0;
+         double               mDel;
+         std::complex<double> mImpedance;
+         std::complex<double> mP0[9];
+         std::complex<double> mTurningPoint[9];
+         double               mHeightChange[9];
+         std::complex<double> mSm1[9];
+         std::complex<double> mExc[9];
+         //! One-way propagation factor (dB) at the loss table nodes, keyed by the packed node indices.
+         //! The number of nodes is bounded (see ComputeOneWayFactor).
+         std::unordered_map<std::uint64_t, double> mLossTable;
+      };
+
+      ModeSet& GetModeSet(double aFrequency,
+                          bool   aVerticalPol);
+
+      void RestoreModes(const ModeSet& aModes);
+
+      double ComputeOneWayFactor(WsfEM_Interaction& aInteraction,
+                                 ModeSet&           aModes,
+                                 double             aHeight1,
+                                 double             aHeight2);
+
+      double EvaluateOneWayFactor(WsfEM_Interaction& aInteraction,
+                                  const ModeSet&     aModes);
+
       void SetupExponentialAtmosphere(double& aScale,
                                       double& aD1P0);
 
@@ -76,9 +113,7 @@ class WSF_EXPORT WsfEM_GroundWavePropagation : public WsfEM_Propagation
                                       std::complex<double>& aImpedanceV);
 
       bool FarFieldTransmissionLoss(WsfEM_Interaction&    aInteraction,
-                                    double                aScale,
-                                    double                aD1P0,
-                                    std::complex<double>& aImpedance,
+                                    const ModeSet&        aModes,
                                     double&               aPropagationFactor);
 
       void GeometricalOptics(WsfEM_Interaction&    aInteraction,
@@ -310,6 +345,16 @@ class WSF_EXPORT WsfEM_GroundWavePropagation : public WsfEM_Propagation
       double                       mXmtrAlt;
       //! altitude of "receiver"
       double                       mRcvrAlt;
+      //! ground distance between the "transmitter" and "receiver" (meters)
+      double                       mGroundDistance;
+      //! height interval of the one-way loss table (meters; 0 if the table is not used)
+      double                       mLossTableHeightInterval;
+      //! distance interval of the one-way loss table (meters; 0 if the table is not used)
+      double                       mLossTableDistanceInterval;
+      //! modes for the most recently used frequencies and polarizations
+      std::vector<ModeSet>         mModeSets;
+      //! index of the entry in mModeSets to be replaced when the cache is full
+      size_t                       mReplaceModeSetIndex;
 };
 
 #endif
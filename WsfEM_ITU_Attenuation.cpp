@@ -59,6 +59,16 @@ struct Factory
       return instancePtr;
    }
 };
+
+//! The maximum number of frequency/polarization tables retained by an instance.
+const size_t cMAX_TABLES = 8;
+
+//! The number of elevations in the cumulative attenuation surface. The elevations are spaced
+//! quadratically from 0 to cMAX_ELEVATION so the rapid change near the horizon is resolved.
+const size_t cSURFACE_ELEVATION_COUNT = 512;
+
+//! The maximum elevation considered by the model.
+const double cMAX_ELEVATION = 89.9 * UtMath::cRAD_PER_DEG;
 } // namespace
 
 std::function<WsfEM_Attenuation*(const std::string&)> WsfEM_ITU_Attenuation::GetObjectFactory(WsfScenario& aScenario)
@@ -72,8 +82,10 @@ std::function<WsfEM_Attenuation*(const std::string&)> WsfEM_ITU_Attenuation::Get
 WsfEM_ITU_Attenuation::WsfEM_ITU_Attenuation(const UtAtmosphere& aAtm)
    : WsfEM_Attenuation()
    , mAtmosphere(aAtm)
-   , mFrequency(-1.0)
-   , mGammaTable()
+   , mTables()
+   , mLastTableIndex(0)
+   , mReplaceTableIndex(0)
+   , mUseSurface(false)
 {
 }
 
@@ -81,8 +93,10 @@ WsfEM_ITU_Attenuation::WsfEM_ITU_Attenuation(const UtAtmosphere& aAtm)
 WsfEM_ITU_Attenuation::WsfEM_ITU_Attenuation(const WsfEM_ITU_Attenuation& aSrc)
    : WsfEM_Attenuation(aSrc)
    , mAtmosphere(aSrc.mAtmosphere)
-   , mFrequency(-1.0)
-   , mGammaTable()
+   , mTables()
+   , mLastTableIndex(0)
+   , mReplaceTableIndex(0)
+   , mUseSurface(aSrc.mUseSurface)
 {
 }
 
@@ -188,6 +202,10 @@ bool WsfEM_ITU_Attenuation::ProcessInput(UtInput& aInput)
       out.AddNote() << "Attenuation: " << UtMath::SafeLinearToDB(atten) << " dB (" << atten << " abs)";
       out.AddNote() << "Specific Attenuation: " << -UtMath::SafeLinearToDB(atten) / (range * 0.001) << " dB/km";
    }
+   else if (command == "cumulative_attenuation_surface")
+   {
+      aInput.ReadValue(mUseSurface);
+   }
    else if (mAtmosphere.ProcessInput(aInput))
    {
    }
@@ -231,39 +249,58 @@ double WsfEM_ITU_Attenuation::ComputeAttenuationFactor(double
 
    double frequency = UtMath::Limit(aFrequency, 1.0E+9, 1000.0E+9);
 
-   // Regenerate the table of specific attenuation vs. altitude if there is a significant change
-   // in the frequency for which the current table was generated.
-
-   if (fabs(frequency - mFrequency) > (0.01 * aFrequency))
-   {
-      GenerateTable(frequency, aPolarization, aEnvironment);
-   }
+   const GammaTable&         table      = GetTable(frequency, aPolarization, aEnvironment);
+   const std::vector<Point>& gammaTable = table.mGammaTable;
 
    // Return a factor of 1 for the trivial cases where the range is small or the starting
    // altitude is above the atmosphere.
 
-   if ((aRange < 1.0) || (aAltitude >= mGammaTable.back().mAltitude))
+   if ((aRange < 1.0) || (aAltitude >= gammaTable.back().mAltitude))
    {
       return 1.0;
    }
 
-   double elevation = std::min(std::max(aElevation, 0.0), 89.9 * UtMath::cRAD_PER_DEG);
+   double elevation = std::min(std::max(aElevation, 0.0), cMAX_ELEVATION);
    double altitude  = std::max(aAltitude, 0.0);
 
-   // Find the lower index of the entry such that ALT(i) <= altitude < ALT(i+1).
-   // We have already ensured that the altitude is strictly less that the last
-   // altitude in the table.
-
-   size_t gtIndex = 0;
-   while (altitude > mGammaTable[gtIndex].mAltitude)
+   double atten_dB = 0.0;
+   if (!table.mSurface.empty())
    {
-      ++gtIndex;
+      atten_dB = SurfaceAttenuation(table, aRange, elevation, altitude);
    }
-   if (altitude != mGammaTable[gtIndex].mAltitude)
+   else
    {
-      --gtIndex;
+      atten_dB = IntegrateAttenuation(gammaTable, aRange, elevation, altitude);
    }
 
+   // Convert to a linear attenuation factor and return. Note that the result may be zero!
+   double atten = pow(10.0, -0.1 * atten_dB);
+   return atten;
+}
+
+// =================================================================================================
+//! Integrate the attenuation along a path through the layers of the specific attenuation table.
+//! @param aGammaTable The specific attenuation table.
+//! @param aRange      The slant range of the path (m).
+//! @param aElevation  The elevation of the path at the starting point [0, cMAX_ELEVATION] (rad).
+//! @param aAltitude   The starting altitude; must be less than the last altitude in the table (m).
+//! @returns The attenuation along the path (dB).
+// private static
+double WsfEM_ITU_Attenuation::IntegrateAttenuation(const std::vector<Point>& aGammaTable,
+                                                   double                    aRange,
+                                                   double                    aElevation,
+                                                   double                    aAltitude)
+{
+   double elevation = aElevation;
+   double altitude  = aAltitude;
+
+   // Find the lower index of the entry such that ALT(i) <= altitude < ALT(i+1).
+   // We have already ensured that the altitude is strictly less that the last
+   // altitude in the table.
+
+   size_t maxIndex = aGammaTable.size() - 1;
+   size_t gtIndex  = FindLayer(aGammaTable, altitude);
+
    // side A : The side from the center of the earth to the source point.
    // side B : The side from the center of the earth to the target point.
    // side C : The side from the source point to the target point (the range).
@@ -287,11 +324,11 @@ double WsfEM_ITU_Attenuation::ComputeAttenuationFactor(double
    double sinAngleB = sin(angleB);
 
    // Adjust the starting gamma based on the fact that we may be starting mid-layer.
-   double lowerAltitude = mGammaTable[gtIndex].mAltitude;
-   double upperAltitude = mGammaTable[gtIndex + 1].mAltitude;
+   double lowerAltitude = aGammaTable[gtIndex].mAltitude;
+   double upperAltitude = aGammaTable[gtIndex + 1].mAltitude;
    double f             = (altitude - lowerAltitude) / (upperAltitude - lowerAltitude);
-   double lowerGamma    = mGammaTable[gtIndex].mGamma;
-   double upperGamma    = mGammaTable[gtIndex + 1].mGamma;
+   double lowerGamma    = aGammaTable[gtIndex].mGamma;
+   double upperGamma    = aGammaTable[gtIndex + 1].mGamma;
    lowerGamma           = lowerGamma + f * (upperGamma - lowerGamma);
 
    // Iterate through the layers, accumulating the loss in each layer.
@@ -299,11 +336,10 @@ double WsfEM_ITU_Attenuation::ComputeAttenuationFactor(double
    double atten_dB  = 0.0;
    double range     = 0.0;
    double lastRange = 0.0;
-   size_t maxIndex  = mGammaTable.size() - 1;
    while ((range < aRange) && (gtIndex < maxIndex))
    {
       // Use the law of sines to get the angle A.
-      double sideB     = re + mGammaTable[gtIndex + 1].mAltitude;
+      double sideB     = re + aGammaTable[gtIndex + 1].mAltitude;
       double sinAngleA = sideA / sideB * sinAngleB;
       double angleA    = asin(sinAngleA);
 
@@ -315,7 +351,7 @@ double WsfEM_ITU_Attenuation::ComputeAttenuationFactor(double
       range        = sideC;
 
       // If this is the final layer, adjust the range and final gamma to reflect partial penetration.
-      upperGamma = mGammaTable[gtIndex + 1].mGamma;
+      upperGamma = aGammaTable[gtIndex + 1].mGamma;
       if (range > aRange)
       {
          f          = (aRange - lastRange) / (range - lastRange);
@@ -331,15 +367,209 @@ double WsfEM_ITU_Attenuation::ComputeAttenuationFactor(double
       ++gtIndex;
    }
 
-   // Convert to a linear attenuation factor and return. Note that the result may be zero!
-   double atten = pow(10.0, -0.1 * atten_dB);
-   return atten;
+   return atten_dB;
+}
+
+// =================================================================================================
+//! Return the table for a given frequency and polarization, computing it if it is not cached.
+//! A table is reused if its frequency is within 1% of the requested frequency.
+// private
+const WsfEM_ITU_Attenuation::GammaTable& WsfEM_ITU_Attenuation::GetTable(double                    aFrequency,
+                                                                         WsfEM_Types::Polarization aPolarization,
+                                                                         WsfEnvironment&           aEnvironment)
+{
+   double tolerance = 0.01 * aFrequency;
+   if ((mLastTableIndex < mTables.size()) && (mTables[mLastTableIndex].mPolarization == aPolarization) &&
+       (fabs(aFrequency - mTables[mLastTableIndex].mFrequency) <= tolerance))
+   {
+      return mTables[mLastTableIndex];
+   }
+   for (size_t i = 0; i < mTables.size(); ++i)
+   {
+      if ((mTables[i].mPolarization == aPolarization) && (fabs(aFrequency - mTables[i].mFrequency) <= tolerance))
+      {
+         mLastTableIndex = i;
+         return mTables[i];
+      }
+   }
+
+   // Not in the cache. Add a new table, or replace the oldest one if the cache is full.
+   size_t index = mTables.size();
+   if (index < cMAX_TABLES)
+   {
+      mTables.emplace_back();
+   }
+   else
+   {
+      index              = mReplaceTableIndex;
+      mReplaceTableIndex = (mReplaceTableIndex + 1) % cMAX_TABLES;
+   }
+   GammaTable& table = mTables[index];
+   GenerateTable(table, aFrequency, aPolarization, aEnvironment);
+   table.mSurface.clear();
+   if (mUseSurface)
+   {
+      GenerateSurface(table);
+   }
+   mLastTableIndex = index;
+   return table;
+}
+
+// =================================================================================================
+//! Find the lower index of the entry such that ALT(i) <= altitude < ALT(i+1).
+//! The altitude must be strictly less than the last altitude in the table.
+// private static
+size_t WsfEM_ITU_Attenuation::FindLayer(const std::vector<Point>& aGammaTable, double aAltitude)
+{
+   // The table is uniformly spaced, so start with a direct estimate.
+   size_t maxIndex = aGammaTable.size() - 1;
+   double spacing  = aGammaTable[1].mAltitude - aGammaTable[0].mAltitude;
+   size_t gtIndex  = std::min(static_cast<size_t>(std::max(aAltitude, 0.0) / spacing), maxIndex - 1);
+   while ((gtIndex > 0) && (aAltitude < aGammaTable[gtIndex].mAltitude))
+   {
+      --gtIndex;
+   }
+   while ((gtIndex < maxIndex - 1) && (aAltitude >= aGammaTable[gtIndex + 1].mAltitude))
+   {
+      ++gtIndex;
+   }
+   return gtIndex;
+}
+
+// =================================================================================================
+//! Compute the cumulative attenuation surface for a table.
+//! Each entry is the attenuation along a path that starts at a table altitude with a given elevation
+//! and continues to the top of the table. The attenuation across the whole layers of any path is
+//! the difference of the surface values at the first and last layer boundaries it crosses.
+//!
+//! The quantity (R * cos(elevation)) is constant along a straight path, where R is the distance
+//! from the center of the earth, so the range from the point where the path is tangent to the
+//! Earth to the layer boundary at radius R is sqrt(R^2 - (R * cos(elevation))^2).
+// private static
+void WsfEM_ITU_Attenuation::GenerateSurface(GammaTable& aTable)
+{
+   const std::vector<Point>& gammaTable = aTable.mGammaTable;
+   size_t                    maxIndex   = gammaTable.size() - 1;
+   double                    re         = UtSphericalEarth::cEARTH_RADIUS;
+
+   aTable.mSurface.assign(gammaTable.size() * cSURFACE_ELEVATION_COUNT, 0.0);
+   for (size_t i = 0; i < maxIndex; ++i)
+   {
+      double  ri     = re + gammaTable[i].mAltitude;
+      double* rowPtr = &aTable.mSurface[i * cSURFACE_ELEVATION_COUNT];
+      for (size_t j = 0; j < cSURFACE_ELEVATION_COUNT; ++j)
+      {
+         double u         = static_cast<double>(j) / static_cast<double>(cSURFACE_ELEVATION_COUNT - 1);
+         double elevation = u * u * cMAX_ELEVATION;
+         double p         = ri * cos(elevation);
+         double lastRange = ri * sin(elevation);
+         double atten_dB  = 0.0;
+         for (size_t k = i + 1; k <= maxIndex; ++k)
+         {
+            double rk    = re + gammaTable[k].mAltitude;
+            double range = sqrt(rk * rk - p * p);
+            atten_dB += ((0.5 * (gammaTable[k - 1].mGamma + gammaTable[k].mGamma)) * ((range - lastRange) * 0.001));
+            lastRange = range;
+         }
+         rowPtr[j] = atten_dB;
+      }
+   }
+}
+
+// =================================================================================================
+//! Interpolate the cumulative attenuation surface.
+//! @param aTable  The table containing the surface.
+//! @param aIndex  The index of the layer boundary.
+//! @param aP      The path invariant (R * cos(elevation)) (m).
+//! @returns The attenuation (dB) from the layer boundary to the top of the table.
+// private static
+double WsfEM_ITU_Attenuation::SurfaceLookup(const GammaTable& aTable, size_t aIndex, double aP)
+{
+   double r         = UtSphericalEarth::cEARTH_RADIUS + aTable.mGammaTable[aIndex].mAltitude;
+   double elevation = atan2(sqrt(std::max(r * r - aP * aP, 0.0)), aP);
+   double y         = sqrt(std::min(elevation / cMAX_ELEVATION, 1.0)) * (cSURFACE_ELEVATION_COUNT - 1);
+   size_t j         = std::min(static_cast<size_t>(y), cSURFACE_ELEVATION_COUNT - 2);
+   double f         = y - static_cast<double>(j);
+
+   const double* rowPtr = &aTable.mSurface[aIndex * cSURFACE_ELEVATION_COUNT];
+   return rowPtr[j] + f * (rowPtr[j + 1] - rowPtr[j]);
+}
+
+// =================================================================================================
+//! Compute the attenuation along a path using the cumulative attenuation surface.
+//! The layers are integrated as in IntegrateAttenuation, but the partial first and last layers are
+//! evaluated directly and the whole layers in between come from the surface, so the cost does not
+//! depend on the number of layers crossed. The ranges to the layer boundaries are computed from the
+//! path invariant rather than the law of sines, so the result may differ slightly from
+//! IntegrateAttenuation for long paths through the upper layers.
+//! The arguments are the same as IntegrateAttenuation.
+// private static
+double WsfEM_ITU_Attenuation::SurfaceAttenuation(const GammaTable& aTable,
+                                                 double            aRange,
+                                                 double            aElevation,
+                                                 double            aAltitude)
+{
+   const std::vector<Point>& gammaTable = aTable.mGammaTable;
+   size_t                    maxIndex   = gammaTable.size() - 1;
+   size_t                    gtIndex    = FindLayer(gammaTable, aAltitude);
+
+   // As in IntegrateAttenuation, the unscaled Earth radius is used.
+   double re = UtSphericalEarth::cEARTH_RADIUS;
+   double r0 = re + aAltitude;
+   double p  = r0 * cos(aElevation);
+   double s0 = r0 * sin(aElevation);
+   auto   rangeToLayer = [&](size_t aIndex)
+   {
+      double r = re + gammaTable[aIndex].mAltitude;
+      return sqrt(std::max(r * r - p * p, 0.0)) - s0;
+   };
+
+   // The first (partial) layer.
+   double lowerAltitude = gammaTable[gtIndex].mAltitude;
+   double upperAltitude = gammaTable[gtIndex + 1].mAltitude;
+   double f             = (aAltitude - lowerAltitude) / (upperAltitude - lowerAltitude);
+   double lowerGamma    = gammaTable[gtIndex].mGamma;
+   double upperGamma    = gammaTable[gtIndex + 1].mGamma;
+   lowerGamma           = lowerGamma + f * (upperGamma - lowerGamma);
+   double range         = rangeToLayer(gtIndex + 1);
+   if (range > aRange)
+   {
+      f          = aRange / range;
+      upperGamma = lowerGamma + f * (upperGamma - lowerGamma);
+      return (0.5 * (lowerGamma + upperGamma)) * (aRange * 0.001);
+   }
+   double atten_dB = (0.5 * (lowerGamma + upperGamma)) * (range * 0.001);
+
+   // Find the layer that contains the end of the path.
+   double s1       = s0 + aRange;
+   double altitude = sqrt(p * p + s1 * s1) - re;
+   size_t endIndex = maxIndex;
+   if (altitude < gammaTable.back().mAltitude)
+   {
+      endIndex = std::max(FindLayer(gammaTable, altitude), gtIndex + 1);
+   }
+
+   // The whole layers.
+   atten_dB += SurfaceLookup(aTable, gtIndex + 1, p) - SurfaceLookup(aTable, endIndex, p);
+
+   // The final (partial) layer.
+   if (endIndex < maxIndex)
+   {
+      double lowerRange = rangeToLayer(endIndex);
+      double upperRange = rangeToLayer(endIndex + 1);
+      f                 = (aRange - lowerRange) / (upperRange - lowerRange);
+      lowerGamma        = gammaTable[endIndex].mGamma;
+      upperGamma        = lowerGamma + f * (gammaTable[endIndex + 1].mGamma - lowerGamma);
+      atten_dB += ((0.5 * (lowerGamma + upperGamma)) * ((aRange - lowerRange) * 0.001));
+   }
+   return std::max(atten_dB, 0.0);
 }
 
 // =================================================================================================
 //! For a given frequency, compute the table of specific attenuation as a function of altitude.
 // private
-void WsfEM_ITU_Attenuation::GenerateTable(double                    aFrequency,
+void WsfEM_ITU_Attenuation::GenerateTable(GammaTable&               aTable,
+                                          double                    aFrequency,
                                           WsfEM_Types::Polarization aPolarization,
                                           WsfEnvironment&           aEnvironment)
 {
@@ -397,9 +627,11 @@ void WsfEM_ITU_Attenuation::GenerateTable(double                    aFrequency,
       maxAltInt += 1000;
    }
 
-   mFrequency = aFrequency;
-   mGammaTable.clear();
-   mGammaTable.reserve(maxAltInt);
+   aTable.mFrequency    = aFrequency;
+   aTable.mPolarization = aPolarization;
+   std::vector<Point>& gammaTable = aTable.mGammaTable;
+   gammaTable.clear();
+   gammaTable.reserve(maxAltInt / 1000 + 1);
    for (int ialt = 0; ialt <= maxAltInt; ialt += 1000)
    {
       point.mAltitude = ialt;
@@ -424,7 +656,7 @@ void WsfEM_ITU_Attenuation::GenerateTable(double                    aFrequency,
       {
          point.mGamma += ComputeCloudSpecificAttenuation(aFrequency, temperature, cloudWaterDensity);
       }
-      mGammaTable.push_back(point);
+      gammaTable.push_back(point);
    }
 }
 
@@ -71,27 +71,64 @@ public:
    static void PlotCloudFigure1();
 
 private:
+   //! Specific attenuation as a function of altitude.
+   struct Point
+   {
+      double mAltitude; //!< meters
+      double mGamma;    //!< dB/km
+   };
+
+   //! The tables computed for a given frequency and polarization.
+   struct GammaTable
+   {
+      double                    mFrequency;
+      WsfEM_Types::Polarization mPolarization;
+      std::vector<Point>        mGammaTable;
+      //! Optional cumulative attenuation (dB) from each altitude in mGammaTable to the top of the
+      //! table, indexed [altitude][elevation] (see GenerateSurface).
+      std::vector<double> mSurface;
+   };
+
    static void ComputeAtmosphereData(UtAtmosphere& aAtmosphere,
                                      double        aAltitude,
                                      double&       aPressure,
                                      double&       aTemperature,
                                      double&       aWaterVaporDensity);
 
-   void GenerateTable(double aFrequency, WsfEM_Types::Polarization aPolarization, WsfEnvironment& aEnvironment);
+   const GammaTable& GetTable(double aFrequency, WsfEM_Types::Polarization aPolarization, WsfEnvironment& aEnvironment);
+
+   void GenerateTable(GammaTable&               aTable,
+                      double                    aFrequency,
+                      WsfEM_Types::Polarization aPolarization,
+                      WsfEnvironment&           aEnvironment);
+
+   static size_t FindLayer(const std::vector<Point>& aGammaTable, double aAltitude);
+
+   static void GenerateSurface(GammaTable& aTable);
+
+   static double IntegrateAttenuation(const std::vector<Point>& aGammaTable,
+                                      double                    aRange,
+                                      double                    aElevation,
+                                      double                    aAltitude);
+
+   static double SurfaceAttenuation(const GammaTable& aTable, double aRange, double aElevation, double aAltitude);
+
+   static double SurfaceLookup(const GammaTable& aTable, size_t aIndex, double aP);
 
    //! The atmosphere for computing pressure, temperature and water vapor density.
    UtAtmosphere mAtmosphere;
 
-   //! The frequency at which the tables were last calculated
-   double mFrequency;
+   //! Tables for the most recently used frequencies and polarizations.
+   std::vector<GammaTable> mTables;
 
-   //! Specific attenuation as a function of altitude.
-   struct Point
-   {
-      double mAltitude; //!< meters
-      double mGamma;    //!< dB/km
-   };
-   std::vector<Point> mGammaTable;
+   //! The index of the most recently used entry in mTables.
+   size_t mLastTableIndex;
+
+   //! The index of the entry in mTables to be replaced when the cache is full.
+   size_t mReplaceTableIndex;
+
+   //! If true, each table includes the cumulative attenuation surface.
+   bool mUseSurface;
 };
 
 #endif
@@ -26,12 +26,15 @@
 #include "UtMath.hpp"
 #include "UtSphericalEarth.hpp"
 #include "UtVec3.hpp"
+#include "WsfArticulatedPart.hpp"
 #include "WsfComm.hpp"
 #include "WsfEM_Antenna.hpp"
 #include "WsfEM_Attenuation.hpp"
+#include "WsfEM_BistaticLinkCache.hpp"
 #include "WsfEM_Propagation.hpp"
 #include "WsfEM_Rcvr.hpp"
 #include "WsfEM_Util.hpp"
+#include "WsfEM_VisibilityCache.hpp"
 #include "WsfEM_Xmtr.hpp"
 #include "WsfEnvironment.hpp"
 #include "WsfLOS_Manager.hpp"
@@ -288,6 +291,75 @@ unsigned int WsfEM_Interaction::BeginOneWayInteraction(WsfEM_Xmtr* aXmtrPtr,
    return mFailedStatus;
 }
 
+// =================================================================================================
+//! Perform the transmitter-to-receiver portion of a bistatic two-way interaction.
+//!
+//! This is equivalent to BeginOneWayInteraction(aXmtrPtr, aRcvrPtr, false, false, false). The
+//! target-independent results (locations, ranges, zone attenuation and horizon masking) are saved
+//! in the receiver and reused while neither antenna has moved. The angles depend on the current
+//! cueing of the antennas and are always recomputed.
+//!
+//! @returns 0 if the transmitter and receiver are not masked by the Earth's horizon.
+unsigned int WsfEM_Interaction::BeginBistaticLink(WsfEM_Xmtr* aXmtrPtr, WsfEM_Rcvr* aRcvrPtr)
+{
+   WsfEM_Antenna* rcvrAntennaPtr = aRcvrPtr->GetAntenna();
+   WsfEM_Antenna* xmtrAntennaPtr = aXmtrPtr->GetAntenna();
+
+   double rcvrLocWCS[3];
+   double xmtrLocWCS[3];
+   rcvrAntennaPtr->GetLocationWCS(rcvrLocWCS);
+   xmtrAntennaPtr->GetLocationWCS(xmtrLocWCS);
+
+   WsfEM_BistaticLinkCache&        linkCache = aRcvrPtr->GetBistaticLinkCache();
+   WsfEM_BistaticLinkCache::XmtrId xmtrId(xmtrAntennaPtr->GetPlatform()->GetIndex(),
+                                          xmtrAntennaPtr->GetArticulatedPart()->GetNameId());
+   WsfEM_BistaticLinkCache::Link   link;
+   if (!linkCache.Find(xmtrId, xmtrLocWCS, rcvrLocWCS, mCategoryId, link))
+   {
+      unsigned int checkedStatus = mCheckedStatus;
+      unsigned int failedStatus  = mFailedStatus;
+      unsigned int status        = BeginOneWayInteraction(aXmtrPtr, aRcvrPtr, false, false, false);
+
+      UtVec3d::Set(link.mXmtrLocWCS, xmtrLocWCS);
+      UtVec3d::Set(link.mRcvrLocWCS, rcvrLocWCS);
+      link.mCategoryId           = mCategoryId;
+      link.mCheckedStatus        = mCheckedStatus & (~checkedStatus);
+      link.mFailedStatus         = mFailedStatus & (~failedStatus);
+      link.mZoneAttenuationValue = mZoneAttenuationValue;
+      link.mXmtrLoc              = mXmtrLoc;
+      link.mRcvrLoc              = mRcvrLoc;
+      link.mXmtrToRcvr           = mXmtrToRcvr;
+      link.mRcvrToXmtr           = mRcvrToXmtr;
+      linkCache.Insert(xmtrId, link);
+      return status;
+   }
+
+   mXmtrPtr = aXmtrPtr;
+   mRcvrPtr = aRcvrPtr;
+   mTgtPtr  = nullptr;
+   mCheckedStatus |= link.mCheckedStatus;
+   mFailedStatus |= link.mFailedStatus;
+   if (CategoryIsSet())
+   {
+      mZoneAttenuationValue = link.mZoneAttenuationValue;
+   }
+   mXmtrLoc    = link.mXmtrLoc;
+   mRcvrLoc    = link.mRcvrLoc;
+   mXmtrToRcvr = link.mXmtrToRcvr;
+   mRcvrToXmtr = link.mRcvrToXmtr;
+   if (mFailedStatus != 0)
+   {
+      return mFailedStatus;
+   }
+
+   // The remainder of BeginOneWayInteraction (with the limits ignored).
+   WithinFieldOfView(rcvrAntennaPtr, mRcvrLoc, mXmtrLoc, mRcvrToXmtr, mXmtrToRcvr, true);
+   WithinFieldOfView(xmtrAntennaPtr, mXmtrLoc, mRcvrLoc, mXmtrToRcvr, mRcvrToXmtr, true);
+   xmtrAntennaPtr->ComputeAspect(mXmtrToRcvr.mUnitVecWCS, mXmtrToRcvr.mAz, mXmtrToRcvr.mEl);
+   rcvrAntennaPtr->ComputeAspect(mRcvrToXmtr.mUnitVecWCS, mRcvrToXmtr.mAz, mRcvrToXmtr.mEl);
+   return mFailedStatus;
+}
+
 // =================================================================================================
 //! Initialize an interaction between a transmitter, a target and a receiver.
 //!
@@ -301,6 +373,12 @@ unsigned int WsfEM_Interaction::BeginOneWayInteraction(WsfEM_Xmtr* aXmtrPtr,
 //! receiver and not masked by the Earth's horizon.
 unsigned int WsfEM_Interaction::BeginTwoWayInteraction(WsfEM_Xmtr* aXmtrPtr, WsfPlatform* aTgtPtr, WsfEM_Rcvr* aRcvrPtr)
 {
+   // Any model data cached from a previous use of this interaction is no longer valid.
+   if (mModelCache.mCachePtr != nullptr)
+   {
+      mModelCache.mCachePtr->Reset();
+   }
+
    mXmtrPtr            = aXmtrPtr;
    mRcvrPtr            = aRcvrPtr;
    mTgtPtr             = aTgtPtr;
@@ -319,9 +397,8 @@ unsigned int WsfEM_Interaction::BeginTwoWayInteraction(WsfEM_Xmtr* aXmtrPtr, Wsf
       // to do the check to see if there is masking between the TX and RX.  But
       // we don't want to use "the antenna" range, because the "time" signal is
       // traveling over an implied omni directional comm
-      // TODO: the function BeginOneWayInteraction performs redundant calculations
-      // which is OK but inefficient.
-      int status = BeginOneWayInteraction(aXmtrPtr, aRcvrPtr, false, false, false);
+      // The result does not depend on the target, so it is shared by all targets (see BeginBistaticLink).
+      int status = BeginBistaticLink(aXmtrPtr, aRcvrPtr);
       // Restore the target!!! The above function may set it to null.
       mTgtPtr = aTgtPtr;
       if (status)
@@ -1024,6 +1101,53 @@ bool WsfEM_Interaction::MaskedByHorizon(const WsfEM_XmtrRcvr* aXmtrRcvrPtr,
    return maskedByHorizon;
 }
 
+namespace
+{
+// =================================================================================================
+//! Return the identifier of an antenna for the terrain masking cache.
+WsfEM_VisibilityCache::ObjectId GetVisibilityId(WsfEM_Antenna* aAntennaPtr)
+{
+   return WsfEM_VisibilityCache::ObjectId(aAntennaPtr->GetPlatform()->GetIndex(),
+                                          aAntennaPtr->GetArticulatedPart()->GetNameId());
+}
+
+// =================================================================================================
+//! Return the identifier of a platform for the terrain masking cache.
+WsfEM_VisibilityCache::ObjectId GetVisibilityId(WsfPlatform* aPlatformPtr)
+{
+   return WsfEM_VisibilityCache::ObjectId(aPlatformPtr->GetIndex(), WsfStringId());
+}
+
+// =================================================================================================
+//! Determine if an object is visible from an antenna, using the receiver's terrain masking cache if enabled.
+template<class TARGET>
+bool IsTargetVisible(WsfEM_Rcvr* aRcvrPtr, WsfEM_Antenna* aViewerPtr, TARGET* aTargetPtr, double aEarthRadiusScale)
+{
+   WsfSimulation*         simPtr = aRcvrPtr->GetSimulation();
+   WsfEM_VisibilityCache& cache  = aRcvrPtr->GetVisibilityCache();
+   if (!cache.IsEnabled())
+   {
+      return simPtr->GetLOS_Manager()->IsTargetVisible(aViewerPtr, aTargetPtr, 0.0, aEarthRadiusScale);
+   }
+
+   double simTime = simPtr->GetSimTime();
+   double viewerLocWCS[3];
+   double targetLocWCS[3];
+   aViewerPtr->GetLocationWCS(viewerLocWCS);
+   aTargetPtr->GetLocationWCS(targetLocWCS);
+
+   WsfEM_VisibilityCache::ObjectId viewerId  = GetVisibilityId(aViewerPtr);
+   WsfEM_VisibilityCache::ObjectId targetId  = GetVisibilityId(aTargetPtr);
+   bool                            isVisible = true;
+   if (!cache.Find(viewerId, targetId, simTime, viewerLocWCS, targetLocWCS, aEarthRadiusScale, isVisible))
+   {
+      isVisible = simPtr->GetLOS_Manager()->IsTargetVisible(aViewerPtr, aTargetPtr, 0.0, aEarthRadiusScale);
+      cache.Insert(viewerId, targetId, simTime, viewerLocWCS, targetLocWCS, aEarthRadiusScale, isVisible);
+   }
+   return isVisible;
+}
+} // namespace
+
 // =================================================================================================
 //! Does the terrain mask any part of the computation?
 bool WsfEM_Interaction::MaskedByTerrain()
@@ -1035,10 +1159,7 @@ bool WsfEM_Interaction::MaskedByTerrain()
       {
          // One way interaction involving a transmitter and a receiver
          mCheckedStatus |= cRCVR_TERRAIN_MASKING;
-         if (!mRcvrPtr->GetSimulation()->GetLOS_Manager()->IsTargetVisible(mRcvrPtr->GetAntenna(),
-                                                                           mXmtrPtr->GetAntenna(),
-                                                                           0.0,
-                                                                           mEarthRadiusScale))
+         if (!IsTargetVisible(mRcvrPtr, mRcvrPtr->GetAntenna(), mXmtrPtr->GetAntenna(), mEarthRadiusScale))
          {
             mFailedStatus |= cRCVR_TERRAIN_MASKING;
             maskedByTerrain = true;
@@ -1048,7 +1169,7 @@ bool WsfEM_Interaction::MaskedByTerrain()
       {
          // Two way interaction (xmtr-tgt-rcvr) or a one-way rcvr-tgt interaction.
          mCheckedStatus |= cRCVR_TERRAIN_MASKING;
-         if (!mRcvrPtr->GetSimulation()->GetLOS_Manager()->IsTargetVisible(mRcvrPtr->GetAntenna(), mTgtPtr, 0.0, mEarthRadiusScale))
+         if (!IsTargetVisible(mRcvrPtr, mRcvrPtr->GetAntenna(), mTgtPtr, mEarthRadiusScale))
          {
             mFailedStatus |= cRCVR_TERRAIN_MASKING;
             maskedByTerrain = true;
@@ -1057,10 +1178,7 @@ bool WsfEM_Interaction::MaskedByTerrain()
          {
             // Two-way bistatic interaction.
             mCheckedStatus |= cXMTR_TERRAIN_MASKING;
-            if (!mRcvrPtr->GetSimulation()->GetLOS_Manager()->IsTargetVisible(mXmtrPtr->GetAntenna(),
-                                                                              mTgtPtr,
-                                                                              0.0,
-                                                                              mEarthRadiusScale))
+            if (!IsTargetVisible(mRcvrPtr, mXmtrPtr->GetAntenna(), mTgtPtr, mEarthRadiusScale))
             {
                mFailedStatus |= cXMTR_TERRAIN_MASKING;
                maskedByTerrain = true;
@@ -1763,6 +1881,11 @@ void WsfEM_Interaction::Reset()
    {
       component->Reset();
    }
+
+   if (mModelCache.mCachePtr != nullptr)
+   {
+      mModelCache.mCachePtr->Reset();
+   }
 }
 
 // =================================================================================================
@@ -15,6 +15,7 @@
 #include "wsf_export.h"
 
 #include <iosfwd>
+#include <memory>
 #include <ostream>
 
 #include "UtLog.hpp"
@@ -266,6 +267,29 @@ public:
 
    const ComponentList& GetComponents() const { return mComponents; }
 
+   //! Base class for model-specific data cached on an interaction.
+   //! A propagation or clutter model may use this to share calculations that depend only on the
+   //! interaction (e.g.: the geometry) so they are performed once per interaction rather than once
+   //! per model. There is a single cache per interaction, so the user must verify the type of the
+   //! cache (dynamic_cast) before using it.
+   //! @note Reset() is called whenever the interaction is reset or assigned. The cache is not copied
+   //! when the interaction is copied.
+   class WSF_EXPORT ModelCache
+   {
+   public:
+      virtual ~ModelCache() = default;
+
+      //! Invalidate the cached data. The allocated storage may be retained for reuse.
+      virtual void Reset() {}
+   };
+
+   //! Return the model cache.
+   //! @returns The pointer to the model cache or nullptr if one has not been assigned.
+   ModelCache* GetModelCache() const { return mModelCache.mCachePtr.get(); }
+
+   //! Assign the model cache. The interaction assumes ownership of the cache.
+   void SetModelCache(std::unique_ptr<ModelCache> aCachePtr) { mModelCache.mCachePtr = std::move(aCachePtr); }
+
    //! A bit mask indicating which limits have been checked.
    //! If this value is zero then no limits have been checked,
    //! and the interaction should be considered 'failed'.
@@ -457,6 +481,8 @@ public:
    double mZoneAttenuationValue{0.0};
 
 private:
+   unsigned int BeginBistaticLink(WsfEM_Xmtr* aXmtrPtr, WsfEM_Rcvr* aRcvrPtr);
+
    void ComputeRF_PropagationFactor();
 
    void ComputeReceiverBeamAspect();
@@ -503,6 +529,25 @@ private:
    WsfPlatform* mTgtPtr{nullptr};
 
    ComponentList mComponents;
+
+   //! Holds the model cache so that it is not shared or copied when the interaction is copied.
+   struct ModelCacheHolder
+   {
+      ModelCacheHolder() = default;
+      ModelCacheHolder(const ModelCacheHolder&) {}
+      ModelCacheHolder& operator=(const ModelCacheHolder&)
+      {
+         if (mCachePtr != nullptr)
+         {
+            mCachePtr->Reset();
+         }
+         return *this;
+      }
+
+      std::unique_ptr<ModelCache> mCachePtr;
+   };
+
+   ModelCacheHolder mModelCache;
 };
 
 #endif
@@ -0,0 +1,260 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfEM_InteractionBatch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "UtMath.hpp"
+#include "UtVec3.hpp"
+#include "WsfEM_Antenna.hpp"
+#include "WsfEM_Interaction.hpp"
+#include "WsfEM_Rcvr.hpp"
+#include "WsfEM_Util.hpp"
+#include "WsfEM_Xmtr.hpp"
+#include "WsfPlatform.hpp"
+
+// =================================================================================================
+//! Remove all targets from the batch.
+void WsfEM_InteractionBatch::Clear()
+{
+   mTgtPtrs.clear();
+   for (int i = 0; i < 3; ++i)
+   {
+      mTgtLocWCS[i].clear();
+   }
+   mTgtAlt.clear();
+   mSurvivors.clear();
+}
+
+// =================================================================================================
+//! Reserve space for the specified number of targets.
+void WsfEM_InteractionBatch::Reserve(size_t aCount)
+{
+   mTgtPtrs.reserve(aCount);
+   for (int i = 0; i < 3; ++i)
+   {
+      mTgtLocWCS[i].reserve(aCount);
+   }
+   mTgtAlt.reserve(aCount);
+}
+
+// =================================================================================================
+//! Add a target to the batch.
+//! @param aTgtPtr The target. Its current location is captured.
+//! @returns The index of the target within the batch.
+size_t WsfEM_InteractionBatch::AddTarget(WsfPlatform* aTgtPtr)
+{
+   double locWCS[3];
+   double lat;
+   double lon;
+   double alt;
+   aTgtPtr->GetLocationWCS(locWCS);
+   aTgtPtr->GetLocationLLA(lat, lon, alt);
+
+   mTgtPtrs.push_back(aTgtPtr);
+   for (int i = 0; i < 3; ++i)
+   {
+      mTgtLocWCS[i].push_back(locWCS[i]);
+   }
+   mTgtAlt.push_back(alt);
+   return mTgtPtrs.size() - 1;
+}
+
+// =================================================================================================
+//! Check the targets against the range, altitude and angle limits of the transmitter and receiver.
+//! @param aXmtrPtr The transmitter.
+//! @param aRcvrPtr The receiver.
+//! @returns The number of targets that passed all of the checks (see GetSurvivors).
+size_t WsfEM_InteractionBatch::Evaluate(WsfEM_Xmtr* aXmtrPtr, WsfEM_Rcvr* aRcvrPtr)
+{
+   size_t count = mTgtPtrs.size();
+   mFailedStatus.assign(count, 0);
+   mRcvrRange.resize(count);
+   mXmtrRange.resize(count);
+   mFreeSpacePower.resize(count);
+   for (int i = 0; i < 3; ++i)
+   {
+      mRcvrUnitVecWCS[i].resize(count);
+      mXmtrUnitVecWCS[i].resize(count);
+   }
+   mSurvivors.clear();
+   mXmtrPtr = aXmtrPtr;
+   mRcvrPtr = aRcvrPtr;
+
+   WsfEM_Antenna* rcvrAntennaPtr = aRcvrPtr->GetAntenna();
+   WsfEM_Antenna* xmtrAntennaPtr = aXmtrPtr->GetAntenna();
+   bool           bistatic       = (xmtrAntennaPtr != rcvrAntennaPtr);
+
+   CheckLimits(rcvrAntennaPtr,
+               WsfEM_Interaction::cRCVR_RANGE_LIMITS,
+               WsfEM_Interaction::cRCVR_ALTITUDE_LIMITS,
+               mRcvrRange,
+               mRcvrUnitVecWCS);
+   if (bistatic)
+   {
+      CheckLimits(xmtrAntennaPtr,
+                  WsfEM_Interaction::cXMTR_RANGE_LIMITS,
+                  WsfEM_Interaction::cXMTR_ALTITUDE_LIMITS,
+                  mXmtrRange,
+                  mXmtrUnitVecWCS);
+   }
+   else
+   {
+      mXmtrRange = mRcvrRange;
+   }
+
+   // Free-space radar range equation with the peak antenna gains and a 1 m^2 target.
+   double wavelength = UtMath::cLIGHT_SPEED / aXmtrPtr->GetFrequency();
+   double factor     = (wavelength * wavelength) / (UtMath::cFOUR_PI * UtMath::cFOUR_PI * UtMath::cFOUR_PI);
+   factor *= aXmtrPtr->GetPower() * aXmtrPtr->GetPeakAntennaGain() * aRcvrPtr->GetPeakAntennaGain();
+   factor /= (aXmtrPtr->GetInternalLoss() * aRcvrPtr->GetInternalLoss());
+   for (size_t i = 0; i < count; ++i)
+   {
+      double xmtrRange   = std::max(mXmtrRange[i], 1.0);
+      double rcvrRange   = std::max(mRcvrRange[i], 1.0);
+      mFreeSpacePower[i] = factor / (xmtrRange * xmtrRange * rcvrRange * rcvrRange);
+   }
+
+   // The angle checks are done only for the targets that passed the limit checks.
+   double earthRadiusScale = aXmtrPtr->GetEarthRadiusMultiplier();
+   CheckFieldOfView(rcvrAntennaPtr, earthRadiusScale, WsfEM_Interaction::cRCVR_ANGLE_LIMITS, mRcvrUnitVecWCS);
+   if (bistatic)
+   {
+      CheckFieldOfView(xmtrAntennaPtr, earthRadiusScale, WsfEM_Interaction::cXMTR_ANGLE_LIMITS, mXmtrUnitVecWCS);
+   }
+
+   for (size_t i = 0; i < count; ++i)
+   {
+      if (mFailedStatus[i] == 0)
+      {
+         mSurvivors.push_back(i);
+      }
+   }
+   return mSurvivors.size();
+}
+
+// =================================================================================================
+//! Begin the full interaction for a target of the most recent Evaluate.
+//! @param aIndex  The index of the target (normally one of GetSurvivors).
+//! @param aResult [updated] The interaction.
+//! @returns The value returned by WsfEM_Interaction::BeginTwoWayInteraction.
+unsigned int WsfEM_InteractionBatch::BeginTwoWayInteraction(size_t aIndex, WsfEM_Interaction& aResult) const
+{
+   return aResult.BeginTwoWayInteraction(mXmtrPtr, mTgtPtrs[aIndex], mRcvrPtr);
+}
+
+// =================================================================================================
+//! Compute the range and unit vector from an antenna to each target and check the range and altitude limits.
+void WsfEM_InteractionBatch::CheckLimits(WsfEM_Antenna*       aAntennaPtr,
+                                         unsigned int         aRangeStatus,
+                                         unsigned int         aAltitudeStatus,
+                                         std::vector<double>& aRange,
+                                         std::vector<double>  aUnitVecWCS[3])
+{
+   double locWCS[3];
+   double lat;
+   double lon;
+   double alt;
+   aAntennaPtr->GetLocationWCS(locWCS);
+   aAntennaPtr->GetLocationLLA(lat, lon, alt);
+   double minRange = aAntennaPtr->GetMinimumRange();
+   double maxRange = aAntennaPtr->GetMaximumRange();
+   double minAlt   = aAntennaPtr->GetMinimumAltitude();
+   double maxAlt   = aAntennaPtr->GetMaximumAltitude();
+
+   // Plain loops over contiguous arrays without early exits so they can be vectorized.
+   // The unit vector is divided by the range (rather than multiplied by its inverse) to match UtVec3d::Normalize.
+   size_t        count  = mTgtPtrs.size();
+   const double* tgtX   = mTgtLocWCS[0].data();
+   const double* tgtY   = mTgtLocWCS[1].data();
+   const double* tgtZ   = mTgtLocWCS[2].data();
+   const double* tgtAlt = mTgtAlt.data();
+   double*       range  = aRange.data();
+   double*       unitX  = aUnitVecWCS[0].data();
+   double*       unitY  = aUnitVecWCS[1].data();
+   double*       unitZ  = aUnitVecWCS[2].data();
+   unsigned int* status = mFailedStatus.data();
+   for (size_t i = 0; i < count; ++i)
+   {
+      double dx = tgtX[i] - locWCS[0];
+      double dy = tgtY[i] - locWCS[1];
+      double dz = tgtZ[i] - locWCS[2];
+      double r  = std::sqrt(dx * dx + dy * dy + dz * dz);
+      double d  = (r > 0.0) ? r : 1.0;
+      range[i]  = r;
+      unitX[i]  = dx / d;
+      unitY[i]  = dy / d;
+      unitZ[i]  = dz / d;
+   }
+   for (size_t i = 0; i < count; ++i)
+   {
+      unsigned int failed = 0;
+      double       relAlt = tgtAlt[i] - alt;
+      failed |= ((range[i] < minRange) || (range[i] > maxRange)) ? aRangeStatus : 0U;
+      failed |= ((relAlt < minAlt) || (relAlt > maxAlt)) ? aAltitudeStatus : 0U;
+      status[i] |= failed;
+   }
+}
+
+// =================================================================================================
+//! Check the angle limits of an antenna for the targets that have not yet failed a check.
+//! This is the same as WsfEM_Interaction::WithinFieldOfView, including the use of the apparent
+//! (refracted) target location when the Earth radius scale is not 1.
+void WsfEM_InteractionBatch::CheckFieldOfView(WsfEM_Antenna*            aAntennaPtr,
+                                              double                    aEarthRadiusScale,
+                                              unsigned int              aAngleStatus,
+                                              const std::vector<double> aUnitVecWCS[3])
+{
+   double locWCS[3];
+   double lat;
+   double lon;
+   double alt;
+   aAntennaPtr->GetLocationWCS(locWCS);
+   aAntennaPtr->GetLocationLLA(lat, lon, alt);
+
+   size_t count = mTgtPtrs.size();
+   for (size_t i = 0; i < count; ++i)
+   {
+      if (mFailedStatus[i] != 0)
+      {
+         continue;
+      }
+
+      double unitVecWCS[3] = {aUnitVecWCS[0][i], aUnitVecWCS[1][i], aUnitVecWCS[2][i]};
+      if (aEarthRadiusScale != 1.0)
+      {
+         double tgtLocWCS[3] = {mTgtLocWCS[0][i], mTgtLocWCS[1][i], mTgtLocWCS[2][i]};
+         double apparentSrcLocWCS[3];
+         double apparentTgtLocWCS[3];
+         if (WsfEM_Util::ComputeApparentPosition(aEarthRadiusScale,
+                                                 locWCS,
+                                                 tgtLocWCS,
+                                                 alt,
+                                                 mTgtAlt[i],
+                                                 apparentSrcLocWCS,
+                                                 apparentTgtLocWCS))
+         {
+            UtVec3d::Subtract(unitVecWCS, apparentTgtLocWCS, locWCS);
+            UtVec3d::Normalize(unitVecWCS);
+         }
+      }
+
+      double az;
+      double el;
+      aAntennaPtr->ComputeAspect(unitVecWCS, az, el);
+      if (!aAntennaPtr->WithinFieldOfView(az, el))
+      {
+         mFailedStatus[i] |= aAngleStatus;
+      }
+   }
+}
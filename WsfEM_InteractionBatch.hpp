@@ -0,0 +1,119 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFEM_INTERACTIONBATCH_HPP
+#define WSFEM_INTERACTIONBATCH_HPP
+
+#include "wsf_export.h"
+
+#include <cstddef>
+#include <vector>
+
+class WsfEM_Antenna;
+class WsfEM_Interaction;
+class WsfEM_Rcvr;
+class WsfEM_Xmtr;
+class WsfPlatform;
+
+//! Early rejection of the targets of a two-way interaction.
+//!
+//! WsfEM_Interaction evaluates one target at a time. A wide-area search sensor rejects most
+//! targets on the range, altitude and angle limits, so this class performs those checks for
+//! one transmitter/receiver pair and many targets at once. The target data is kept as a
+//! structure of arrays so the range and altitude checks are simple loops the compiler can
+//! vectorize. Only the targets that survive need a full WsfEM_Interaction:
+//!
+//! \code
+//!    batch.Clear();
+//!    for (each target) batch.AddTarget(targetPtr);
+//!    batch.Evaluate(xmtrPtr, rcvrPtr);
+//!    for (size_t index : batch.GetSurvivors())
+//!    {
+//!       batch.BeginTwoWayInteraction(index, result);
+//!       ...
+//!    }
+//! \endcode
+//!
+//! The checks are the same as those in WsfEM_Interaction::BeginTwoWayInteraction, so a target
+//! is rejected only if the full interaction would also fail. The failed status of a rejected
+//! target may differ from that of the full interaction, because horizon masking is not checked
+//! here and the full interaction checks it before the angle limits. A caller that reports the
+//! failed status must therefore evaluate rejected targets with the full interaction as well
+//! (see WsfRadarSensor::EvaluateDetectionBatch); rejected targets fail early and are inexpensive.
+class WSF_EXPORT WsfEM_InteractionBatch
+{
+public:
+   void Clear();
+
+   void Reserve(size_t aCount);
+
+   size_t AddTarget(WsfPlatform* aTgtPtr);
+
+   size_t Evaluate(WsfEM_Xmtr* aXmtrPtr, WsfEM_Rcvr* aRcvrPtr);
+
+   unsigned int BeginTwoWayInteraction(size_t aIndex, WsfEM_Interaction& aResult) const;
+
+   //! Return the number of targets in the batch.
+   size_t GetTargetCount() const { return mTgtPtrs.size(); }
+
+   //! Return the target with the specified index.
+   WsfPlatform* GetTarget(size_t aIndex) const { return mTgtPtrs[aIndex]; }
+
+   //! Return the indices of the targets that passed all of the checks (in ascending order).
+   const std::vector<size_t>& GetSurvivors() const { return mSurvivors; }
+
+   //! Return the WsfEM_Interaction status bits of the checks that failed (0 if none).
+   unsigned int GetFailedStatus(size_t aIndex) const { return mFailedStatus[aIndex]; }
+
+   //! Return the range from the receiver to the target (meters).
+   double GetRcvrToTgtRange(size_t aIndex) const { return mRcvrRange[aIndex]; }
+
+   //! Return the range from the transmitter to the target (meters).
+   double GetXmtrToTgtRange(size_t aIndex) const { return mXmtrRange[aIndex]; }
+
+   //! Return the free-space power received from a 1 m^2 target using the peak antenna gains (watts).
+   //! This does not include the propagation, attenuation or masking factors.
+   double GetFreeSpacePower(size_t aIndex) const { return mFreeSpacePower[aIndex]; }
+
+private:
+   void CheckLimits(WsfEM_Antenna*       aAntennaPtr,
+                    unsigned int         aRangeStatus,
+                    unsigned int         aAltitudeStatus,
+                    std::vector<double>& aRange,
+                    std::vector<double>  aUnitVecWCS[3]);
+
+   void CheckFieldOfView(WsfEM_Antenna*            aAntennaPtr,
+                         double                    aEarthRadiusScale,
+                         unsigned int              aAngleStatus,
+                         const std::vector<double> aUnitVecWCS[3]);
+
+   //! @name Target data.
+   //@{
+   std::vector<WsfPlatform*> mTgtPtrs;
+   std::vector<double>       mTgtLocWCS[3];
+   std::vector<double>       mTgtAlt;
+   //@}
+
+   //! @name Results.
+   //@{
+   WsfEM_Xmtr*               mXmtrPtr = nullptr;
+   WsfEM_Rcvr*               mRcvrPtr = nullptr;
+   std::vector<unsigned int> mFailedStatus;
+   std::vector<double>       mRcvrRange;
+   std::vector<double>       mRcvrUnitVecWCS[3];
+   std::vector<double>       mXmtrRange;
+   std::vector<double>       mXmtrUnitVecWCS[3];
+   std::vector<double>       mFreeSpacePower;
+   std::vector<size_t>       mSurvivors;
+   //@}
+};
+
+#endif
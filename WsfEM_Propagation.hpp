@@ -79,6 +79,11 @@ class WSF_EXPORT WsfEM_Propagation : public WsfObject
       //! @note See the code in WsfEM_PropagationTypes as to why this is present.
       virtual bool IsNullModel() const                     { return false; }
 
+      //! May ComputePropagationFactor be called concurrently for different interactions?
+      //! Models that keep per-call state in member variables must return false (the default).
+      //! Sensors that evaluate detection attempts on multiple threads require this.
+      virtual bool IsReentrant() const                     { return false; }
+
 
    protected:
       WsfEM_Propagation(const WsfEM_Propagation& aSrc);
@@ -108,7 +108,9 @@ WsfEM_Rcvr::WsfEM_Rcvr(RcvrFunction   aFunction,
      mDetectionThreshold(pow(10.0, 3.0 / 10.0)),    // 3 dB above noise level
      mExplicitInstantaneousBandwidth(false),
      mExplicitNoisePower(false),
-     mCheckXmtrMasking(true)
+     mCheckXmtrMasking(true),
+     mVisibilityCache(),
+     mBistaticLinkCache()
 {
    // Newly created components will have me as a parent.
    mComponents.SetParentOfComponents(this);
@@ -153,7 +155,9 @@ WsfEM_Rcvr::WsfEM_Rcvr(const WsfEM_Rcvr& aSrc,
      mDetectionThreshold(aSrc.mDetectionThreshold),
      mExplicitInstantaneousBandwidth(aSrc.mExplicitInstantaneousBandwidth),
      mExplicitNoisePower(aSrc.mExplicitNoisePower),
-     mCheckXmtrMasking(aSrc.mCheckXmtrMasking)
+     mCheckXmtrMasking(aSrc.mCheckXmtrMasking),
+     mVisibilityCache(aSrc.mVisibilityCache),
+     mBistaticLinkCache(aSrc.mBistaticLinkCache)
 {
    // Newly created components will have me as a parent.
    mComponents.SetParentOfComponents(this);
@@ -402,6 +406,10 @@ bool WsfEM_Rcvr::ProcessInput(UtInput& aInput)
    {
       aInput.ReadValue(mCheckXmtrMasking);
    }
+   else if (mVisibilityCache.ProcessInput(aInput))
+   {
+      // 'terrain_masking_cache_...' commands
+   }
    else if (mComponents.ProcessComponentInput(aInput))
    {
       // First try components already attached. If the input was not recognized by one of them then
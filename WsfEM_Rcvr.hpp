@@ -50,7 +50,9 @@ class     WsfArticulatedPart;
 class     WsfEM_Antenna;
 class     WsfEM_Interaction;
 class     WsfEM_Rcvr;
+#include "WsfEM_BistaticLinkCache.hpp"
 #include "WsfEM_Types.hpp"
+#include "WsfEM_VisibilityCache.hpp"
 class     WsfEM_Xmtr;
 #include "WsfEM_XmtrRcvr.hpp"
 class     WsfPlatform;
@@ -285,6 +287,12 @@ class WSF_EXPORT WsfEM_Rcvr : public WsfEM_XmtrRcvr
       //! Transmitter flag utilized primarily for bistatic interactions.
       bool CheckXmtrMasking() { return mCheckXmtrMasking && CheckMasking();  }
 
+      //! Return the cache of terrain masking results (see WsfEM_Interaction::MaskedByTerrain).
+      WsfEM_VisibilityCache& GetVisibilityCache() { return mVisibilityCache; }
+
+      //! Return the bistatic transmitter-to-receiver links (see WsfEM_Interaction::BeginTwoWayInteraction).
+      WsfEM_BistaticLinkCache& GetBistaticLinkCache() { return mBistaticLinkCache; }
+
    protected:
       void UpdateIndices();
 
@@ -336,6 +344,9 @@ class WSF_EXPORT WsfEM_Rcvr : public WsfEM_XmtrRcvr
       bool           mExplicitNoisePower;
 
       bool           mCheckXmtrMasking;
+
+      WsfEM_VisibilityCache   mVisibilityCache;
+      WsfEM_BistaticLinkCache mBistaticLinkCache;
 };
 
 #endif
@@ -57,6 +57,8 @@ class WSF_EXPORT WsfEM_SimpleAttenuation : public WsfEM_Attenuation
 
       bool AcceptsInlineBlockInput() const override { return true; }
 
+      bool IsReentrant() const override             { return true; }
+
    private:
 
       double ComputeAttenuationFactorP(double aRange,
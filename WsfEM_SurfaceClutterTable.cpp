@@ -36,8 +36,25 @@
 
 #include "WsfEM_SurfaceClutterTable.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <set>
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "UtEntity.hpp"
 #include "UtInput.hpp"
 #include "UtInputFile.hpp"
 #include "UtInputBlock.hpp"
@@ -55,37 +72,105 @@
 namespace
 {
    const double cHUGE_VALUE = 1.0E+10;
+
+   //! Identifies the binary clutter table format (see ClutterTableFunction::WriteBinaryTable).
+   const char cBINARY_MAGIC[8] = {'W', 'S', 'F', 'C', 'L', 'U', 'T', '1'};
+
+   //! Map an entire file read-only into memory.
+   //! @param aFileName [input]  The name of the file to be mapped.
+   //! @param aSize     [output] The size of the mapped file (bytes).
+   //! @returns A pointer to the start of the mapping, or nullptr if the file could not be mapped.
+   void* MapFile(const std::string& aFileName, size_t& aSize)
+   {
+      void* mapPtr = nullptr;
+      aSize        = 0;
+#ifdef _WIN32
+      HANDLE file = CreateFileA(aFileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file != INVALID_HANDLE_VALUE)
+      {
+         LARGE_INTEGER fileSize;
+         if (GetFileSizeEx(file, &fileSize) && (fileSize.QuadPart > 0))
+         {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+               mapPtr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+               if (mapPtr != nullptr)
+               {
+                  aSize = static_cast<size_t>(fileSize.QuadPart);
+               }
+               CloseHandle(mapping); // The view keeps the mapping alive
+            }
+         }
+         CloseHandle(file);
+      }
+#else
+      int fd = open(aFileName.c_str(), O_RDONLY);
+      if (fd >= 0)
+      {
+         struct stat fileStat;
+         if ((fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0))
+         {
+            size_t size   = static_cast<size_t>(fileStat.st_size);
+            void*  viewPtr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            if (viewPtr != MAP_FAILED)
+            {
+               mapPtr = viewPtr;
+               aSize  = size;
+            }
+         }
+         close(fd); // The mapping remains valid after the descriptor is closed
+      }
+#endif
+      return mapPtr;
+   }
+
+   //! Release a mapping created by MapFile.
+   void UnmapFile(void* aMapPtr, size_t aSize)
+   {
+#ifdef _WIN32
+      UnmapViewOfFile(aMapPtr);
+#else
+      munmap(aMapPtr, aSize);
+#endif
+   }
+
+   //! Return true if the values are strictly increasing.
+   bool IsIncreasing(const double* aValues, size_t aCount)
+   {
+      for (size_t i = 1; i < aCount; ++i)
+      {
+         if (!(aValues[i] > aValues[i - 1]))
+         {
+            return false;
+         }
+      }
+      return true;
+   }
 }
 
 using namespace std;
 
 // =================================================================================================
-//•	mAltitudesPtr : 使用 std::shared_ptr 管理 ClutterTable 的内存，避免手动管理内存。
+//•	mTablePtr : 使用 std::shared_ptr 管理 ClutterTable 的内存，避免手动管理内存。
 //•	mType : 表示杂波表的类型，初始值为 cUNDEFINED。
 //•	mConstantClutter : 用于存储常量杂波值。
-//•	mReceiver 和 mTarget : 分别表示接收器和目标的位置。
 WsfEM_SurfaceClutterTable::WsfEM_SurfaceClutterTable()
    : WsfEM_Clutter(),
-     mAltitudesPtr(std::make_shared<ClutterTable>()),
-     mAltitudes(*mAltitudesPtr),
+     mTablePtr(std::make_shared<ClutterTable>()),
      mType(cUNDEFINED),
-     mConstantClutter(0.0),
-     mReceiver(),
-     mTarget()
+     mConstantClutter(0.0)
 {
 }
 
 // =================================================================================================
 WsfEM_SurfaceClutterTable::WsfEM_SurfaceClutterTable(const WsfEM_SurfaceClutterTable& aSrc)
    : WsfEM_Clutter(aSrc),
-     mAltitudesPtr(aSrc.mAltitudesPtr),
-     mAltitudes(*mAltitudesPtr),
+     mTablePtr(aSrc.mTablePtr),
      mType(aSrc.mType),
-     mConstantClutter(aSrc.mConstantClutter),
-     mReceiver(aSrc.mReceiver),
-     mTarget(aSrc.mTarget)
+     mConstantClutter(aSrc.mConstantClutter)
 {
-   // TODO need to make the table a shared ptr
 }
 
 WsfEM_SurfaceClutterTable& WsfEM_SurfaceClutterTable::operator=(const WsfEM_SurfaceClutterTable& aRhs)
@@ -93,25 +178,138 @@ WsfEM_SurfaceClutterTable& WsfEM_SurfaceClutterTable::operator=(const WsfEM_Surf
    if (this != &aRhs)
    {
       WsfEM_Clutter::operator=(aRhs);
-      mAltitudesPtr = aRhs.mAltitudesPtr;
-      mAltitudes = *mAltitudesPtr;
+      mTablePtr = aRhs.mTablePtr;
       mType = aRhs.mType;
       mConstantClutter = aRhs.mConstantClutter;
-      mReceiver = aRhs.mReceiver;
-      mTarget = aRhs.mTarget;
    }
    return *this;
 }
 
-//virtual
 WsfEM_SurfaceClutterTable::ClutterTable::~ClutterTable()
 {
-   ClutterTable::iterator iter = begin();
-   while (iter != end())
+   if (mMapPtr != nullptr)
+   {
+      UnmapFile(mMapPtr, mMapSize);
+   }
+}
+
+// =================================================================================================
+//! Append a set of independent values to the table data.
+WsfEM_SurfaceClutterTable::Axis WsfEM_SurfaceClutterTable::ClutterTable::AddAxis(const std::vector<double>& aValues)
+{
+   Axis axis;
+   axis.mOffset = mValues.size();
+   axis.mCount  = aValues.size();
+   axis.mScale  = ComputeAxisScale(aValues.data(), aValues.size());
+   mValues.insert(mValues.end(), aValues.begin(), aValues.end());
+   return axis;
+}
+
+// =================================================================================================
+//! Interpolate the clutter for an altitude entry.
+//! @param aEntry   [input] The altitude entry.
+//! @param aRange   [input] The ground range to the target (m).
+//! @param aBearing [input] The true bearing to the target (rad; ignored if the entry has no bearings).
+//! @returns The interpolated clutter (W).
+double WsfEM_SurfaceClutterTable::ClutterTable::Evaluate(const AltitudeEntry& aEntry,
+                                                         double               aRange,
+                                                         double               aBearing) const
+{
+   size_t numRanges = aEntry.mRanges.mCount;
+   if (numRanges == 0)
+   {
+      return 0.0;
+   }
+
+   AxisLookup rangeLookup;
+   LookupAxis(mDataPtr + aEntry.mRanges.mOffset, numRanges, aEntry.mRanges.mScale, aRange, rangeLookup);
+   const double* cluttersPtr = mDataPtr + aEntry.mClutterOffset;
+   if (aEntry.mBearings.mCount == 0)
+   {
+      double clutter0 = cluttersPtr[rangeLookup.mIndex];
+      return clutter0 + rangeLookup.mRatio * (cluttersPtr[rangeLookup.mIndex1] - clutter0);
+   }
+
+   AxisLookup bearingLookup;
+   const Axis& bearings = aEntry.mBearings;
+   LookupAxis(mDataPtr + bearings.mOffset, bearings.mCount, bearings.mScale, aBearing, bearingLookup);
+   const double* row0Ptr  = cluttersPtr + bearingLookup.mIndex * numRanges;
+   const double* row1Ptr  = cluttersPtr + bearingLookup.mIndex1 * numRanges;
+   double        clutter0 = row0Ptr[rangeLookup.mIndex] +
+                            rangeLookup.mRatio * (row0Ptr[rangeLookup.mIndex1] - row0Ptr[rangeLookup.mIndex]);
+   double        clutter1 = row1Ptr[rangeLookup.mIndex] +
+                            rangeLookup.mRatio * (row1Ptr[rangeLookup.mIndex1] - row1Ptr[rangeLookup.mIndex]);
+   return clutter0 + bearingLookup.mRatio * (clutter1 - clutter0);
+}
+
+// =================================================================================================
+//! Determine if a set of independent values is uniformly spaced.
+//! @returns (aCount - 1) / (last - first) if the values are uniformly spaced, otherwise 0.
+// static
+double WsfEM_SurfaceClutterTable::ComputeAxisScale(const double* aValues, size_t aCount)
+{
+   if ((aCount < 2) || (!(aValues[aCount - 1] > aValues[0])))
+   {
+      return 0.0;
+   }
+
+   double step = (aValues[aCount - 1] - aValues[0]) / static_cast<double>(aCount - 1);
+   for (size_t i = 1; i < aCount - 1; ++i)
+   {
+      if (fabs(aValues[i] - (aValues[0] + static_cast<double>(i) * step)) > 1.0E-6 * step)
+      {
+         return 0.0;
+      }
+   }
+   return 1.0 / step;
+}
+
+// =================================================================================================
+//! Find the values that bracket a given value, with the same clamping as TblLookupLU
+//! (values below the first value use ratio 0, values above the last value use ratio 1).
+//! Uniformly spaced values are indexed directly; others use a binary search.
+// static
+void WsfEM_SurfaceClutterTable::LookupAxis(const double* aValues,
+                                           size_t        aCount,
+                                           double        aScale,
+                                           double        aValue,
+                                           AxisLookup&   aLookup)
+{
+   size_t last = aCount - 1;
+   if ((aCount < 2) || (aValue <= aValues[0]))
+   {
+      aLookup.mIndex = 0;
+      aLookup.mRatio = 0.0;
+   }
+   else if (aValue >= aValues[last])
+   {
+      aLookup.mIndex = last - 1;
+      aLookup.mRatio = 1.0;
+   }
+   else
    {
-      delete *iter;
-      ++iter;
+      size_t index = 0;
+      if (aScale > 0.0)
+      {
+         // Compute the index directly, then correct for any round-off in the spacing.
+         index = std::min(static_cast<size_t>((aValue - aValues[0]) * aScale), last - 1);
+         while ((index > 0) && (aValue < aValues[index]))
+         {
+            --index;
+         }
+         while ((index < last - 1) && (aValue >= aValues[index + 1]))
+         {
+            ++index;
+         }
+      }
+      else
+      {
+         index = static_cast<size_t>(std::upper_bound(aValues + 1, aValues + last, aValue) - aValues) - 1;
+      }
+      aLookup.mIndex = index;
+      aLookup.mRatio = (aValue - aValues[index]) / (aValues[index + 1] - aValues[index]);
    }
+   aLookup.mIndex1 = std::min(aLookup.mIndex + 1, last);
 }
 
 // =================================================================================================
@@ -150,6 +348,7 @@ WsfEM_Clutter* WsfEM_SurfaceClutterTable::Clone() const
 //2.	clutter 或 constant : 定义常量杂波值。
 //3.	clutters 或 inlineTable : 定义通用杂波表。
 //4.	file : 从文件加载杂波表。
+//5.	binary_file : 从二进制文件加载杂波表（内存映射）。
 //•	如果输入命令不匹配，则调用父类的 ProcessInput 方法。
 bool WsfEM_SurfaceClutterTable::ProcessInput(UtInput& aInput)
 {
@@ -192,12 +391,27 @@ bool WsfEM_SurfaceClutterTable::ProcessInput(UtInput& aInput)
    }
    else if (command == "file" && (! inlineTable))
    {
+      if (mType != cUNDEFINED)
+      {
+         throw UtInput::BadValue(aInput, "clutter table cannot be used after 'clutter' has been defined.");
+      }
+      mType = cGENERIC;
       string filename;
       aInput.ReadCommand(filename);
       UtInput fileInput;
       fileInput.PushInput(ut::make_unique<UtInputFile>(filename));
       Load(fileInput);
    }
+   else if (command == "binary_file" && (! inlineTable))
+   {
+      if (mType != cUNDEFINED)
+      {
+         throw UtInput::BadValue(aInput, "clutter table cannot be used after 'clutter' has been defined.");
+      }
+      string filename;
+      aInput.ReadCommand(filename);
+      LoadBinary(aInput, filename);
+   }
    else
    {
       myCommand = WsfEM_Clutter::ProcessInput(aInput);
@@ -359,13 +573,130 @@ bool WsfEM_SurfaceClutterTable::Load(UtInput& aInput)
    ranges.clear();
    clutters.clear();
 
-   if (mAltitudes.size() < 2)
+   // The table data is complete; it is not modified after this point.
+   ClutterTable& table = *mTablePtr;
+   table.mDataPtr = table.mValues.data();
+   table.mAltitudeScale = ComputeAxisScale(table.mAltitudes.data(), table.mAltitudes.size());
+   return true;
+}
+
+// =================================================================================================
+//! Load a table in the binary form written by the clutter table generator (WSFCLUT1).
+//! The file is memory-mapped and the clutter values are used in place; only the
+//! per-altitude headers and the independent values are read during the load.
+//! @param aInput    [input] The input stream (for error reporting).
+//! @param aFileName [input] The name of the binary file.
+void WsfEM_SurfaceClutterTable::LoadBinary(UtInput& aInput, const std::string& aFileName)
+{
+   size_t mapSize = 0;
+   void*  mapPtr  = MapFile(aFileName, mapSize);
+   if (mapPtr == nullptr)
    {
-      // Just copy the first entry
-      mAltitudes.push_back(mAltitudes[0]);
+      throw UtInput::BadValue(aInput, "Unable to open clutter table file: " + aFileName);
    }
 
-   return true;
+   // The table owns the mapping from here on, so it is released even if the load fails.
+   ClutterTable& table = *mTablePtr;
+   table.mMapPtr = mapPtr;
+   table.mMapSize = mapSize;
+   table.mDataPtr = static_cast<const double*>(mapPtr);
+
+   const char* basePtr = static_cast<const char*>(mapPtr);
+   size_t      offset  = 0;
+   auto require = [&](size_t aBytes)
+   {
+      if (aBytes > mapSize - offset)
+      {
+         throw UtInput::BadValue(aInput, "Clutter table file is truncated: " + aFileName);
+      }
+   };
+   auto readUInt32 = [&]()
+   {
+      require(sizeof(uint32_t));
+      uint32_t value;
+      memcpy(&value, basePtr + offset, sizeof(value));
+      offset += sizeof(value);
+      return value;
+   };
+   auto readDouble = [&]()
+   {
+      require(sizeof(double));
+      double value;
+      memcpy(&value, basePtr + offset, sizeof(value));
+      offset += sizeof(value);
+      return value;
+   };
+   // Every field in the file is 8-byte aligned, so arrays of doubles are referenced in place.
+   auto readAxis = [&](size_t aCount)
+   {
+      require(aCount * sizeof(double));
+      Axis axis;
+      axis.mOffset = offset / sizeof(double);
+      axis.mCount  = aCount;
+      axis.mScale  = ComputeAxisScale(table.mDataPtr + axis.mOffset, aCount);
+      if (!IsIncreasing(table.mDataPtr + axis.mOffset, aCount))
+      {
+         throw UtInput::BadValue(aInput, "Ranges and bearings must be increasing in clutter table file: " + aFileName);
+      }
+      offset += aCount * sizeof(double);
+      return axis;
+   };
+
+   require(sizeof(cBINARY_MAGIC));
+   if (memcmp(basePtr, cBINARY_MAGIC, sizeof(cBINARY_MAGIC)) != 0)
+   {
+      throw UtInput::BadValue(aInput, "Not a binary clutter table file: " + aFileName);
+   }
+   offset += sizeof(cBINARY_MAGIC);
+
+   uint32_t type = readUInt32();
+   if ((type != cGENERIC) && (type != cSITE_SPECIFIC))
+   {
+      throw UtInput::BadValue(aInput, "Invalid table type in clutter table file: " + aFileName);
+   }
+   mType = static_cast<Type>(type);
+
+   uint32_t altitudeCount = readUInt32();
+   if (altitudeCount == 0)
+   {
+      throw UtInput::BadValue(aInput, "No altitudes defined in clutter table file: " + aFileName);
+   }
+   table.mAltitudes.reserve(altitudeCount);
+   table.mEntries.reserve(altitudeCount);
+   for (uint32_t i = 0; i < altitudeCount; ++i)
+   {
+      double   altitude     = readDouble();
+      uint32_t rangeCount   = readUInt32();
+      uint32_t bearingCount = readUInt32();
+      if ((! table.mAltitudes.empty()) && (!(altitude > table.mAltitudes.back())))
+      {
+         throw UtInput::BadValue(aInput, "Altitudes must be increasing in clutter table file: " + aFileName);
+      }
+      if ((rangeCount == 0) || ((mType == cGENERIC) != (bearingCount == 0)))
+      {
+         throw UtInput::BadValue(aInput, "Invalid altitude entry in clutter table file: " + aFileName);
+      }
+
+      AltitudeEntry entry;
+      entry.mRanges = readAxis(rangeCount);
+      entry.mBearings = readAxis(bearingCount);
+      size_t clutterCount = static_cast<size_t>(std::max(bearingCount, static_cast<uint32_t>(1))) * rangeCount;
+      require(clutterCount * sizeof(double));
+      entry.mClutterOffset = offset / sizeof(double);
+      offset += clutterCount * sizeof(double);
+
+      table.mAltitudes.push_back(altitude);
+      table.mEntries.push_back(entry);
+   }
+   table.mAltitudeScale = ComputeAxisScale(table.mAltitudes.data(), table.mAltitudes.size());
+
+   if (DebugEnabled())
+   {
+      auto out = ut::log::debug() << "Mapped binary clutter table.";
+      out.AddNote() << "File: " << aFileName;
+      out.AddNote() << "Altitudes: " << altitudeCount;
+      out.AddNote() << "Size: " << mapSize << " bytes";
+   }
 }
 // =================================================================================================
 //•	根据目标的高度和距离，计算杂波功率。
@@ -378,7 +709,8 @@ double WsfEM_SurfaceClutterTable::ComputeClutterPower(WsfEM_Interaction& aIntera
                                                       double             aProcessingFactor)
 {
    // Return immediately if the altitude table is empty for some reason
-   if (mAltitudes.empty())
+   const ClutterTable& table = *mTablePtr;
+   if (table.mEntries.empty())
    {
       return 0.0;
    }
@@ -389,74 +721,32 @@ double WsfEM_SurfaceClutterTable::ComputeClutterPower(WsfEM_Interaction& aIntera
    double altitude = aInteraction.mTgtLoc.mAlt;
 
    // get range to target
-   //double aRange = WsfMeasurementUtil::GroundRange(aInteraction.mRcvrLoc.mLocWCS,
-   //                                     aInteraction.mTgtLoc.mLocWCS);
-   mReceiver.SetLocationWCS(aInteraction.mRcvrLoc.mLocWCS);
-   mTarget.SetLocationWCS(aInteraction.mTgtLoc.mLocWCS);
+   // The entities are local so the shared table may be evaluated concurrently.
+   UtEntity receiver;
+   UtEntity target;
+   receiver.SetLocationWCS(aInteraction.mRcvrLoc.mLocWCS);
+   target.SetLocationWCS(aInteraction.mTgtLoc.mLocWCS);
    double locNED[3];
-   mReceiver.GetRelativeLocationNED(&mTarget, locNED);
+   receiver.GetRelativeLocationNED(&target, locNED);
    double range = sqrt(locNED[0] * locNED[0] + locNED[1] * locNED[1]);
 
-   // Find the index to use
-   int    index_(0);
-   double ratio_(0.0);
-   if (altitude <= mAltitudes[0]->mAltitude)
-   {
-      index_ = 0;
-      ratio_ = 0.0;
-   }
-   else if (altitude >= mAltitudes[mAltitudes.size() - 1]->mAltitude)
-   {
-      index_ = static_cast<int>(mAltitudes.size()) - 2;
-      ratio_ = 1.0;
-   }
-   else
-   {
-      while (altitude > mAltitudes[index_]->mAltitude)
-      {
-         ++index_;
-      }
-      while (altitude < mAltitudes[index_]->mAltitude)
-      {
-         --index_;
-      }
-      ratio_ = (altitude - mAltitudes[index_]->mAltitude) /
-               (mAltitudes[index_ + 1]->mAltitude - mAltitudes[index_]->mAltitude);
-   }
+   // Find the altitude entries that bracket the target
+   AxisLookup altitudeLookup;
+   LookupAxis(table.mAltitudes.data(), table.mAltitudes.size(), table.mAltitudeScale, altitude, altitudeLookup);
+   double ratio_ = altitudeLookup.mRatio;
 
-   // Find the first interpolated clutter
    double bearing = 0.0;
-   double clutter1 = 0.0;
-   mAltitudes[index_]->mRangeLookup.Lookup(mAltitudes[index_]->mRanges, range);
    if (mType == cSITE_SPECIFIC)
    {
       // find the true target bearing from true north.
       double targetVecNED[3];
       aInteraction.GetReceiver()->GetPlatform()->ConvertWCSVectorToNED(targetVecNED, aInteraction.mRcvrToTgt.mTrueUnitVecWCS);
       bearing = atan2(targetVecNED[1], targetVecNED[0]);
-      mAltitudes[index_]->mBearingLookup.Lookup(mAltitudes[index_]->mBearings, bearing);
-      mAltitudes[index_]->mRangeLookup.Lookup(mAltitudes[index_]->mRanges, range);
-      clutter1 = TblEvaluate(mAltitudes[index_]->mClutters2, mAltitudes[index_]->mBearingLookup, mAltitudes[index_]->mRangeLookup);
-   }
-   else
-   {
-      mAltitudes[index_]->mRangeLookup.Lookup(mAltitudes[index_]->mRanges, range);
-      clutter1 = TblEvaluate(mAltitudes[index_]->mClutters1, mAltitudes[index_]->mRangeLookup);
    }
 
-   // Find the second interpolated clutter
-   double clutter2 = 0.0;
-   mAltitudes[index_ + 1]->mRangeLookup.Lookup(mAltitudes[index_ + 1]->mRanges, range);
-   if (mType == cSITE_SPECIFIC)
-   {
-      mAltitudes[index_ + 1]->mBearingLookup.Lookup(mAltitudes[index_ + 1]->mBearings, bearing);
-      mAltitudes[index_ + 1]->mRangeLookup.Lookup(mAltitudes[index_ + 1]->mRanges, range);
-      clutter2 = TblEvaluate(mAltitudes[index_ + 1]->mClutters2, mAltitudes[index_ + 1]->mBearingLookup, mAltitudes[index_ + 1]->mRangeLookup);
-   }
-   else
-   {
-      clutter2 = TblEvaluate(mAltitudes[index_ + 1]->mClutters1, mAltitudes[index_ + 1]->mRangeLookup);
-   }
+   // Find the interpolated clutter at each of the bracketing altitudes
+   double clutter1 = table.Evaluate(table.mEntries[altitudeLookup.mIndex], range, bearing);
+   double clutter2 = table.Evaluate(table.mEntries[altitudeLookup.mIndex1], range, bearing);
 
    if (DebugEnabled())
    {
@@ -510,28 +800,23 @@ void WsfEM_SurfaceClutterTable::AddAltitudeEntry(double               aAltitude,
                                                  std::vector<double>& aBearings,
                                                  std::vector<double>& aClutters)
 {
-   AltitudeEntry* altEntryPtr = new AltitudeEntry();
-   altEntryPtr->mAltitude = aAltitude;
-   altEntryPtr->mRanges.SetValues(aRanges);
-   altEntryPtr->mBearings.SetValues(aBearings);
-   size_t numRanges = altEntryPtr->mRanges.GetSize();
-   size_t numBearings = altEntryPtr->mBearings.GetSize();
-
-   altEntryPtr->mClutters2.Resize((int)numBearings, (int)numRanges);
-   // insert based on range and bearing; convention is that bearing is the outer loop,
-   // so we should have in the table:
-   // (b1, r1, c)
-   // (b1, r2, c)
-   // ...
-   // (b2, r1, c) ... etc.
-   for (size_t i = 0; i < numBearings; ++i)
-   {
-      for (size_t j = 0; j < numRanges; ++j)
-      {
-         altEntryPtr->mClutters2.Set(aClutters[i * numRanges + j], i, j);
-      }
+   ClutterTable& table = *mTablePtr;
+   AltitudeEntry entry;
+   // An entry without bearings has no clutter values; it is left empty and evaluates to zero.
+   if (! aBearings.empty())
+   {
+      entry.mRanges = table.AddAxis(aRanges);
+      entry.mBearings = table.AddAxis(aBearings);
+      // The clutters are already ordered with bearing as the outer loop:
+      // (b1, r1, c)
+      // (b1, r2, c)
+      // ...
+      // (b2, r1, c) ... etc.
+      entry.mClutterOffset = table.mValues.size();
+      table.mValues.insert(table.mValues.end(), aClutters.begin(), aClutters.end());
    }
-   mAltitudes.push_back(altEntryPtr);
+   table.mAltitudes.push_back(aAltitude);
+   table.mEntries.push_back(entry);
 }
 
 // =================================================================================================
@@ -544,15 +829,11 @@ void WsfEM_SurfaceClutterTable::AddAltitudeEntry(double               aAltitude,
                                                  std::vector<double>& aRanges,
                                                  std::vector<double>& aClutters)
 {
-   AltitudeEntry* altEntryPtr = new AltitudeEntry();
-   altEntryPtr->mAltitude = aAltitude;
-   altEntryPtr->mRanges.SetValues(aRanges);
-   size_t numRanges = altEntryPtr->mRanges.GetSize();
-
-   altEntryPtr->mClutters1.Resize(numRanges);
-   for (size_t j = 0; j < numRanges; ++j)
-   {
-      altEntryPtr->mClutters1.Set(aClutters[j], j);
-   }
-   mAltitudes.push_back(altEntryPtr);
+   ClutterTable& table = *mTablePtr;
+   AltitudeEntry entry;
+   entry.mRanges = table.AddAxis(aRanges);
+   entry.mClutterOffset = table.mValues.size();
+   table.mValues.insert(table.mValues.end(), aClutters.begin(), aClutters.end());
+   table.mAltitudes.push_back(aAltitude);
+   table.mEntries.push_back(entry);
 }
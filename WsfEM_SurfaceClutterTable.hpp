@@ -0,0 +1,143 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFEM_SURFACECLUTTERTABLE_HPP
+#define WSFEM_SURFACECLUTTERTABLE_HPP
+
+#include "wsf_export.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+class UtInput;
+#include "WsfEM_Clutter.hpp"
+class WsfEM_Interaction;
+class WsfEM_Environment;
+
+//! This class defines a clutter table as a function of altitude and range
+//!
+//! Clutter tables are used by receivers of electromagnetic radiation to determine
+//! how much noise is added to the received signal due to ground (or sea) clutter.
+//!
+//! A given clutter table object will be shared amongst all objects that utilize the table.
+//! The table data is read-only after input processing and all lookup state is held on the
+//! stack, so a single table may be evaluated concurrently from multiple threads.
+//!
+//! In addition to the text form, the table may be loaded from the binary form written by
+//! the clutter table generator ('binary_file'). The binary form is memory-mapped, so even
+//! large site-specific maps are loaded without parsing or copying the clutter data.
+class WSF_EXPORT WsfEM_SurfaceClutterTable : public WsfEM_Clutter
+{
+public:
+   enum Type
+   {
+      cUNDEFINED = 0, //<! The table type is not defined.
+      cCONSTANT,      //<! A "dummy" table filled with a predefined constant value.
+      cGENERIC,       //<! A range-elevation-clutter table with that is independent of bearing angle.
+      cSITE_SPECIFIC  //<! A table that is dependent on range, bearing, and elevation.
+   };
+
+   WsfEM_SurfaceClutterTable();
+   ~WsfEM_SurfaceClutterTable() override;
+
+   static WsfEM_Clutter* ObjectFactory(const std::string& aTypeName);
+
+   WsfEM_Clutter* Clone() const override;
+
+   bool ProcessInput(UtInput& aInput) override;
+
+   //! Return the table type.
+   Type GetType() const { return mType; }
+
+   double ComputeClutterPower(WsfEM_Interaction& aInteraction, WsfEnvironment& aEnvironment, double aProcessingFactor) override;
+
+   bool IsReentrant() const override { return true; }
+
+protected:
+   WsfEM_SurfaceClutterTable(const WsfEM_SurfaceClutterTable& aSrc);
+   WsfEM_SurfaceClutterTable& operator=(const WsfEM_SurfaceClutterTable& aRhs);
+
+private:
+   //! Convenience method for creating a clutter table when only a single value is provided.
+   void CreateConstantTable(double value);
+
+   //! Add an entry to the clutter table.
+   void AddAltitudeEntry(double               aAltitude,
+                         std::vector<double>& aRanges,
+                         std::vector<double>& aBearings,
+                         std::vector<double>& aClutters);
+
+   //! Add an entry to the clutter table.
+   void AddAltitudeEntry(double aAltitude, std::vector<double>& aRanges, std::vector<double>& aClutters);
+
+   bool Load(UtInput& aInput);
+
+   void LoadBinary(UtInput& aInput, const std::string& aFileName);
+
+   //! A set of monotonically increasing independent values, stored contiguously in the table data.
+   struct Axis
+   {
+      size_t mOffset{0};  //<! Offset of the first value in the table data
+      size_t mCount{0};   //<! Number of values
+      double mScale{0.0}; //<! (mCount - 1) / (last - first) if the values are uniformly spaced, otherwise 0
+   };
+
+   //! The result of an axis lookup (the equivalent of TblLookupLU, but kept on the stack).
+   struct AxisLookup
+   {
+      size_t mIndex{0};   //<! Index of the lower bracketing value
+      size_t mIndex1{0};  //<! Index of the upper bracketing value
+      double mRatio{0.0}; //<! Interpolation ratio between the two values
+   };
+
+   static double ComputeAxisScale(const double* aValues, size_t aCount);
+
+   static void LookupAxis(const double* aValues, size_t aCount, double aScale, double aValue, AxisLookup& aLookup);
+
+   struct AltitudeEntry
+   {
+      Axis   mRanges;           //<! Range independent values
+      Axis   mBearings;         //<! The set of bearings for which the clutter is measured
+                                //<! (empty if table type is GENERIC).
+      size_t mClutterOffset{0}; //<! Offset of the clutter values f(bearing, range), bearing-major
+   };
+
+   //! clutter table
+   class ClutterTable
+   {
+   public:
+      ClutterTable() = default;
+      ~ClutterTable();
+      ClutterTable(const ClutterTable&) = delete;
+      ClutterTable& operator=(const ClutterTable&) = delete;
+
+      Axis AddAxis(const std::vector<double>& aValues);
+
+      double Evaluate(const AltitudeEntry& aEntry, double aRange, double aBearing) const;
+
+      std::vector<double>        mAltitudes;         //<! Altitude of each entry (increasing)
+      double                     mAltitudeScale{0.0};
+      std::vector<AltitudeEntry> mEntries;
+      std::vector<double>        mValues;            //<! Table data for tables defined by text input
+      const double*              mDataPtr{nullptr};  //<! mValues or the memory-mapped table data
+      void*                      mMapPtr{nullptr};   //<! Memory-mapped binary file (if any)
+      size_t                     mMapSize{0};
+   };
+
+   std::shared_ptr<ClutterTable> mTablePtr;
+
+   Type   mType;
+   double mConstantClutter;
+};
+
+#endif
@@ -0,0 +1,159 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfEM_VisibilityCache.hpp"
+
+#include "UtInput.hpp"
+#include "UtVec3.hpp"
+
+namespace
+{
+//! The number of entries above which expired entries are removed when an entry is inserted.
+const size_t cPRUNE_SIZE = 4096;
+} // namespace
+
+// =================================================================================================
+WsfEM_VisibilityCache::WsfEM_VisibilityCache()
+   : mMaximumAge(0.0)
+   , mPositionTolerance(10.0)
+   , mEntries()
+   , mMutex()
+   , mHitCount(0)
+   , mMissCount(0)
+{
+}
+
+// =================================================================================================
+//! Copy constructor. Only the configuration is copied.
+WsfEM_VisibilityCache::WsfEM_VisibilityCache(const WsfEM_VisibilityCache& aSrc)
+   : mMaximumAge(aSrc.mMaximumAge)
+   , mPositionTolerance(aSrc.mPositionTolerance)
+   , mEntries()
+   , mMutex()
+   , mHitCount(0)
+   , mMissCount(0)
+{
+}
+
+// =================================================================================================
+//! Assignment operator. Only the configuration is copied; any cached results are discarded.
+WsfEM_VisibilityCache& WsfEM_VisibilityCache::operator=(const WsfEM_VisibilityCache& aRhs)
+{
+   if (this != &aRhs)
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mMaximumAge        = aRhs.mMaximumAge;
+      mPositionTolerance = aRhs.mPositionTolerance;
+      mEntries.clear();
+   }
+   return *this;
+}
+
+// =================================================================================================
+bool WsfEM_VisibilityCache::ProcessInput(UtInput& aInput)
+{
+   bool        myCommand = true;
+   std::string command(aInput.GetCommand());
+   if (command == "terrain_masking_cache_maximum_age")
+   {
+      aInput.ReadValueOfType(mMaximumAge, UtInput::cTIME);
+      aInput.ValueGreaterOrEqual(mMaximumAge, 0.0);
+   }
+   else if (command == "terrain_masking_cache_position_tolerance")
+   {
+      aInput.ReadValueOfType(mPositionTolerance, UtInput::cLENGTH);
+      aInput.ValueGreaterOrEqual(mPositionTolerance, 0.0);
+   }
+   else
+   {
+      myCommand = false;
+   }
+   return myCommand;
+}
+
+// =================================================================================================
+//! Find a previously computed result.
+//! @param aViewerId         The viewing antenna.
+//! @param aTargetId         The object being viewed (platform or antenna).
+//! @param aSimTime          The current simulation time.
+//! @param aViewerLocWCS     The current location of the viewer.
+//! @param aTargetLocWCS     The current location of the object being viewed.
+//! @param aEarthRadiusScale The earth radius scale factor used for the check.
+//! @param aIsVisible        [output] The cached result (valid only if the return value is true).
+//! @returns true if a valid result was found.
+bool WsfEM_VisibilityCache::Find(const ObjectId& aViewerId,
+                                 const ObjectId& aTargetId,
+                                 double          aSimTime,
+                                 const double    aViewerLocWCS[3],
+                                 const double    aTargetLocWCS[3],
+                                 double          aEarthRadiusScale,
+                                 bool&           aIsVisible)
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   auto                        iter = mEntries.find(Key(aViewerId, aTargetId));
+   if (iter != mEntries.end())
+   {
+      const Entry& entry = iter->second;
+      double       age   = aSimTime - entry.mSimTime;
+      if ((age >= 0.0) && (age <= mMaximumAge) && (entry.mEarthRadiusScale == aEarthRadiusScale) &&
+          (UtVec3d::Distance(aViewerLocWCS, entry.mViewerLocWCS) <= mPositionTolerance) &&
+          (UtVec3d::Distance(aTargetLocWCS, entry.mTargetLocWCS) <= mPositionTolerance))
+      {
+         aIsVisible = entry.mIsVisible;
+         ++mHitCount;
+         return true;
+      }
+   }
+   ++mMissCount;
+   return false;
+}
+
+// =================================================================================================
+//! Save a computed result, replacing any existing result for the same viewer and target.
+//! @see Find for the definition of the arguments.
+void WsfEM_VisibilityCache::Insert(const ObjectId& aViewerId,
+                                   const ObjectId& aTargetId,
+                                   double          aSimTime,
+                                   const double    aViewerLocWCS[3],
+                                   const double    aTargetLocWCS[3],
+                                   double          aEarthRadiusScale,
+                                   bool            aIsVisible)
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   if (mEntries.size() >= cPRUNE_SIZE)
+   {
+      RemoveExpiredEntries(aSimTime);
+   }
+
+   Entry& entry = mEntries[Key(aViewerId, aTargetId)];
+   entry.mSimTime = aSimTime;
+   UtVec3d::Set(entry.mViewerLocWCS, aViewerLocWCS);
+   UtVec3d::Set(entry.mTargetLocWCS, aTargetLocWCS);
+   entry.mEarthRadiusScale = aEarthRadiusScale;
+   entry.mIsVisible        = aIsVisible;
+}
+
+// =================================================================================================
+//! Remove the entries that can no longer be used. The caller must hold the lock.
+void WsfEM_VisibilityCache::RemoveExpiredEntries(double aSimTime)
+{
+   for (auto iter = mEntries.begin(); iter != mEntries.end();)
+   {
+      if ((aSimTime - iter->second.mSimTime) > mMaximumAge)
+      {
+         iter = mEntries.erase(iter);
+      }
+      else
+      {
+         ++iter;
+      }
+   }
+}
@@ -0,0 +1,94 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFEM_VISIBILITYCACHE_HPP
+#define WSFEM_VISIBILITYCACHE_HPP
+
+#include "wsf_export.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+class UtInput;
+#include "WsfStringId.hpp"
+
+//! A cache of terrain masking (line-of-sight) results used by WsfEM_Interaction::MaskedByTerrain.
+//!
+//! Each receiver has a cache. An entry is keyed by the viewing antenna and the object being viewed
+//! (a platform or another antenna). End points are identified by the platform index (which is never
+//! reused within a simulation) and the name of the articulated part, so an entry cannot be matched by
+//! an object that reuses the memory of a deleted one. A result is reused only if it is not older than the maximum
+//! age and neither end point has moved more than the position tolerance since the result was computed.
+//!
+//! The cache is disabled unless 'terrain_masking_cache_maximum_age' is specified.
+//! All methods may be called from multiple threads.
+class WSF_EXPORT WsfEM_VisibilityCache
+{
+public:
+   WsfEM_VisibilityCache();
+   WsfEM_VisibilityCache(const WsfEM_VisibilityCache& aSrc);
+   WsfEM_VisibilityCache& operator=(const WsfEM_VisibilityCache& aRhs);
+   ~WsfEM_VisibilityCache() = default;
+
+   //! Identifies an end point: the platform index and the name of the articulated part
+   //! (the null string ID if the end point is the platform itself).
+   using ObjectId = std::pair<size_t, WsfStringId>;
+
+   bool ProcessInput(UtInput& aInput);
+
+   //! Return true if the cache is enabled.
+   bool IsEnabled() const { return mMaximumAge > 0.0; }
+
+   bool Find(const ObjectId& aViewerId,
+             const ObjectId& aTargetId,
+             double          aSimTime,
+             const double    aViewerLocWCS[3],
+             const double    aTargetLocWCS[3],
+             double          aEarthRadiusScale,
+             bool&           aIsVisible);
+
+   void Insert(const ObjectId& aViewerId,
+               const ObjectId& aTargetId,
+               double          aSimTime,
+               const double    aViewerLocWCS[3],
+               const double    aTargetLocWCS[3],
+               double          aEarthRadiusScale,
+               bool            aIsVisible);
+
+   unsigned int GetHitCount() const { return mHitCount; }
+   unsigned int GetMissCount() const { return mMissCount; }
+
+private:
+   using Key = std::pair<ObjectId, ObjectId>;
+
+   struct Entry
+   {
+      double mSimTime;
+      double mViewerLocWCS[3];
+      double mTargetLocWCS[3];
+      double mEarthRadiusScale;
+      bool   mIsVisible;
+   };
+
+   void RemoveExpiredEntries(double aSimTime);
+
+   double mMaximumAge;        //!< seconds (0 = disabled)
+   double mPositionTolerance; //!< meters
+
+   std::map<Key, Entry> mEntries;
+   std::mutex           mMutex;
+   unsigned int         mHitCount;
+   unsigned int         mMissCount;
+};
+
+#endif
@@ -12,8 +12,13 @@
 #include "WsfElementESA_AntennaPattern.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cfloat> // for DBL_MAX
 #include <cmath>
+#include <functional>
+#include <map>
+#include <utility>
 
 #include "UtInput.hpp"
 #include "UtInputBlock.hpp"
@@ -23,8 +28,45 @@
 #include "WsfSimulation.hpp"
 #include "WsfStandardAntennaPattern.hpp"
 
+namespace
+{
+//! An entry in the element factor cache.
+struct ElementGainEntry
+{
+   size_t mCacheId{0}; //!< The pattern that computed the entry (0 if the entry is not valid)
+   double mFrequency{0.0};
+   double mAzAngle{0.0};
+   double mElAngle{0.0};
+   double mGain{0.0};
+};
+
+const size_t cELEMENT_GAIN_CACHE_SIZE = 256;
+
+//! Direct-mapped cache of element factors for repeated (pattern, frequency, azimuth, elevation) requests.
+//! There is one cache per thread so it can be used without locking.
+thread_local std::array<ElementGainEntry, cELEMENT_GAIN_CACHE_SIZE> tElementGainCache;
+
+//! The source of WsfElementESA_AntennaPattern::mCacheId (0 is never assigned).
+std::atomic<size_t> sNextCacheId(1);
+
+//! The element factors computed by GetGains for the angles of the batch being evaluated.
+//! It is owned by the GetGains call and only visible to ComputeElementGain on the same thread during that call.
+struct ElementGainBatch
+{
+   const WsfElementESA_AntennaPattern* mPatternPtr;
+   double                              mFrequency;
+   const std::vector<double>*          mAzAngles;
+   const std::vector<double>*          mElAngles;
+   const std::vector<double>*          mElementGains;
+   size_t                              mIndex; //!< The entry for the angles currently being evaluated
+};
+
+thread_local ElementGainBatch* tElementGainBatchPtr = nullptr;
+} // namespace
+
 WsfElementESA_AntennaPattern::WsfElementESA_AntennaPattern()
    : WsfESA_AntennaPattern(new EESA_Data)
+   , mCacheId(sNextCacheId++)
    , mExplicitApertureEff(false)
    , mExplicitApertureEffXY(false)
 {
@@ -81,6 +123,10 @@ bool WsfElementESA_AntennaPattern::Initialize(WsfSimulation* aSimulationPtr)
       }
    }
 
+   if (ok)
+   {
+      BuildElementNormals();
+   }
    return ok;
 }
 
@@ -114,6 +160,7 @@ bool WsfElementESA_AntennaPattern::ProcessInput(UtInput& aInput)
 
          mElements.push_back(element);
       }
+      BuildElementNormals();
    }
    else if (command == "aperture_efficiencies")
    {
@@ -138,21 +185,170 @@ bool WsfElementESA_AntennaPattern::ProcessInput(UtInput& aInput)
 
 WsfElementESA_AntennaPattern::WsfElementESA_AntennaPattern(const WsfElementESA_AntennaPattern& aSrc)
    : WsfESA_AntennaPattern(aSrc)
+   , mCacheId(sNextCacheId++)
 {
    // Base class constructor does not copy the element information
    // so it is copied here or it is lost
-   mElements = aSrc.mElements;
+   mElements    = aSrc.mElements;
+   mNormalAz    = aSrc.mNormalAz;
+   mNormalEl    = aSrc.mNormalEl;
+   mNormalCount = aSrc.mNormalCount;
 }
 
 double WsfElementESA_AntennaPattern::ComputeElementGain(double aFrequency, double aAzAngle, double aElAngle) const
 {
-   double elementGain(0.0);
+   // Use the value computed by GetGains if this call is for the angles it is currently evaluating.
+   const ElementGainBatch* batchPtr = tElementGainBatchPtr;
+   if ((batchPtr != nullptr) && (batchPtr->mPatternPtr == this) && (batchPtr->mFrequency == aFrequency) &&
+       ((*batchPtr->mAzAngles)[batchPtr->mIndex] == aAzAngle) && ((*batchPtr->mElAngles)[batchPtr->mIndex] == aElAngle))
+   {
+      return (*batchPtr->mElementGains)[batchPtr->mIndex];
+   }
+
+   // A single distinct normal (e.g. a planar array) costs one pattern evaluation, which is cheaper than the cache.
+   if (mNormalAz.size() <= 1)
+   {
+      return SumElementGains(aFrequency, aAzAngle, aElAngle) / (mNX * mNY);
+   }
+
+   size_t hash = std::hash<double>()(aFrequency);
+   hash        = (hash * 31) ^ std::hash<double>()(aAzAngle);
+   hash        = (hash * 31) ^ std::hash<double>()(aElAngle);
+   hash        = (hash * 31) ^ std::hash<size_t>()(mCacheId);
+   ElementGainEntry& entry(tElementGainCache[hash % cELEMENT_GAIN_CACHE_SIZE]);
+   if ((entry.mCacheId == mCacheId) && (entry.mFrequency == aFrequency) && (entry.mAzAngle == aAzAngle) &&
+       (entry.mElAngle == aElAngle))
+   {
+      return entry.mGain;
+   }
+
+   double elementGain = SumElementGains(aFrequency, aAzAngle, aElAngle) / (mNX * mNY);
+   entry.mCacheId     = mCacheId;
+   entry.mFrequency   = aFrequency;
+   entry.mAzAngle     = aAzAngle;
+   entry.mElAngle     = aElAngle;
+   entry.mGain        = elementGain;
+   return elementGain;
+}
+
+//! Return the antenna gains at a list of azimuth and elevation pairs (see WsfAntennaPattern::GetGains).
+//!
+//! The element factors for all of the pairs are computed first, one distinct normal at a time, into a
+//! buffer local to this call. The gains are then computed by GetGain, with ComputeElementGain taking
+//! the element factor from the buffer. The results are identical to calling GetGain for each pair.
+// virtual
+void WsfElementESA_AntennaPattern::GetGains(double                     aFrequency,
+                                            const std::vector<double>& aTargetAz,
+                                            const std::vector<double>& aTargetEl,
+                                            double                     aEBS_Az,
+                                            double                     aEBS_El,
+                                            std::vector<double>&       aGains)
+{
+   // The batch only helps if there is more than one distinct normal to evaluate.
+   if (mNormalAz.size() <= 1)
+   {
+      WsfESA_AntennaPattern::GetGains(aFrequency, aTargetAz, aTargetEl, aEBS_Az, aEBS_El, aGains);
+      return;
+   }
+
+   // WsfESA_AntennaPattern::GetGain evaluates the element gain at the target angles plus the steering angles.
+   size_t              count = aTargetAz.size();
+   std::vector<double> gainAz(count);
+   std::vector<double> gainEl(count);
+   for (size_t j = 0; j < count; ++j)
+   {
+      gainAz[j] = aTargetAz[j] + aEBS_Az;
+      gainEl[j] = aTargetEl[j] + aEBS_El;
+   }
+
+   // Accumulate in the same order as SumElementGains so the sums are the same.
+   std::vector<double> elementGains(count, 0.0);
+   for (size_t i = 0; i < mNormalAz.size(); ++i)
+   {
+      double normalAz    = mNormalAz[i];
+      double normalEl    = mNormalEl[i];
+      double normalCount = mNormalCount[i];
+      for (size_t j = 0; j < count; ++j)
+      {
+         double azAngle = gainAz[j] - normalAz;
+         double elAngle = gainEl[j] - normalEl;
+         elementGains[j] += normalCount * mSharedDataPtr->GetGain(aFrequency, azAngle, elAngle, 0.0, 0.0);
+      }
+   }
+   for (double& elementGain : elementGains)
+   {
+      elementGain /= (mNX * mNY);
+   }
+
+   ElementGainBatch  batch{this, aFrequency, &gainAz, &gainEl, &elementGains, 0};
+   ElementGainBatch* savedBatchPtr = tElementGainBatchPtr;
+   tElementGainBatchPtr            = &batch;
+   aGains.resize(count);
+   for (size_t j = 0; j < count; ++j)
+   {
+      batch.mIndex = j;
+      aGains[j]    = GetGain(aFrequency, aTargetAz[j], aTargetEl[j], aEBS_Az, aEBS_El);
+   }
+   tElementGainBatchPtr = savedBatchPtr;
+}
+
+//! Collapse the element normals into the distinct (azimuth, elevation) pairs and the number of
+//! elements that share each pair. The element pattern only depends on the normal, so the element
+//! gain sum needs one pattern evaluation per distinct normal rather than one per element.
+// private
+void WsfElementESA_AntennaPattern::BuildElementNormals()
+{
+   mNormalAz.clear();
+   mNormalEl.clear();
+   mNormalCount.clear();
+
+   std::map<std::pair<double, double>, size_t> normalIndex;
    for (const auto& elem : mElements)
    {
-      elementGain += mSharedDataPtr->GetGain(aFrequency, aAzAngle - elem.mNormal[0], aElAngle - elem.mNormal[1], 0.0, 0.0);
+      auto normal = std::make_pair(elem.mNormal[0], elem.mNormal[1]);
+      auto iter   = normalIndex.find(normal);
+      if (iter == normalIndex.end())
+      {
+         normalIndex.emplace(normal, mNormalAz.size());
+         mNormalAz.push_back(normal.first);
+         mNormalEl.push_back(normal.second);
+         mNormalCount.push_back(1.0);
+      }
+      else
+      {
+         mNormalCount[iter->second] += 1.0;
+      }
    }
-   elementGain /= (mNX * mNY);
 
+   // Invalidate the entries computed with the previous normals.
+   mCacheId = sNextCacheId++;
+}
+
+//! Return the sum of the element pattern gains over all elements (not normalized by the element count).
+// private
+double WsfElementESA_AntennaPattern::SumElementGains(double aFrequency, double aAzAngle, double aElAngle) const
+{
+   double elementGain(0.0);
+   if (mNormalAz.empty())
+   {
+      // Normals have not been built (pattern not yet initialized).
+      for (const auto& elem : mElements)
+      {
+         elementGain +=
+            mSharedDataPtr->GetGain(aFrequency, aAzAngle - elem.mNormal[0], aElAngle - elem.mNormal[1], 0.0, 0.0);
+      }
+      return elementGain;
+   }
+
+   const double* normalAz    = mNormalAz.data();
+   const double* normalEl    = mNormalEl.data();
+   const double* normalCount = mNormalCount.data();
+   size_t        numNormals  = mNormalAz.size();
+   for (size_t i = 0; i < numNormals; ++i)
+   {
+      elementGain +=
+         normalCount[i] * mSharedDataPtr->GetGain(aFrequency, aAzAngle - normalAz[i], aElAngle - normalEl[i], 0.0, 0.0);
+   }
    return elementGain;
 }
 
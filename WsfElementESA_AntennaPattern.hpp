@@ -12,6 +12,7 @@
 #ifndef WSFELEMENTESA_ANTENNAPATTERN_HPP
 #define WSFELEMENTESA_ANTENNAPATTERN_HPP
 
+#include <cstddef>
 #include <vector>
 
 class UtInput;
@@ -53,6 +54,12 @@ public:
 
    bool ProcessInput(UtInput& aInput) override;
 
+   void GetGains(double                     aFrequency,
+                 const std::vector<double>& aTargetAz,
+                 const std::vector<double>& aTargetEl,
+                 double                     aEBS_Az,
+                 double                     aEBS_El,
+                 std::vector<double>&       aGains) override;
 
 protected:
    WsfElementESA_AntennaPattern(const WsfElementESA_AntennaPattern& aSrc);
@@ -69,6 +76,21 @@ protected:
 private:
    double ComputeApertureEfficiency() override;
 
+   void BuildElementNormals();
+
+   double SumElementGains(double aFrequency, double aAzAngle, double aElAngle) const;
+
+   //! @name Distinct element normals (stored contiguously) and the number of elements sharing each one.
+   //@{
+   std::vector<double> mNormalAz;
+   std::vector<double> mNormalEl;
+   std::vector<double> mNormalCount;
+   //@}
+
+   //! Identifies this pattern (and its current element normals) in the per-thread element factor cache.
+   //! A new value is assigned whenever the normals change, which invalidates the cached entries.
+   size_t mCacheId;
+
    bool mExplicitApertureEff;
    bool mExplicitApertureEffXY;
 };
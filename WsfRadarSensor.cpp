@@ -41,6 +41,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
+#include <thread>
 
 #include "UtCast.hpp"
 #include "UtInput.hpp"
@@ -54,8 +56,11 @@
 #include "UtWallClock.hpp"
 #include "WsfDefaultSensorScheduler.hpp"
 #include "WsfDefaultSensorTracker.hpp"
+#include "WsfEM_Attenuation.hpp"
 #include "WsfEM_Clutter.hpp"
 #include "WsfEM_ClutterTypes.hpp"
+#include "WsfEM_InteractionBatch.hpp"
+#include "WsfEM_Propagation.hpp"
 #include "WsfEnvironment.hpp"
 #include "WsfPlatform.hpp"
 #include "WsfRadarSensorErrorModel.hpp"
@@ -64,6 +69,7 @@
 #include "WsfSensorComponent.hpp"
 #include "WsfSensorModeList.hpp"
 #include "WsfSensorObserver.hpp"
+#include "WsfSensorThreadPool.hpp"
 #include "WsfSimulation.hpp"
 #include "WsfSimulationInput.hpp"
 #include "WsfStandardSensorErrorModel.hpp"
@@ -75,8 +81,73 @@ using std::string;
 namespace
 {
 string sLastImplicitBeamCommand;
+
+//! Return a non-empty reason if the specified propagation, attenuation or clutter model is present
+//! and is not reentrant.
+template<typename MODEL>
+string CheckModelReentrant(const MODEL* aModelPtr, const string& aModelType, const string& aModeName)
+{
+   string reason;
+   if ((aModelPtr != nullptr) && (! aModelPtr->IsNullModel()) && (! aModelPtr->IsReentrant()))
+   {
+      reason = "the " + aModelType + " model of mode " + aModeName + " is not reentrant";
+   }
+   return reason;
+}
 }
 
+// =================================================================================================
+//! The storage for a batch of detection attempts that are to be evaluated on the simulation's
+//! WsfSensorThreadPool. Entries are reused from frame to frame to avoid reallocating results.
+class WsfRadarSensor::DetectionBatch
+{
+   public:
+
+      //! A detection attempt that has been selected by the scheduler and is waiting to be evaluated.
+      struct Attempt
+      {
+         size_t                       mTargetIndex;
+         WsfTrackId                   mRequestId;
+         Settings                     mSettings;
+         WsfPlatform*                 mTargetPtr;
+         RadarMode*                   mModePtr;
+         bool                         mWithinRange;
+         bool                         mEvaluate;
+         WsfSensorResult              mResult;
+         std::vector<WsfSensorResult> mBeamResults;
+         size_t                       mBestBeamIndex;
+      };
+
+      //! Return a new (or reused) entry at the end of the batch.
+      Attempt& AddAttempt()
+      {
+         if (mBatchSize == mBatch.size())
+         {
+            mBatch.emplace_back();
+         }
+         return mBatch[mBatchSize++];
+      }
+
+      Attempt& GetAttempt(size_t aIndex) { return mBatch[aIndex]; }
+      size_t GetBatchSize() const        { return mBatchSize; }
+      void ClearBatch()                  { mBatchSize = 0; }
+
+      //! The limit checks of the attempts of a single-beam mode, and the attempts they belong to.
+      WsfEM_InteractionBatch& GetInteractionBatch()     { return mInteractionBatch; }
+      std::vector<size_t>&    GetInteractionAttempts()  { return mInteractionAttempts; }
+
+      //! The attempts whose physics are evaluated concurrently.
+      std::vector<size_t>&    GetConcurrentAttempts()   { return mConcurrentAttempts; }
+
+   private:
+
+      std::vector<Attempt>   mBatch;
+      size_t                 mBatchSize{0};
+      WsfEM_InteractionBatch mInteractionBatch;
+      std::vector<size_t>    mInteractionAttempts;
+      std::vector<size_t>    mConcurrentAttempts;
+};
+
 // =================================================================================================
 WsfRadarSensor::WsfRadarSensor(WsfScenario& aScenario)
    : WsfSensor(aScenario),
@@ -85,7 +156,11 @@ WsfRadarSensor::WsfRadarSensor(WsfScenario& aScenario)
      mRcvrList(),
      mAnyModeCanTransmit(true),
      mAnyModeCanReceive(true),
-     mTempGeometryPtr(nullptr)
+     mTempGeometryPtr(nullptr),
+     mParallelDetectionAttempts(false),
+     mParallelDetectionThreadCount(0),
+     mDetectionBatchPtr(),
+     mThreadPoolPtr(nullptr)
 {
 	//ΪƵ
    SetClass(cACTIVE | cRADIO);         // This is an active RF sensor.
@@ -107,7 +182,17 @@ WsfRadarSensor::WsfRadarSensor(const WsfRadarSensor& aSrc)
      mRcvrList(),
      mAnyModeCanTransmit(aSrc.mAnyModeCanTransmit),
      mAnyModeCanReceive(aSrc.mAnyModeCanReceive),
-     mTempGeometryPtr(nullptr)
+     mTempGeometryPtr(nullptr),
+     mParallelDetectionAttempts(aSrc.mParallelDetectionAttempts),
+     mParallelDetectionThreadCount(aSrc.mParallelDetectionThreadCount),
+     mDetectionBatchPtr(),
+     mThreadPoolPtr(nullptr)
+{
+}
+
+// =================================================================================================
+// Defined here because DetectionBatch is incomplete in the header.
+WsfRadarSensor::~WsfRadarSensor()
 {
 }
 
@@ -295,6 +380,25 @@ bool WsfRadarSensor::Initialize(double aSimTime)
       mAnyModeCanTransmit |= modePtr->mCanTransmit;
       mAnyModeCanReceive  |= modePtr->mCanReceive;
    }
+   if (mParallelDetectionAttempts)
+   {
+      if (CheckParallelDetectionSupport())
+      {
+         unsigned int threadCount = mParallelDetectionThreadCount;
+         if (threadCount == 0)
+         {
+            threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+         }
+         mDetectionBatchPtr = ut::make_unique<DetectionBatch>();
+         mThreadPoolPtr     = &WsfSensorThreadPool::FindOrCreate(*GetSimulation());
+         mThreadPoolPtr->Reserve(threadCount);
+      }
+      else
+      {
+         ok = false;
+      }
+   }
+
    if (! mAnyModeCanTransmit)
    {
       SetClass(cSEMI_ACTIVE | cRADIO);      // ɷ䣬Ϊ״
@@ -315,11 +419,43 @@ void WsfRadarSensor::PlatformAdded(double       aSimTime,
    }
 }
 
+// =================================================================================================
+//virtual
+void WsfRadarSensor::PlatformDeleted(WsfPlatform* aPlatformPtr)
+{
+   // Discard the bistatic links to any transmitter on the deleted platform (see WsfEM_Interaction::BeginBistaticLink).
+   for (RadarMode* modePtr : mRadarModeList)
+   {
+      for (RadarBeam* beamPtr : modePtr->mBeamList)
+      {
+         beamPtr->mRcvrPtr->GetBistaticLinkCache().RemovePlatform(aPlatformPtr->GetIndex());
+      }
+   }
+   WsfSensor::PlatformDeleted(aPlatformPtr);
+}
+
 // =================================================================================================
 //virtualû෽
 bool WsfRadarSensor::ProcessInput(UtInput& aInput)
 {
-   return WsfSensor::ProcessInput(aInput);
+   bool myCommand = true;
+   std::string command(aInput.GetCommand());
+   if (command == "parallel_detection_attempts")
+   {
+      aInput.ReadValue(mParallelDetectionAttempts);
+   }
+   else if (command == "parallel_detection_thread_count")
+   {
+      int threadCount;
+      aInput.ReadValue(threadCount);
+      aInput.ValueGreaterOrEqual(threadCount, 0);
+      mParallelDetectionThreadCount = static_cast<unsigned int>(threadCount);
+   }
+   else
+   {
+      myCommand = WsfSensor::ProcessInput(aInput);
+   }
+   return myCommand;
 }
 
 // =================================================================================================
@@ -356,102 +492,398 @@ void WsfRadarSensor::PerformScheduledDetections(double aSimTime)
    // Let components do their thing...
    WsfSensorComponent::PrePerformScheduledDetections(*this, aSimTime);
 
+   if (mDetectionBatchPtr != nullptr)
+   {
+      PerformBatchedDetections(aSimTime);
+   }
+   else
+   {
+      WsfTrackId requestId;
+      Settings settings;
+      WsfSensorResult result;
+      WsfSensorTracker::Settings stSettings;
+      size_t targetIndex = 0;
+
+      while (mSchedulerPtr->SelectTarget(aSimTime, mNextUpdateTime, targetIndex, requestId, settings))
+      {
+         if (ProcessTargetSelection(aSimTime, targetIndex, requestId, settings, result, stSettings))
+         {
+            WsfArticulatedPart::ClearTransientCue();      // Release any transient cue created by the scheduler.
+         }
+      }  // while (mSchedulerPtr->SelectTarget())
+   }
+
+   // Let components do their thing...
+   WsfSensorComponent::PostPerformScheduledDetections(*this, aSimTime);
+
+   // Set the update interval so the schedule is called at the desired time.
+   double updateInterval = std::max(mNextUpdateTime - aSimTime, 1.0E-5);
+   SetUpdateInterval(updateInterval);
+}
+
+// =================================================================================================
+//! Perform the detection processing for a single target selected by the scheduler.
+//!
+//! @param aSimTime         The current simulation time.
+//! @param aTargetIndex     The index of the selected target.
+//! @param aRequestId       The request ID returned by the scheduler.
+//! @param aSettings        The settings returned by the scheduler.
+//! @param aResult          Storage for the result of the detection attempt.
+//! @param aTrackerSettings The settings passed to the tracker.
+//! @returns false if the selection was skipped (it was a false target).
+bool WsfRadarSensor::ProcessTargetSelection(double                      aSimTime,
+                                            size_t                      aTargetIndex,
+                                            WsfTrackId&                 aRequestId,
+                                            Settings&                   aSettings,
+                                            WsfSensorResult&            aResult,
+                                            WsfSensorTracker::Settings& aTrackerSettings)
+{
+   WsfSensorMode* modePtr = mRadarModeList[aSettings.mModeIndex];
+   assert(modePtr != nullptr);
+
+   // Perform the sensing chance if the target still exists.
+   WsfPlatform* targetPtr = GetSimulation()->GetPlatformByIndex(aTargetIndex);
+   if (targetPtr != nullptr)
+   {
+      if (targetPtr->IsFalseTarget())
+      {
+         return false;
+      }
+
+      aSettings.mRequiredPd = GetRequiredPd(modePtr);
+      if (modePtr->WithinDetectionRange(aSimTime, targetPtr))
+      {
+         if (AttemptToDetect(aSimTime, targetPtr, aSettings, aResult))
+         {
+            // Apply errors and indicate target is detected
+            modePtr->ApplyMeasurementErrors(aResult);
+            mTrackerPtr->TargetDetected(aSimTime, aTrackerSettings, aRequestId, aTargetIndex, targetPtr, aResult);
+         }
+         else
+         {
+            mTrackerPtr->TargetUndetected(aSimTime, aTrackerSettings, aRequestId, aTargetIndex, targetPtr, aResult);
+         }
+         NotifyTargetUpdated(aSimTime, targetPtr, aResult);
+      }
+      else
+      {
+         // Detection chance was culled because it is out of range. We must still report to the tracker
+         // because it possible it may be coasting the target.
+         aResult.Reset();
+         aResult.mModeIndex     = aSettings.mModeIndex;
+         aResult.mCheckedStatus = WsfSensorResult::cRCVR_RANGE_LIMITS;
+         aResult.mFailedStatus  = WsfSensorResult::cRCVR_RANGE_LIMITS;
+         mTrackerPtr->TargetUndetected(aSimTime, aTrackerSettings, aRequestId, aTargetIndex, targetPtr, aResult);
+      }
+   }
+   else if (TransientCueActive() && (aTargetIndex == 0))
+   {
+      if (mTempGeometryPtr == nullptr)
+      {
+         mTempGeometryPtr = new WsfPlatform(GetScenario());
+      }
+
+      double locationWCS[3];
+      GetTransientCuedLocationWCS(locationWCS);
+      mTempGeometryPtr->SetLocationWCS(locationWCS);
+
+      aSettings.mRequiredPd = GetRequiredPd(modePtr);
+      if (modePtr->WithinDetectionRange(aSimTime, mTempGeometryPtr))
+      {
+         for (unsigned int xmtrIndex = 0; xmtrIndex < GetEM_XmtrCount(); ++xmtrIndex)
+         {
+            if (DebugEnabled())
+            {
+               auto out = ut::log::debug() << "Radar sensor cueing to local track.";
+               out.AddNote() << "T = " << aSimTime;
+               out.AddNote() << "Platform: " << GetPlatform()->GetName();
+               out.AddNote() << "Sensor: " << GetName();
+               out.AddNote() << "Track #: " << aRequestId.GetLocalTrackNumber();
+            }
+            aResult.Reset(aSettings);
+            UpdatePosition(aSimTime);             // Ensure position is current
+            aResult.BeginGenericInteraction(&GetEM_Xmtr(xmtrIndex), mTempGeometryPtr, GetEM_Xmtr(xmtrIndex).GetLinkedReceiver());
+            aResult.ComputeUndefinedGeometry();
+            aResult.SetTransmitterBeamPosition();
+            if (aResult.GetTransmitter() != nullptr)
+            {
+               aResult.GetTransmitter()->NotifyListeners(aSimTime, aResult);    // Notify listeners for possible passive detection
+            }
+         }
+      }
+   }
+   else if (mTrackerPtr->TargetDeleted(aSimTime, aTrackerSettings, aRequestId, aTargetIndex))
+   {
+      // Target no longer physically exists and is not being tracked.
+      mSchedulerPtr->RemoveTarget(aSimTime, aTargetIndex);
+   }
+   return true;
+}
+
+// =================================================================================================
+//! Process the scheduled detection attempts as a batch.
+//!
+//! All of the target selections that are due at the current time are drained from the scheduler.
+//! The physics of the detection attempts (RadarMode::EvaluateDetectionAttempt) are evaluated
+//! concurrently, and the results are then applied to the tracker and observers serially, in the order
+//! in which the scheduler selected the targets. The results are therefore independent of the number
+//! of threads.
+//!
+//! Selections that cannot be batched (those for which the scheduler created a transient cue and those
+//! for targets that no longer exist) are processed serially after the pending batch is completed.
+//! The pending batch is evaluated without the cue because its attempts were selected before the cue existed.
+//!
+//! @note The propagation, attenuation, clutter and signal processing models of the sensor are invoked
+//! concurrently for different targets. CheckParallelDetectionSupport ensures they are reentrant.
+//! @param aSimTime The current simulation time.
+void WsfRadarSensor::PerformBatchedDetections(double aSimTime)
+{
    WsfTrackId requestId;
    Settings settings;
    WsfSensorResult result;
    WsfSensorTracker::Settings stSettings;
    size_t targetIndex = 0;
 
+   DetectionBatch& batch = *mDetectionBatchPtr;
+   batch.ClearBatch();
    while (mSchedulerPtr->SelectTarget(aSimTime, mNextUpdateTime, targetIndex, requestId, settings))
    {
-      WsfSensorMode* modePtr = mRadarModeList[settings.mModeIndex];
-      assert(modePtr != nullptr);
-
-      // Perform the sensing chance if the target still exists.
       WsfPlatform* targetPtr = GetSimulation()->GetPlatformByIndex(targetIndex);
-      if (targetPtr != nullptr)
+      if ((targetPtr != nullptr) && (! TransientCueActive()))
+      {
+         if (! targetPtr->IsFalseTarget())
+         {
+            DetectionBatch::Attempt& attempt = batch.AddAttempt();
+            attempt.mTargetIndex = targetIndex;
+            attempt.mRequestId   = requestId;
+            attempt.mSettings    = settings;
+            attempt.mTargetPtr   = targetPtr;
+         }
+      }
+      else
       {
-         if (targetPtr->IsFalseTarget())
+         // The scheduler has already cued the sensor for this selection. The pending attempts were
+         // selected without a cue, so the cue is withdrawn while they are evaluated.
+         if (TransientCueActive() && (batch.GetBatchSize() != 0))
          {
-            continue;
+            double cuedLocWCS[3];
+            GetTransientCuedLocationWCS(cuedLocWCS);
+            WsfArticulatedPart::ClearTransientCue();
+            EvaluateDetectionBatch(aSimTime);
+            SetTransientCuedLocationWCS(cuedLocWCS);
          }
+         else
+         {
+            EvaluateDetectionBatch(aSimTime);
+         }
+         if (ProcessTargetSelection(aSimTime, targetIndex, requestId, settings, result, stSettings))
+         {
+            WsfArticulatedPart::ClearTransientCue();      // Release any transient cue created by the scheduler.
+         }
+      }
+   }  // while (mSchedulerPtr->SelectTarget())
+   EvaluateDetectionBatch(aSimTime);
+}
 
-         settings.mRequiredPd = GetRequiredPd(modePtr);
-         if (modePtr->WithinDetectionRange(aSimTime, targetPtr))
+// =================================================================================================
+//! Evaluate the pending batch of detection attempts and apply the results.
+//! @param aSimTime The current simulation time.
+void WsfRadarSensor::EvaluateDetectionBatch(double aSimTime)
+{
+   DetectionBatch& batch = *mDetectionBatchPtr;
+   size_t batchSize = batch.GetBatchSize();
+   if (batchSize == 0)
+   {
+      return;
+   }
+
+   // Serial: bring the sensor and targets up to date and perform the range check.
+   // This is the same processing as WsfSensor::AttemptToDetect, split so the physics can be done concurrently.
+   for (size_t i = 0; i < batchSize; ++i)
+   {
+      DetectionBatch::Attempt& attempt = batch.GetAttempt(i);
+      attempt.mModePtr = mRadarModeList[attempt.mSettings.mModeIndex];
+      assert(attempt.mModePtr != nullptr);
+      attempt.mSettings.mRequiredPd = GetRequiredPd(attempt.mModePtr);
+      attempt.mWithinRange   = attempt.mModePtr->WithinDetectionRange(aSimTime, attempt.mTargetPtr);
+      attempt.mEvaluate      = false;
+      attempt.mBestBeamIndex = 0;
+      if (attempt.mWithinRange)
+      {
+         attempt.mEvaluate = attempt.mModePtr->PrepareDetectionAttempt(aSimTime, attempt.mTargetPtr, attempt.mSettings, attempt.mResult);
+      }
+   }
+
+   // Serial: update the lazily computed antenna and platform state that the physics reads, so the
+   // concurrent evaluations below only read it.
+   for (RadarMode* modePtr : mRadarModeList)
+   {
+      for (RadarBeam* beamPtr : modePtr->mBeamList)
+      {
+         beamPtr->mAntennaPtr->UpdateCachedState();
+      }
+   }
+   double lat;
+   double lon;
+   double alt;
+   GetPlatform()->GetLocationLLA(lat, lon, alt);
+   for (size_t i = 0; i < batchSize; ++i)
+   {
+      batch.GetAttempt(i).mTargetPtr->GetLocationLLA(lat, lon, alt);
+   }
+
+   // Serial: check the attempts of each single-beam mode against the range, altitude and angle limits of the
+   // beam, all targets at once. The attempts that fail are evaluated here. They fail early in
+   // WsfEM_Interaction::BeginTwoWayInteraction, which also determines the failed status that is reported.
+   // Only the remaining attempts, which need the full physics, are given to the thread pool.
+   std::vector<size_t>& concurrentAttempts = batch.GetConcurrentAttempts();
+   concurrentAttempts.clear();
+   for (RadarMode* modePtr : mRadarModeList)
+   {
+      RadarBeam* beamPtr = (modePtr->mBeamList.size() == 1) ? modePtr->mBeamList[0] : nullptr;
+      WsfEM_InteractionBatch& interactions = batch.GetInteractionBatch();
+      std::vector<size_t>& interactionAttempts = batch.GetInteractionAttempts();
+      interactions.Clear();
+      interactionAttempts.clear();
+      for (size_t i = 0; i < batchSize; ++i)
+      {
+         DetectionBatch::Attempt& attempt = batch.GetAttempt(i);
+         if (attempt.mEvaluate && (attempt.mModePtr == modePtr))
          {
-            if (AttemptToDetect(aSimTime, targetPtr, settings, result))
+            if (beamPtr != nullptr)
             {
-               // Apply errors and indicate target is detected
-               modePtr->ApplyMeasurementErrors(result);
-               mTrackerPtr->TargetDetected(aSimTime, stSettings, requestId, targetIndex, targetPtr, result);
+               interactions.AddTarget(attempt.mTargetPtr);
+               interactionAttempts.push_back(i);
             }
             else
             {
-               mTrackerPtr->TargetUndetected(aSimTime, stSettings, requestId, targetIndex, targetPtr, result);
+               concurrentAttempts.push_back(i);
             }
-            NotifyTargetUpdated(aSimTime, targetPtr, result);
-         }
-         else
-         {
-            // Detection chance was culled because it is out of range. We must still report to the tracker
-            // because it possible it may be coasting the target.
-            result.Reset();
-            result.mModeIndex     = settings.mModeIndex;
-            result.mCheckedStatus = WsfSensorResult::cRCVR_RANGE_LIMITS;
-            result.mFailedStatus  = WsfSensorResult::cRCVR_RANGE_LIMITS;
-            mTrackerPtr->TargetUndetected(aSimTime, stSettings, requestId, targetIndex, targetPtr, result);
          }
       }
-      else if (TransientCueActive() && (targetIndex == 0))
+      if (! interactionAttempts.empty())
       {
-         if (mTempGeometryPtr == nullptr)
+         interactions.Evaluate(beamPtr->GetEM_Xmtr(), beamPtr->GetEM_Rcvr());
+         for (size_t j = 0; j < interactionAttempts.size(); ++j)
          {
-            mTempGeometryPtr = new WsfPlatform(GetScenario());
+            if (interactions.GetFailedStatus(j) == 0)
+            {
+               concurrentAttempts.push_back(interactionAttempts[j]);
+            }
+            else
+            {
+               DetectionBatch::Attempt& attempt = batch.GetAttempt(interactionAttempts[j]);
+               modePtr->EvaluateDetectionAttempt(aSimTime, attempt.mTargetPtr, attempt.mSettings, attempt.mResult,
+                                                 attempt.mBeamResults, attempt.mBestBeamIndex);
+            }
          }
+      }
+   }
 
-         double locationWCS[3];
-         GetTransientCuedLocationWCS(locationWCS);
-         mTempGeometryPtr->SetLocationWCS(locationWCS);
+   // Concurrent: the physics.
+   mThreadPoolPtr->Execute(concurrentAttempts.size(), [&batch, &concurrentAttempts, aSimTime](size_t aIndex)
+   {
+      DetectionBatch::Attempt& attempt = batch.GetAttempt(concurrentAttempts[aIndex]);
+      attempt.mModePtr->EvaluateDetectionAttempt(aSimTime, attempt.mTargetPtr, attempt.mSettings, attempt.mResult,
+                                                 attempt.mBeamResults, attempt.mBestBeamIndex);
+   });
 
-         settings.mRequiredPd = GetRequiredPd(modePtr);
-         if (modePtr->WithinDetectionRange(aSimTime, mTempGeometryPtr))
+   // Serial: notify observers and the tracker in the order in which the targets were selected.
+   WsfSensorTracker::Settings stSettings;
+   for (size_t i = 0; i < batchSize; ++i)
+   {
+      DetectionBatch::Attempt& attempt = batch.GetAttempt(i);
+      WsfSensorResult& result = attempt.mResult;
+      if (attempt.mWithinRange)
+      {
+         if (attempt.mModePtr->ApplyDetectionAttempt(aSimTime, attempt.mTargetPtr, attempt.mEvaluate, result,
+                                                     attempt.mBeamResults, attempt.mBestBeamIndex))
          {
-            for (unsigned int xmtrIndex = 0; xmtrIndex < GetEM_XmtrCount(); ++xmtrIndex)
-            {
-               if (DebugEnabled())
-               {
-                  auto out = ut::log::debug() << "Radar sensor cueing to local track.";
-                  out.AddNote() << "T = " << aSimTime;
-                  out.AddNote() << "Platform: " << GetPlatform()->GetName();
-                  out.AddNote() << "Sensor: " << GetName();
-                  out.AddNote() << "Track #: " << requestId.GetLocalTrackNumber();
-               }
-               result.Reset(settings);
-               UpdatePosition(aSimTime);             // Ensure position is current
-               result.BeginGenericInteraction(&GetEM_Xmtr(xmtrIndex), mTempGeometryPtr, GetEM_Xmtr(xmtrIndex).GetLinkedReceiver());
-               result.ComputeUndefinedGeometry();
-               result.SetTransmitterBeamPosition();
-               if (result.GetTransmitter() != nullptr)
-               {
-                  result.GetTransmitter()->NotifyListeners(aSimTime, result);    // Notify listeners for possible passive detection
-               }
-            }
+            // Apply errors and indicate target is detected
+            attempt.mModePtr->ApplyMeasurementErrors(result);
+            mTrackerPtr->TargetDetected(aSimTime, stSettings, attempt.mRequestId, attempt.mTargetIndex, attempt.mTargetPtr, result);
          }
+         else
+         {
+            mTrackerPtr->TargetUndetected(aSimTime, stSettings, attempt.mRequestId, attempt.mTargetIndex, attempt.mTargetPtr, result);
+         }
+         NotifyTargetUpdated(aSimTime, attempt.mTargetPtr, result);
       }
-      else if (mTrackerPtr->TargetDeleted(aSimTime, stSettings, requestId, targetIndex))
+      else
       {
-         // Target no longer physically exists and is not being tracked.
-         mSchedulerPtr->RemoveTarget(aSimTime, targetIndex);
+         // Detection chance was culled because it is out of range. We must still report to the tracker
+         // because it possible it may be coasting the target.
+         result.Reset();
+         result.mModeIndex     = attempt.mSettings.mModeIndex;
+         result.mCheckedStatus = WsfSensorResult::cRCVR_RANGE_LIMITS;
+         result.mFailedStatus  = WsfSensorResult::cRCVR_RANGE_LIMITS;
+         mTrackerPtr->TargetUndetected(aSimTime, stSettings, attempt.mRequestId, attempt.mTargetIndex, attempt.mTargetPtr, result);
       }
-      WsfArticulatedPart::ClearTransientCue();      // Release any transient cue created by the scheduler.
-   }  // while (mSchedulerPtr->SelectTarget())
+   }
+   batch.ClearBatch();
+}
 
-   // Let components do their thing...
-   WsfSensorComponent::PostPerformScheduledDetections(*this, aSimTime);
+// =================================================================================================
+//! Determine if the detection attempts of the sensor may be evaluated concurrently.
+//!
+//! Every model that is invoked during the physics of a detection attempt must declare itself reentrant.
+//! Models that keep per-call state in member variables (e.g.: ALARM clutter and propagation) do not,
+//! and neither do sensor components (which have no means to declare it). Receive-only modes are not
+//! supported because the transmitters of other platforms cannot be checked.
+//! @returns true if the sensor supports parallel detection attempts. An error is logged if not.
+bool WsfRadarSensor::CheckParallelDetectionSupport()
+{
+   string reason;
+   for (auto* componentPtr : GetComponents())
+   {
+      reason = "sensor component " + componentPtr->GetComponentName().GetString() + " is attached";
+      break;
+   }
+   for (size_t modeIndex = 0; (modeIndex < mRadarModeList.size()) && reason.empty(); ++modeIndex)
+   {
+      RadarMode* modePtr = mRadarModeList[modeIndex];
+      if (! modePtr->mCanTransmit)
+      {
+         reason = "mode " + modePtr->GetName() + " does not transmit";
+      }
+      for (size_t beamIndex = 0; (beamIndex < modePtr->mBeamList.size()) && reason.empty(); ++beamIndex)
+      {
+         RadarBeam* beamPtr = modePtr->mBeamList[beamIndex];
+         WsfEM_Xmtr& xmtr   = beamPtr->GetEM_Xmtr();
+         WsfEM_Rcvr& rcvr   = beamPtr->GetEM_Rcvr();
+         reason = CheckModelReentrant(xmtr.GetPropagationModel(), "propagation", modePtr->GetName());
+         if (reason.empty())
+         {
+            reason = CheckModelReentrant(xmtr.GetAttenuationModel(), "attenuation", modePtr->GetName());
+         }
+         if (reason.empty() && modePtr->mCanReceive)
+         {
+            reason = CheckModelReentrant(rcvr.GetPropagationModel(), "propagation", modePtr->GetName());
+         }
+         if (reason.empty() && modePtr->mCanReceive)
+         {
+            reason = CheckModelReentrant(rcvr.GetAttenuationModel(), "attenuation", modePtr->GetName());
+         }
+         if (reason.empty())
+         {
+            reason = CheckModelReentrant(beamPtr->GetClutter(), "clutter", modePtr->GetName());
+         }
+         if (reason.empty() && (! beamPtr->GetSignalProcessors().IsReentrant()))
+         {
+            reason = "a signal processor of mode " + modePtr->GetName() + " is not reentrant";
+         }
+      }
+   }
 
-   // Set the update interval so the schedule is called at the desired time.
-   double updateInterval = std::max(mNextUpdateTime - aSimTime, 1.0E-5);
-   SetUpdateInterval(updateInterval);
+   if (! reason.empty())
+   {
+      auto out = ut::log::error() << "parallel_detection_attempts cannot be used by the sensor.";
+      out.AddNote() << "Platform: " << GetPlatform()->GetName();
+      out.AddNote() << "Sensor: " << GetName();
+      out.AddNote() << "Reason: " << reason;
+      return false;
+   }
+   return true;
 }
 
 // =================================================================================================
@@ -1595,12 +2027,29 @@ bool WsfRadarSensor::RadarMode::AttemptToDetect(double           aSimTime,
                                                 Settings&        aSettings,
                                                 WsfSensorResult& aResult)
 {
-   bool detected = false;
+   size_t bestBeamIndex = 0;
+   bool evaluate = PrepareDetectionAttempt(aSimTime, aTargetPtr, aSettings, aResult);
+   if (evaluate)
+   {
+      EvaluateDetectionAttempt(aSimTime, aTargetPtr, aSettings, aResult, mBeamResults, bestBeamIndex);
+   }
+   return ApplyDetectionAttempt(aSimTime, aTargetPtr, evaluate, aResult, mBeamResults, bestBeamIndex);
+}
+
+// =================================================================================================
+//! Prepare for a detection attempt.
+//! The sensor and target positions are brought up to date and the result is initialized.
+//! @returns true if EvaluateDetectionAttempt must be called to perform the detection physics.
+bool WsfRadarSensor::RadarMode::PrepareDetectionAttempt(double           aSimTime,
+                                                        WsfPlatform*     aTargetPtr,
+                                                        Settings&        aSettings,
+                                                        WsfSensorResult& aResult)
+{
    aResult.Reset(aSettings);
    aResult.SetCategory(GetSensor()->GetZoneAttenuationModifier());
    GetSensor()->UpdatePosition(aSimTime);             // Ensure my position is current
    aTargetPtr->Update(aSimTime);                      // Ensure the target position is current
-   
+
    if (GetSensor()->DebugEnabled())
    {
       auto out = ut::log::debug() << "Radar sensor attempting to detect target.";
@@ -1611,39 +2060,132 @@ bool WsfRadarSensor::RadarMode::AttemptToDetect(double           aSimTime,
       out.AddNote() << "Target: " << aTargetPtr->GetName();
    }
 
-   // Determine which beam returns the best results...
-   if (!mCanReceive &&  mCanTransmit)
+   // TRANSMITTER only modes do not perform detection processing.
+   return (mCanReceive || (! mCanTransmit)) && (aResult.mFailedStatus == 0);
+}
+
+// =================================================================================================
+//! Perform the physics of a detection attempt.
+//! Each beam attempts to detect the target. No observers are notified, so this may be called
+//! concurrently for different targets provided each call is given its own result storage.
+//! @param aSimTime       The current simulation time.
+//! @param aTargetPtr     The target being detected.
+//! @param aSettings      The settings for the detection attempt.
+//! @param aResult        [updated] The result for the first beam.
+//! @param aBeamResults   [output] The results for the second and subsequent beams.
+//! @param aBestBeamIndex [output] The index of the beam with the best signal-to-noise.
+void WsfRadarSensor::RadarMode::EvaluateDetectionAttempt(double                        aSimTime,
+                                                         WsfPlatform*                  aTargetPtr,
+                                                         Settings&                     aSettings,
+                                                         WsfSensorResult&              aResult,
+                                                         std::vector<WsfSensorResult>& aBeamResults,
+                                                         size_t&                       aBestBeamIndex)
+{
+   aBestBeamIndex = 0;
+
+   // Determine if concealed (like in a building).
+   aResult.mCheckedStatus |= WsfSensorResult::cCONCEALMENT;
+   if (aTargetPtr->GetConcealmentFactor() > 0.99F)
    {
-      // TRANSMITTER only
+      // We can't detect if it's in a building (or something like that)
+      aResult.mFailedStatus |= WsfSensorResult::cCONCEALMENT;
+      // Must have object pointers so event_output and debug output show locations.
+      aResult.BeginGenericInteraction(mBeamList[0]->GetEM_Xmtr(), aTargetPtr, mBeamList[0]->GetEM_Rcvr());
    }
-   else if (aResult.mFailedStatus == 0)
-   {
-      // Determine if concealed (like in a building).
-      aResult.mCheckedStatus |= WsfSensorResult::cCONCEALMENT;
-      if (aTargetPtr->GetConcealmentFactor() > 0.99F)
-      {
-         // We can't detect if it's in a building (or something like that)
-         aResult.mFailedStatus |= WsfSensorResult::cCONCEALMENT;
-         // Must have object pointers so event_output and debug output show locations.
-         aResult.BeginGenericInteraction(mBeamList[0]->GetEM_Xmtr(), aTargetPtr, mBeamList[0]->GetEM_Rcvr());
-      }
 
-      mBeamList[0]->AttemptToDetect(aSimTime, aTargetPtr, aSettings, aResult);
+   mBeamList[0]->AttemptToDetect(aSimTime, aTargetPtr, aSettings, aResult);
 
-      // Perform the terrain masking check if the detection was successful and if the masking check
-      // was not performed internally as part of the detection processing.
+   // Perform the terrain masking check if the detection was successful and if the masking check
+   // was not performed internally as part of the detection processing.
+   //
+   // Also see NOTE in multi-beam processing.
+   int terrainStatusMask = (WsfSensorResult::cXMTR_TERRAIN_MASKING | WsfSensorResult::cRCVR_TERRAIN_MASKING);
+   int terrainCheckedStatus = aResult.mCheckedStatus & terrainStatusMask;
+   int terrainFailedStatus  = aResult.mFailedStatus  & terrainStatusMask;
+   if ((aResult.mFailedStatus == 0) &&
+       (terrainCheckedStatus == 0))
+   {
+      aResult.MaskedByTerrain();
+      terrainCheckedStatus = aResult.mCheckedStatus & terrainStatusMask;
+      terrainFailedStatus  = aResult.mFailedStatus  & terrainStatusMask;
+   }
+
+   if (mBeamList.size() > 1)
+   {
+      // NOTE: Terrain masking used to be checked AFTER all beams had performed the basic detection
+      // processing. Unfortunately this prevented the SensorDetectionAttempt observers from knowing
+      // if terrain would mask target. Now terrain masking is now checked on first beam that passes
+      // the all other detection criteria and is simply propagated to the subsequent beams.
       //
-      // Also see NOTE in multi-beam processing.
-      int terrainStatusMask = (WsfSensorResult::cXMTR_TERRAIN_MASKING | WsfSensorResult::cRCVR_TERRAIN_MASKING);
-      int terrainCheckedStatus = aResult.mCheckedStatus & terrainStatusMask;
-      int terrainFailedStatus  = aResult.mFailedStatus  & terrainStatusMask;
-      if ((aResult.mFailedStatus == 0) &&
-          (terrainCheckedStatus == 0))
+      // NOTE: This processing cannot be performed for multi-beam bistatic systems because each
+      // beam could be receiving from a different transmitter. So the terrain masking will be checked
+      // for EACH beam that successfully receives a detectable signal. I'm not sure if we'll ever
+      // encounter multi-beam bistatic systems, but just in case...
+
+      aBeamResults.resize(mBeamList.size() - 1);
+      WsfSensorResult* bestResultPtr = &aResult;
+      for (unsigned int beamIndex = 1; beamIndex < mBeamList.size(); ++beamIndex)
       {
-         aResult.MaskedByTerrain();
-         terrainCheckedStatus = aResult.mCheckedStatus & terrainStatusMask;
-         terrainFailedStatus  = aResult.mFailedStatus  & terrainStatusMask;
+         WsfSensorResult& tempResult = aBeamResults[beamIndex - 1];
+         tempResult.Reset(aSettings);
+         tempResult.mBeamIndex = beamIndex;
+         // Always force a terrain check for multi-beam bistatic (based on first beam)
+         if (! bestResultPtr->mBistatic)
+         {
+            terrainCheckedStatus = 0;
+            terrainFailedStatus  = 0;
+         }
+         tempResult.mCheckedStatus = ut::safe_cast<unsigned int, int>(terrainCheckedStatus);
+         tempResult.mFailedStatus  = ut::safe_cast<unsigned int, int>(terrainFailedStatus);
+         mBeamList[beamIndex]->AttemptToDetect(aSimTime, aTargetPtr, aSettings, tempResult);
+
+         // Perform terrain masking check (or used the cached result) if the basic detection criteria passed.
+         if (tempResult.mFailedStatus == 0)
+         {
+            if (terrainCheckedStatus == 0)
+            {
+               tempResult.MaskedByTerrain();
+               terrainCheckedStatus = tempResult.mCheckedStatus & terrainStatusMask;
+               terrainFailedStatus  = tempResult.mFailedStatus  & terrainStatusMask;
+            }
+            tempResult.mCheckedStatus |= terrainCheckedStatus;
+            tempResult.mFailedStatus  |= terrainFailedStatus;
+         }
+
+         if (tempResult.mSignalToNoise > bestResultPtr->mSignalToNoise)
+         {
+            bestResultPtr  = &tempResult;
+            aBestBeamIndex = beamIndex;
+         }
       }
+   }
+}
+
+// =================================================================================================
+//! Complete a detection attempt.
+//! Observers are notified of the result of each beam (in beam order), the result of the beam with the
+//! best signal-to-noise is selected and the sensor components are given the chance to modify it.
+//! @param aSimTime       The current simulation time.
+//! @param aTargetPtr     The target being detected.
+//! @param aEvaluated     The value returned by PrepareDetectionAttempt.
+//! @param aResult        [updated] On input the result of the first beam. On output the result of the best beam.
+//! @param aBeamResults   The results for the second and subsequent beams from EvaluateDetectionAttempt.
+//! @param aBestBeamIndex The index of the best beam from EvaluateDetectionAttempt.
+//! @returns true if the target was detected.
+bool WsfRadarSensor::RadarMode::ApplyDetectionAttempt(double                        aSimTime,
+                                                      WsfPlatform*                  aTargetPtr,
+                                                      bool                          aEvaluated,
+                                                      WsfSensorResult&              aResult,
+                                                      std::vector<WsfSensorResult>& aBeamResults,
+                                                      size_t                        aBestBeamIndex)
+{
+   bool detected = false;
+   if (!mCanReceive &&  mCanTransmit)
+   {
+      // TRANSMITTER only
+   }
+   else if (aEvaluated)
+   {
       GetSensor()->NotifySensorDetectionAttempted(aSimTime, aTargetPtr, aResult);
       if (aResult.GetTransmitter() != nullptr)
       {
@@ -1665,62 +2207,23 @@ bool WsfRadarSensor::RadarMode::AttemptToDetect(double           aSimTime,
          aResult.Print(note);
       }
 
-      if (mBeamList.size() > 1)
+      for (unsigned int beamIndex = 1; beamIndex < mBeamList.size(); ++beamIndex)
       {
-         // NOTE: Terrain masking used to be checked AFTER all beams had performed the basic detection
-         // processing. Unfortunately this prevented the SensorDetectionAttempt observers from knowing
-         // if terrain would mask target. Now terrain masking is now checked on first beam that passes
-         // the all other detection criteria and is simply propagated to the subsequent beams.
-         //
-         // NOTE: This processing cannot be performed for multi-beam bistatic systems because each
-         // beam could be receiving from a different transmitter. So the terrain masking will be checked
-         // for EACH beam that successfully receives a detectable signal. I'm not sure if we'll ever
-         // encounter multi-beam bistatic systems, but just in case...
-
-         WsfSensorResult tempResult;
-         for (unsigned int beamIndex = 1; beamIndex < mBeamList.size(); ++beamIndex)
+         WsfSensorResult& tempResult = aBeamResults[beamIndex - 1];
+         GetSensor()->NotifySensorDetectionAttempted(aSimTime, aTargetPtr, tempResult);
+         if (tempResult.GetTransmitter() != nullptr)
          {
-            tempResult.Reset(aSettings);
-            tempResult.mBeamIndex = beamIndex;
-            // Always force a terrain check for multi-beam bistatic (based on first beam)
-            if (! aResult.mBistatic)
-            {
-               terrainCheckedStatus = 0;
-               terrainFailedStatus  = 0;
-            }
-            tempResult.mCheckedStatus = ut::safe_cast<unsigned int, int>(terrainCheckedStatus);
-            tempResult.mFailedStatus  = ut::safe_cast<unsigned int, int>(terrainFailedStatus);
-            mBeamList[beamIndex]->AttemptToDetect(aSimTime, aTargetPtr, aSettings, tempResult);
-
-            // Perform terrain masking check (or used the cached result) if the basic detection criteria passed.
-            if (tempResult.mFailedStatus == 0)
-            {
-               if (terrainCheckedStatus == 0)
-               {
-                  tempResult.MaskedByTerrain();
-                  terrainCheckedStatus = tempResult.mCheckedStatus & terrainStatusMask;
-                  terrainFailedStatus  = tempResult.mFailedStatus  & terrainStatusMask;
-               }
-               tempResult.mCheckedStatus |= terrainCheckedStatus;
-               tempResult.mFailedStatus  |= terrainFailedStatus;
-            }
-
-            GetSensor()->NotifySensorDetectionAttempted(aSimTime, aTargetPtr, tempResult);
-            if (tempResult.GetTransmitter() != nullptr)
-            {
-               tempResult.GetTransmitter()->NotifyListeners(aSimTime, tempResult);     // Notify listeners for possible passive detection
-            }
-            if (GetSensor()->DebugEnabled())
-            {
-               auto out = ut::log::debug() << "Beam " << beamIndex + 1 << ":";
-               tempResult.Print(out);
-            }
-
-            if (tempResult.mSignalToNoise > aResult.mSignalToNoise)
-            {
-               aResult = tempResult;
-            }
+            tempResult.GetTransmitter()->NotifyListeners(aSimTime, tempResult);     // Notify listeners for possible passive detection
          }
+         if (GetSensor()->DebugEnabled())
+         {
+            auto out = ut::log::debug() << "Beam " << beamIndex + 1 << ":";
+            tempResult.Print(out);
+         }
+      }
+      if (aBestBeamIndex > 0)
+      {
+         aResult = aBeamResults[aBestBeamIndex - 1];
       }
 
       // Compute component effects.
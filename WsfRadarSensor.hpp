@@ -53,6 +53,9 @@ class     WsfEM_Clutter;
 #include "WsfSensorBeam.hpp"
 #include "WsfSensorMode.hpp"
 #include "WsfSensorResult.hpp"
+#include "WsfSensorTracker.hpp"
+class     WsfSensorThreadPool;
+#include "WsfTrackId.hpp"
 
 //! A specialization of WsfSensor that implements a simple radar.
 class WSF_EXPORT WsfRadarSensor : public WsfSensor
@@ -62,11 +65,13 @@ class WSF_EXPORT WsfRadarSensor : public WsfSensor
       WsfRadarSensor(WsfScenario& aScenario);
       WsfRadarSensor(const WsfRadarSensor& aSrc);
       WsfRadarSensor& operator=(const WsfRadarSensor&) = delete;
+      ~WsfRadarSensor() override;
 
       WsfSensor* Clone() const override;
       bool Initialize(double aSimTime) override;
       void PlatformAdded(double       aSimTime,
                          WsfPlatform* aPlatformPtr) override;
+      void PlatformDeleted(WsfPlatform* aPlatformPtr) override;
       bool ProcessInput(UtInput& aInput) override;
       void Update(double aSimTime) override;
       void PerformScheduledDetections(double aSimTime) override;
@@ -266,6 +271,32 @@ class WSF_EXPORT WsfRadarSensor : public WsfSensor
             void Deselect(double aSimTime) override;
             void Select(double aSimTime) override;
 
+            //! @name Phases of a detection attempt.
+            //! AttemptToDetect is composed of these three phases. PrepareDetectionAttempt and
+            //! ApplyDetectionAttempt update the sensor and target and notify observers, so they must be called
+            //! serially and in order. EvaluateDetectionAttempt performs only the physics of the attempt and may be
+            //! called concurrently for different targets.
+            //@{
+            bool PrepareDetectionAttempt(double           aSimTime,
+                                         WsfPlatform*     aTargetPtr,
+                                         Settings&        aSettings,
+                                         WsfSensorResult& aResult);
+
+            void EvaluateDetectionAttempt(double                        aSimTime,
+                                          WsfPlatform*                  aTargetPtr,
+                                          Settings&                     aSettings,
+                                          WsfSensorResult&              aResult,
+                                          std::vector<WsfSensorResult>& aBeamResults,
+                                          size_t&                       aBestBeamIndex);
+
+            bool ApplyDetectionAttempt(double                        aSimTime,
+                                       WsfPlatform*                  aTargetPtr,
+                                       bool                          aEvaluated,
+                                       WsfSensorResult&              aResult,
+                                       std::vector<WsfSensorResult>& aBeamResults,
+                                       size_t                        aBestBeamIndex);
+            //@}
+
             bool                       mOverrideMeasurementWithTruth;
             bool                       mCanTransmit;
             bool                       mCanReceive;
@@ -282,10 +313,28 @@ class WSF_EXPORT WsfRadarSensor : public WsfSensor
             bool                       mAltFreqChangeScheduled;
             double                     mLastAltFreqSelectTime;
             bool                       mIsFrequencyAgile;
+
+            //! Results of the second and subsequent beams (used by AttemptToDetect).
+            std::vector<WsfSensorResult> mBeamResults;
       };
 
    private:
 
+      class DetectionBatch;
+
+      bool ProcessTargetSelection(double                      aSimTime,
+                                  size_t                      aTargetIndex,
+                                  WsfTrackId&                 aRequestId,
+                                  Settings&                   aSettings,
+                                  WsfSensorResult&            aResult,
+                                  WsfSensorTracker::Settings& aTrackerSettings);
+
+      void PerformBatchedDetections(double aSimTime);
+
+      void EvaluateDetectionBatch(double aSimTime);
+
+      bool CheckParallelDetectionSupport();
+
       //! The sensor-specific list of modes (not valid until Initialize is called)
       std::vector<RadarMode*>          mRadarModeList;
 
@@ -303,6 +352,18 @@ class WSF_EXPORT WsfRadarSensor : public WsfSensor
 
       //! Temporary geometry platform pointer to be created and used as required for false target interactions.
       WsfPlatform*                     mTempGeometryPtr;
+
+      //! true if detection attempts that are due at the same time are to be evaluated concurrently.
+      bool                             mParallelDetectionAttempts;
+
+      //! The number of threads requested from the simulation's sensor thread pool (0 = use the hardware concurrency).
+      unsigned int                     mParallelDetectionThreadCount;
+
+      //! The batch storage for parallel detection attempts (not valid until Initialize is called).
+      std::unique_ptr<DetectionBatch>  mDetectionBatchPtr;
+
+      //! The simulation's sensor thread pool (not valid until Initialize is called, and only if parallel).
+      WsfSensorThreadPool*             mThreadPoolPtr;
 };
 
 #endif
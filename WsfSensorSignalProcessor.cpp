@@ -182,6 +182,20 @@ void WsfSensorSignalProcessor::List::Execute(double           aSimTime,
    }
 }
 
+// ================================================================================================
+//! Return true if every processor in the list is reentrant (see WsfSensorSignalProcessor::IsReentrant).
+bool WsfSensorSignalProcessor::List::IsReentrant() const
+{
+   for (auto& processorPtr : mProcessorPtrs)
+   {
+      if (!processorPtr->IsReentrant())
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
 // ================================================================================================
 // Start of simple pre-defined signal processors.
 //
@@ -205,6 +219,7 @@ class ConstantClutterSuppression : public WsfSensorSignalProcessor
       bool ProcessInput(UtInput& aInput) override;
       void Execute(double           aSimTime,
                    WsfSensorResult& aResult) override;
+      bool IsReentrant() const override { return true; }
    private:
       double              mSuppressionFactor;
 };
@@ -247,6 +262,7 @@ class ScaleFactor : public WsfSensorSignalProcessor
       bool ProcessInput(UtInput& aInput) override;
       void Execute(double           aSimTime,
                    WsfSensorResult& aResult) override;
+      bool IsReentrant() const override { return true; }
    private:
       double              mScaleFactor;
 };
@@ -87,6 +87,8 @@ class WSF_EXPORT WsfSensorSignalProcessor : public WsfObject
             void Execute(double           aSimTime,
                          WsfSensorResult& aResult);
 
+            bool IsReentrant() const;
+
          private:
             ListType mProcessorPtrs;
       };
@@ -119,6 +121,11 @@ class WSF_EXPORT WsfSensorSignalProcessor : public WsfObject
       virtual void Execute(double           aSimTime,
                            WsfSensorResult& aResult) = 0;
 
+      //! May Execute be called concurrently for different results?
+      //! Processors that keep per-call state in member variables must return false (the default).
+      //! Sensors that evaluate detection attempts on multiple threads require this.
+      virtual bool IsReentrant() const { return false; }
+
    protected:
 
       //! If 'true' additional information is written out to aid debugging
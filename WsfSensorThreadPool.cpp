@@ -0,0 +1,173 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfSensorThreadPool.hpp"
+
+#include "UtMemory.hpp"
+#include "WsfSimulation.hpp"
+
+namespace
+{
+//! The name under which the pool is registered with the simulation.
+const char* cEXTENSION_NAME = "wsf_sensor_thread_pool";
+} // namespace
+
+// =================================================================================================
+//! Return the pool for the simulation, creating it if necessary.
+//! @note This must not be called concurrently (it is intended to be called during initialization).
+// static
+WsfSensorThreadPool& WsfSensorThreadPool::FindOrCreate(WsfSimulation& aSimulation)
+{
+   auto poolPtr = static_cast<WsfSensorThreadPool*>(aSimulation.FindExtension(cEXTENSION_NAME));
+   if (poolPtr == nullptr)
+   {
+      auto newPoolPtr = ut::make_unique<WsfSensorThreadPool>();
+      poolPtr         = newPoolPtr.get();
+      aSimulation.RegisterExtension(cEXTENSION_NAME, std::move(newPoolPtr));
+   }
+   return *poolPtr;
+}
+
+// =================================================================================================
+WsfSensorThreadPool::WsfSensorThreadPool()
+   : WsfSimulationExtension()
+   , mThreads()
+   , mExecuteMutex()
+   , mMutex()
+   , mStartCondition()
+   , mDoneCondition()
+   , mFunctionPtr(nullptr)
+   , mCount(0)
+   , mNextIndex(0)
+   , mActiveCount(0)
+   , mGeneration(0)
+   , mShutdown(false)
+   , mExceptionPtr()
+{
+}
+
+// =================================================================================================
+WsfSensorThreadPool::~WsfSensorThreadPool()
+{
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mShutdown = true;
+   }
+   mStartCondition.notify_all();
+   for (std::thread& thread : mThreads)
+   {
+      thread.join();
+   }
+}
+
+// =================================================================================================
+//! Ensure the pool has at least the specified number of threads.
+//! @param aThreadCount The number of threads, including the thread that calls Execute.
+void WsfSensorThreadPool::Reserve(unsigned int aThreadCount)
+{
+   std::lock_guard<std::mutex> executeLock(mExecuteMutex);
+   std::lock_guard<std::mutex> lock(mMutex);
+   while (GetThreadCount() < aThreadCount)
+   {
+      mThreads.emplace_back(&WsfSensorThreadPool::Run, this, mGeneration);
+   }
+}
+
+// =================================================================================================
+//! Invoke aFunction(i) for each i in [0, aCount) and wait for all of the calls to complete.
+//! The order in which the calls are made is not defined.
+//! If a call throws an exception, the calls that have not yet started are abandoned and the
+//! exception is rethrown once the calls that are in progress have completed.
+void WsfSensorThreadPool::Execute(size_t aCount, const std::function<void(size_t)>& aFunction)
+{
+   std::unique_lock<std::mutex> executeLock(mExecuteMutex, std::try_to_lock);
+   if ((!executeLock.owns_lock()) || mThreads.empty() || (aCount < 2))
+   {
+      for (size_t i = 0; i < aCount; ++i)
+      {
+         aFunction(i);
+      }
+      return;
+   }
+
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mFunctionPtr = &aFunction;
+      mCount       = aCount;
+      mNextIndex   = 0;
+      mActiveCount = mThreads.size();
+      ++mGeneration;
+   }
+   mStartCondition.notify_all();
+
+   Work();
+
+   std::unique_lock<std::mutex> lock(mMutex);
+   mDoneCondition.wait(lock, [this]() { return mActiveCount == 0; });
+   mFunctionPtr = nullptr;
+
+   // Pass an exception thrown by the function (on any thread) on to the caller.
+   std::exception_ptr exceptionPtr = mExceptionPtr;
+   mExceptionPtr                   = nullptr;
+   lock.unlock();
+   if (exceptionPtr)
+   {
+      std::rethrow_exception(exceptionPtr);
+   }
+}
+
+// =================================================================================================
+//! The main loop of a worker thread.
+//! @param aGeneration The generation of work that was current when the thread was created.
+void WsfSensorThreadPool::Run(unsigned int aGeneration)
+{
+   unsigned int                 generation = aGeneration;
+   std::unique_lock<std::mutex> lock(mMutex);
+   while (true)
+   {
+      mStartCondition.wait(lock, [this, generation]() { return mShutdown || (mGeneration != generation); });
+      if (mShutdown)
+      {
+         break;
+      }
+      generation = mGeneration;
+      lock.unlock();
+      Work();
+      lock.lock();
+      if (--mActiveCount == 0)
+      {
+         mDoneCondition.notify_one();
+      }
+   }
+}
+
+// =================================================================================================
+//! Perform calls until there are none left to start.
+void WsfSensorThreadPool::Work()
+{
+   size_t index;
+   while ((index = mNextIndex++) < mCount)
+   {
+      try
+      {
+         (*mFunctionPtr)(index);
+      }
+      catch (...)
+      {
+         std::lock_guard<std::mutex> lock(mMutex);
+         if (!mExceptionPtr)
+         {
+            mExceptionPtr = std::current_exception();
+         }
+         mNextIndex = mCount; // Abandon the calls that have not started.
+      }
+   }
+}
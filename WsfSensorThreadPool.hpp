@@ -0,0 +1,78 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2003-2015 The Boeing Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFSENSORTHREADPOOL_HPP
+#define WSFSENSORTHREADPOOL_HPP
+
+#include "wsf_export.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "WsfSimulationExtension.hpp"
+class WsfSimulation;
+
+//! A pool of worker threads shared by all of the sensors in a simulation.
+//!
+//! Sensors use the pool to evaluate independent pieces of work (such as the physics of a batch of
+//! detection attempts) concurrently. There is one pool per simulation, so the number of threads
+//! does not grow with the number of sensors. The pool is created by the first sensor that requests
+//! it and is sized to the largest thread count requested by any sensor.
+//!
+//! Only one caller uses the workers at a time. If another thread is already executing on the pool
+//! (as can happen when platforms are updated on multiple threads), the work is simply performed
+//! on the calling thread.
+class WSF_EXPORT WsfSensorThreadPool : public WsfSimulationExtension
+{
+public:
+   static WsfSensorThreadPool& FindOrCreate(WsfSimulation& aSimulation);
+
+   WsfSensorThreadPool();
+   WsfSensorThreadPool(const WsfSensorThreadPool&) = delete;
+   WsfSensorThreadPool& operator=(const WsfSensorThreadPool&) = delete;
+   ~WsfSensorThreadPool() override;
+
+   void Reserve(unsigned int aThreadCount);
+
+   //! Return the number of threads (including the calling thread) that participate in Execute.
+   unsigned int GetThreadCount() const { return static_cast<unsigned int>(mThreads.size() + 1); }
+
+   void Execute(size_t aCount, const std::function<void(size_t)>& aFunction);
+
+private:
+   void Run(unsigned int aGeneration);
+   void Work();
+
+   std::vector<std::thread> mThreads;
+
+   //! Held by the caller of Execute (and by Reserve) for the duration of the call.
+   std::mutex mExecuteMutex;
+
+   //! Protects the members below that are shared with the workers.
+   std::mutex                         mMutex;
+   std::condition_variable            mStartCondition;
+   std::condition_variable            mDoneCondition;
+   const std::function<void(size_t)>* mFunctionPtr;
+   size_t                             mCount;
+   std::atomic<size_t>                mNextIndex;
+   size_t                             mActiveCount;
+   unsigned int                       mGeneration;
+   bool                               mShutdown;
+   //! The first exception thrown by the function during the current Execute.
+   std::exception_ptr mExceptionPtr;
+};
+
+#endif
@@ -64,6 +64,8 @@ class WSF_EXPORT WsfTabularAttenuation : public WsfEM_Attenuation
 
       bool AcceptsInlineBlockInput() const override         { return true; }
 
+      bool IsReentrant() const override                     { return true; }
+
       double ComputeAttenuationFactor(WsfEM_Interaction&          aInteraction,
                                               WsfEnvironment&             aEnvironment,
                                               WsfEM_Interaction::Geometry aGeometry) override;